@@ -0,0 +1,88 @@
+# ----------------------------------------------------------------------------------------
+# 					SIMULATION PARAMETERS FOR THE PIC-CODE SMILEI
+# ----------------------------------------------------------------------------------------
+# Tunnel ionization with tabulated rates (ionization_tolerance), compared to the exact formula
+
+import math
+l0 = 2.0*math.pi	# wavelength in normalized units
+t0 = l0				# optical cycle in normalized units
+rest = 9000.0		# nb of timestep in 1 optical cycle
+resx = 8000.0		# nb cells in 1 wavelength
+Lsim = 0.01*l0	    # simulation length
+Tsim = 0.2*t0		# duration of the simulation
+
+
+Main(
+	geometry = "1Dcartesian",
+	 
+	interpolation_order = 2,
+	 
+	cell_length = [l0/resx],
+	grid_length  = [Lsim],
+	
+	number_of_patches = [ 8 ],
+	
+	timestep = t0/rest,
+	simulation_time = Tsim,
+	 
+	EM_boundary_conditions = [ ['silver-muller'] ],
+	
+	reference_angular_frequency_SI = 6*math.pi*1e14,
+	
+)
+
+def By(t):
+	return 1e-7 * math.sin(t)
+def Bz(t):
+	return 1.0 * math.sin(t)
+
+Laser(
+	box_side = "xmin",
+	space_time_profile = [By, Bz],
+)
+
+DiagScalar(every = 20)
+
+for bsi_model in ["none", "Tong_Lin", "KAG"]:
+    for rates, tolerance in [["exact", 0.], ["tables", 1e-6]]:
+        name = bsi_model+'_'+rates
+        Species(
+            name = 'carbon_'+name,
+            ionization_model = "tunnel",
+            bsi_model = bsi_model,
+            ionization_tolerance = tolerance,
+            ionization_electrons = 'electron_'+name,
+            atomic_number = 6,
+            position_initialization = 'regular',
+            momentum_initialization = 'cold',
+            particles_per_cell = 1000,
+            mass = 1836.0*1000.,
+            charge = 0.0,
+            number_density = 0.1,
+            boundary_conditions = [
+                ["remove", "remove"],
+            ],
+        )
+
+        Species(
+            name = 'electron_'+name,
+            position_initialization = 'regular',
+            momentum_initialization = 'cold',
+            particles_per_cell = 0,
+            mass = 1.0,
+            charge = -1.0,
+            charge_density = 0.0,
+            boundary_conditions = [
+                ["remove", "remove"],
+            ],
+        )
+
+        DiagParticleBinning(
+            name = "carbon_"+name,
+            deposited_quantity = "weight",
+            every = 20,
+            species = ["carbon_"+name],
+            axes = [
+                ["charge",  -0.5, 6.5, 7]
+            ]
+        )
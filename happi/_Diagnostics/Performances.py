@@ -71,6 +71,13 @@ def PartitionMatrix( matrix, listOfValues, oversize=0 ):
 class Performances(Diagnostic):
 	"""Class for loading a Performances diagnostic"""
 
+	# Quantities of each patch, for a given species
+	_patchSpeciesQuantities = [
+		"vecto", "timer_dynamics", "timer_sort", "cycles", "instructions",
+		"timer_interpolation", "timer_push", "timer_projection", "timer_cell_keys",
+		"timer_ionization", "timer_radiation", "timer_breit_wheeler"
+	]
+
 	def _init(self, raw=None, map=None, histogram=None, timesteps=None, data_log=False, data_transform=None, species=None, cumulative=True, **kwargs):
 
 		info = self.simulation.performanceInfo()
@@ -179,11 +186,15 @@ class Performances(Diagnostic):
 		self._data_transform = data_transform
 		self._cumulative = cumulative
 		
-		# In case of "vecto" quantity, get the species
+		# In case of quantities per patch and species, get the species
 		if species is not None:
-			if self.operation != "vecto":
-				raise Exception("Argument `species` only valid with quantity 'vecto'")
+			if self.operation not in self._patchSpeciesQuantities:
+				raise Exception("Argument `species` only valid with quantities "+", ".join(self._patchSpeciesQuantities))
 			self._species = str(species)
+			if self.operation.startswith("timer"):
+				self._operationunits = "seconds"
+		elif self.operation in self._patchSpeciesQuantities:
+			raise Exception("Quantity `"+self.operation+"` requires the argument `species`")
 		
 		# 2 - Manage timesteps
 		# -------------------------------------------------------------------
@@ -260,7 +271,16 @@ class Performances(Diagnostic):
 
 	# get all available quantities
 	def getAvailableQuantities(self):
-		return self._availableQuantities_uint + self._availableQuantities_double
+		quantities = self._availableQuantities_uint + self._availableQuantities_double
+		# Quantities per patch, found in the first timestep
+		if self._h5items and "patches" in self._h5items[0]:
+			patches = self._h5items[0]["patches"]
+			if "mpi_rank" in patches:
+				quantities += ["mpi_rank"]
+			for species in patches.values():
+				if hasattr(species, "keys"):
+					quantities += [q for q in self._patchSpeciesQuantities if q in species and q not in quantities]
+		return quantities
 
 	# Method to obtain the data only
 	def _getDataAtTime(self, t):
@@ -288,21 +308,24 @@ class Performances(Diagnostic):
 		
 		# Calculate the operation
 		# First patch performance information
-		if  self.operation in ["vecto", "mpi_rank"]:
+		if  self.operation == "mpi_rank" or self.operation in self._patchSpeciesQuantities:
 			if self._mode != "raw":
-				print("With quantities `vecto` or `mpi_rank`, only mode `raw` is supported")
+				print("With quantities per patch, only mode `raw` is supported")
 				return []
 			
 			if "patches" not in self._h5items[index].keys():
 				print("No patches group in timestep {}".format(str(t)))
 				return []
 
-			if self.operation=="vecto":
+			if self.operation in self._patchSpeciesQuantities:
 
 				if self._species not in self._h5items[index]["patches"].keys():
 					print("Requested species {} does not have a group".format(self._species))
 					return []
-				patches_buffer = self._np.array(self._h5items[index]["patches"][self._species]["vecto"])
+				if self.operation not in self._h5items[index]["patches"][self._species].keys():
+					print("Requested quantity {} not found for species {}".format(self.operation, self._species))
+					return []
+				patches_buffer = self._np.array(self._h5items[index]["patches"][self._species][self.operation])
 
 			elif self.operation=="mpi_rank":
 
@@ -325,7 +348,7 @@ class Performances(Diagnostic):
 			)
 			
 			# Matrix of patches reconstituted
-			A = self._np.empty_like(i_patch)
+			A = self._np.empty(i_patch.shape, dtype=patches_buffer.dtype)
 			A[i_patch] = patches_buffer
 			A = self._np.squeeze(A.reshape([x_patches.max()+1, y_patches.max()+1, z_patches.max()+1]))
 
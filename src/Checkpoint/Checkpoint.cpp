@@ -9,6 +9,8 @@
 #include <sstream>
 #include <iomanip>
 #include <string>
+#include <cstdio>
+#include <chrono>
 
 #include <mpi.h>
 
@@ -35,6 +37,7 @@
 #include "LaserEnvelope.h"
 #include "BinaryProcesses.h"
 #include "CollisionalNuclearReaction.h"
+#include "Timers.h"
 
 using namespace std;
 
@@ -48,11 +51,15 @@ Checkpoint::Checkpoint( Params &params, SmileiMPI *smpi ) :
     dump_step( 0 ),
     dump_minutes( 0.0 ),
     exit_after_dump( true ),
+    asynchronous( false ),
     time_reference( MPI_Wtime() ),
     keep_n_dumps( 2 ),
     keep_n_dumps_max( 10000 ),
     dump_deflate( 0 ),
-    file_grouping( 0 )
+    file_grouping( 0 ),
+    current_staging_( 0 ),
+    max_staging_memory_( 0. ),
+    io_time_( 0. )
 {
 
     if( PyTools::nComponents( "Checkpoints" ) > 0 ) {
@@ -89,6 +96,27 @@ Checkpoint::Checkpoint( Params &params, SmileiMPI *smpi ) :
             MESSAGE( 1, "Code will group checkpoint files by "<< file_grouping );
         }
 
+        PyTools::extract( "asynchronous", asynchronous, "Checkpoints"  );
+        if( asynchronous ) {
+            hbool_t threadsafe = false;
+            H5is_library_threadsafe( &threadsafe );
+            // The background thread also makes the MPI-IO calls of parallel HDF5
+            int mpi_thread_level;
+            MPI_Query_thread( &mpi_thread_level );
+            if( ! threadsafe ) {
+                WARNING( "Checkpoints: option `asynchronous` ignored because the HDF5 library is not thread-safe (parallel HDF5 builds rarely are): checkpoints are written synchronously" );
+                asynchronous = false;
+            } else if( mpi_thread_level != MPI_THREAD_MULTIPLE ) {
+                WARNING( "Checkpoints: option `asynchronous` ignored because MPI does not provide MPI_THREAD_MULTIPLE: checkpoints are written synchronously" );
+                asynchronous = false;
+            }
+        }
+        PyTools::extract( "max_staging_memory", max_staging_memory_, "Checkpoints"  );
+        max_staging_memory_ *= 1024.*1024.;
+        if( asynchronous ) {
+            MESSAGE( 1, "Checkpoint files written in the background" );
+        }
+
         smpi->barrier();
 
         if( params.restart ) {
@@ -180,10 +208,17 @@ Checkpoint::Checkpoint( Params &params, SmileiMPI *smpi ) :
     nDim_particle=params.nDim_particle;
 }
 
-Checkpoint::~Checkpoint() {}
+Checkpoint::~Checkpoint()
+{
+    if( writer_.joinable() ) {
+        writer_.join();
+    }
+}
 
-void Checkpoint::dump( VectorPatch &vecPatches, Region &region, unsigned int itime, SmileiMPI *smpi, SimWindow *simWindow, Params &params )
+void Checkpoint::dump( VectorPatch &vecPatches, Region &region, unsigned int itime, SmileiMPI *smpi, SimWindow *simWindow, Params &params, Timers &timers )
 {
+    timers.checkpoint.restartInTask();
+
     bool dump_now = false;
     
     // Find out whether we should make a checkpoint due to dump_minutes
@@ -207,6 +242,32 @@ void Checkpoint::dump( VectorPatch &vecPatches, Region &region, unsigned int iti
         signal_received = 0;
         time_reference = MPI_Wtime();
     }
+
+    timers.checkpoint.updateInTask( params.printNow( itime ) );
+    timers.checkpointIO.set( io_time_, params.printNow( itime ) );
+}
+
+void Checkpoint::waitAsynchronousDump( Timers &timers )
+{
+    if( writer_.joinable() ) {
+        writer_.join();
+    }
+    timers.checkpointIO.set( io_time_ );
+}
+
+void Checkpoint::writeStaging( unsigned int istaging, std::string dumpName )
+{
+    auto start = std::chrono::steady_clock::now();
+
+    // The file only gets its final name once complete, so that an incomplete file is never used for restart
+    std::string tmpName = dumpName + ".tmp";
+    staging_[istaging].write( tmpName );
+    if( std::rename( tmpName.c_str(), dumpName.c_str() ) != 0 ) {
+        WARNING( "Could not rename checkpoint file " << tmpName );
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    io_time_ = io_time_ + elapsed.count();
 }
 
 void Checkpoint::dumpAll( VectorPatch &vecPatches, Region &region, unsigned int itime,  SmileiMPI *smpi, SimWindow *simWin,  Params &params )
@@ -222,8 +283,6 @@ void Checkpoint::dumpAll( VectorPatch &vecPatches, Region &region, unsigned int
     nameDumpTmp << "dump-" << setfill( '0' ) << setw( 5 ) << num_dump << "-" << setfill( '0' ) << setw( 10 ) << smpi->getRank() << ".h5" ;
     std::string dumpName=nameDumpTmp.str();
 
-
-    H5Write f( dumpName );
     dump_number++;
 
 #ifdef  __DEBUG
@@ -245,6 +304,65 @@ void Checkpoint::dumpAll( VectorPatch &vecPatches, Region &region, unsigned int
     //vecPatches.copyDeviceStateToHost();
 #endif
 
+    if( asynchronous ) {
+        // Size of the staged checkpoint, computed before copying anything
+        size_t staged_size = 0;
+        if( max_staging_memory_ > 0. ) {
+            CheckpointStaging counter( true );
+            CheckpointStaging::Group f = counter.root();
+            dumpFile( f, vecPatches, region, itime, smpi, simWin, params );
+            staged_size = counter.size();
+        }
+
+        if( max_staging_memory_ > 0. && staged_size > max_staging_memory_ ) {
+            // Too large to be staged: written directly once the previous checkpoint is complete
+            WARNING( "Checkpoint staging would use " << staged_size/1048576. << " MB, more than max_staging_memory: written synchronously" );
+            if( writer_.joinable() ) {
+                writer_.join();
+            }
+            staging_[0].release();
+            staging_[1].release();
+            H5Write f( dumpName );
+            dumpFile( f, vecPatches, region, itime, smpi, simWin, params );
+            return;
+        }
+
+        // When the checkpoint being written and the new one do not fit together, wait for the first one to be complete
+        CheckpointStaging &other = staging_[1 - current_staging_];
+        if( max_staging_memory_ > 0. && staged_size + other.capacity() > max_staging_memory_ ) {
+            if( writer_.joinable() ) {
+                writer_.join();
+            }
+            other.release();
+        }
+
+        // Copy everything in the staging area which is not being written
+        CheckpointStaging &staging = staging_[current_staging_];
+        if( max_staging_memory_ > 0. && staging.capacity() > max_staging_memory_ ) {
+            staging.release();
+        }
+        staging.clear();
+        staging.reserve( staged_size );
+        CheckpointStaging::Group f = staging.root();
+        dumpFile( f, vecPatches, region, itime, smpi, simWin, params );
+
+        // Only one checkpoint is written at a time
+        if( writer_.joinable() ) {
+            writer_.join();
+        }
+        writer_ = std::thread( &Checkpoint::writeStaging, this, current_staging_, dumpName );
+        current_staging_ = 1 - current_staging_;
+    } else {
+        H5Write f( dumpName );
+        dumpFile( f, vecPatches, region, itime, smpi, simWin, params );
+    }
+
+}
+
+
+template<class W>
+void Checkpoint::dumpFile( W &f, VectorPatch &vecPatches, Region &region, unsigned int itime,  SmileiMPI *smpi, SimWindow *simWin,  Params &params )
+{
     // Write basic attributes
     f.attr( "Version", string( __VERSION ) );
 
@@ -297,7 +415,7 @@ void Checkpoint::dumpAll( VectorPatch &vecPatches, Region &region, unsigned int
         ostringstream patch_name( "" );
         patch_name << setfill( '0' ) << setw( 6 ) << vecPatches( ipatch )->Hindex();
         string patchName=Tools::merge( "patch-", patch_name.str() );
-        H5Write g = f.group( patchName.c_str() );
+        W g = f.group( patchName.c_str() );
 
         dumpPatch( vecPatches( ipatch ), params, g );
 
@@ -311,7 +429,7 @@ void Checkpoint::dumpAll( VectorPatch &vecPatches, Region &region, unsigned int
         ostringstream patch_name( "" );
         patch_name << setfill( '0' ) << setw( 6 ) << region.patch_->Hindex();
         string patchName=Tools::merge( "region-", patch_name.str() );
-        H5Write g = f.group( patchName.c_str() );
+        W g = f.group( patchName.c_str() );
         dumpPatch( region.patch_, params, g );
     }
 
@@ -332,7 +450,8 @@ void Checkpoint::dumpAll( VectorPatch &vecPatches, Region &region, unsigned int
 }
 
 
-void Checkpoint::dumpPatch( Patch *patch, Params &params, H5Write &g )
+template<class W>
+void Checkpoint::dumpPatch( Patch *patch, Params &params, W &g )
 {
     ElectroMagn * EMfields = patch->EMfields;
     if (  params.geometry != "AMcylindrical" ) {
@@ -445,7 +564,7 @@ void Checkpoint::dumpPatch( Patch *patch, Params &params, H5Write &g )
     for( unsigned int idiag=0; idiag<EMfields->allFields_avg.size(); idiag++ ) {
         ostringstream group_name( "" );
         group_name << "FieldsForDiag" << idiag;
-        H5Write diag = g.group( group_name.str() );
+        W diag = g.group( group_name.str() );
 
         for( unsigned int ifield=0; ifield<EMfields->allFields_avg[idiag].size(); ifield++ ) {
             dumpFieldsPerProc( diag, EMfields->allFields_avg[idiag][ifield] );
@@ -458,7 +577,7 @@ void Checkpoint::dumpPatch( Patch *patch, Params &params, H5Write &g )
         if( nFields > 0 ) {
             ostringstream group_name( "" );
             group_name << "DataForProbes" << iprobe;
-            H5Write diag = g.group( group_name.str() );
+            W diag = g.group( group_name.str() );
             for( unsigned int ifield=0; ifield<nFields; ifield++ ) {
                 ostringstream field( "" );
                 field << "field" << ifield;
@@ -477,7 +596,7 @@ void Checkpoint::dumpPatch( Patch *patch, Params &params, H5Write &g )
                 ostringstream name( "" );
                 name << setfill( '0' ) << setw( 2 ) << bcId;
                 string groupName=Tools::merge( "EM_boundary-species-", name.str() );
-                H5Write b = g.group( groupName );
+                W b = g.group( groupName );
                 b.attr( "By_val", embc->By_val_ );
                 b.attr( "Bz_val", embc->Bz_val_ );
             } else if( dynamic_cast<ElectroMagnBC2D_SM *>( EMfields->emBoundCond[bcId] ) ) {
@@ -485,7 +604,7 @@ void Checkpoint::dumpPatch( Patch *patch, Params &params, H5Write &g )
                 ostringstream name( "" );
                 name << setfill( '0' ) << setw( 2 ) << bcId;
                 string groupName=Tools::merge( "EM_boundary-species-", name.str() );
-                H5Write b = g.group( groupName );
+                W b = g.group( groupName );
                 b.vect( "Bx_val", embc->B_val[0] );
                 b.vect( "By_val", embc->B_val[1] );
                 b.vect( "Bz_val", embc->B_val[2] );
@@ -494,7 +613,7 @@ void Checkpoint::dumpPatch( Patch *patch, Params &params, H5Write &g )
                 ostringstream name( "" );
                 name << setfill( '0' ) << setw( 2 ) << bcId;
                 string groupName=Tools::merge( "EM_boundary-species-", name.str() );
-                H5Write b = g.group( groupName );
+                W b = g.group( groupName );
                 if( embc->B_val[0] ) {
                     dumpFieldsPerProc( b, embc->B_val[0] );
                 }
@@ -517,7 +636,7 @@ void Checkpoint::dumpPatch( Patch *patch, Params &params, H5Write &g )
         ostringstream name( "" );
         name << setfill( '0' ) << setw( 2 ) << ispec;
         string groupName=Tools::merge( "species-", name.str(), "-", spec->name_ );
-        H5Write s = g.group( groupName );
+        W s = g.group( groupName );
 
         s.attr( "partCapacity", spec->getParticlesCapacity() );
         s.attr( "partSize", spec->getNbrOfParticles() );
@@ -527,6 +646,10 @@ void Checkpoint::dumpPatch( Patch *patch, Params &params, H5Write &g )
         s.attr( "nrj_mw_out", spec->nrj_mw_out );
         s.attr( "nrj_new_part", spec->nrj_new_part_ );
         s.attr( "radiatedEnergy", spec->nrj_radiated_ );
+        if( spec->subcycling_ > 1 ) {
+            s.attr( "nrj_subcycling", spec->nrj_subcycling_ );
+            s.attr( "subcycle_steps", spec->subcycle_steps_ );
+        }
 
         if( spec->getNbrOfParticles()>0 ) {
             dumpParticles( s, *spec->particles );
@@ -536,7 +659,7 @@ void Checkpoint::dumpPatch( Patch *patch, Params &params, H5Write &g )
         
         // Copy birth records that haven't been written yet
         if( spec->birth_records_ ) {
-            H5Write b = s.group( "birth_records" );
+            W b = s.group( "birth_records" );
             b.vect( "birth_time", spec->birth_records_->birth_time_ );
             dumpParticles( b, spec->birth_records_->p_ );
         }
@@ -947,6 +1070,11 @@ void Checkpoint::restartPatch( Patch *patch, Params &params, H5Read &g )
         s.attr( "nrj_mw_out", spec->nrj_mw_out );
         s.attr( "nrj_new_part", spec->nrj_new_part_ );
         s.attr( "radiatedEnergy", spec->nrj_radiated_ );
+        // The summed fields are not stored: the current subcycle ends with the fields summed after the restart
+        if( spec->subcycling_ > 1 && s.hasAttr( "subcycle_steps" ) ) {
+            s.attr( "nrj_subcycling", spec->nrj_subcycling_ );
+            s.attr( "subcycle_steps", spec->subcycle_steps_ );
+        }
 
         if( partSize>0 ) {
             restartParticles( s, *spec->particles );
@@ -1014,12 +1142,14 @@ void Checkpoint::restartPatch( Patch *patch, Params &params, H5Read &g )
     }
 }
 
-void Checkpoint::dumpFieldsPerProc( H5Write &g, Field *field )
+template<class W>
+void Checkpoint::dumpFieldsPerProc( W &g, Field *field )
 {
     g.vect( field->name, *field->data_, field->number_of_points_, H5T_NATIVE_DOUBLE );
 }
 
-void Checkpoint::dump_cFieldsPerProc( H5Write &g, Field *field )
+template<class W>
+void Checkpoint::dump_cFieldsPerProc( W &g, Field *field )
 {
     cField *cfield = static_cast<cField *>( field );
     g.vect( field->name, *cfield->cdata_, 2*field->number_of_points_, H5T_NATIVE_DOUBLE );
@@ -1036,7 +1166,8 @@ void Checkpoint::restart_cFieldsPerProc( H5Read &g, Field *field )
     g.vect( field->name, *cfield->cdata_, H5T_NATIVE_DOUBLE );
 }
 
-void Checkpoint::dumpParticles( H5Write& s, Particles &p )
+template<class W>
+void Checkpoint::dumpParticles( W& s, Particles &p )
 {
     for( unsigned int i=0; i<p.Position.size(); i++ ) {
         ostringstream my_name( "" );
@@ -1115,7 +1246,8 @@ void Checkpoint::restartParticles( H5Read& s, Particles &p )
     }
 }
 
-void Checkpoint::dumpMovingWindow( H5Write &f, SimWindow *simWin )
+template<class W>
+void Checkpoint::dumpMovingWindow( W &f, SimWindow *simWin )
 {
     f.attr( "x_moved", simWin->getXmoved() );
     f.attr( "n_moved", simWin->getNmoved() );
@@ -1132,8 +1264,8 @@ void Checkpoint::restartMovingWindow( H5Read &f, SimWindow *simWin )
     simWin->setNmoved( n_moved );
 
 }
-template <typename Tpml> //ElectroMagnBC2D_PML or ElectroMagnBC3D_PML
-void  Checkpoint::dump_PML(Tpml embc, H5Write &g ){
+template <typename Tpml, class W> //ElectroMagnBC2D_PML or ElectroMagnBC3D_PML
+void  Checkpoint::dump_PML(Tpml embc, W &g ){
     dumpFieldsPerProc( g, embc->Hx_ );
     dumpFieldsPerProc( g, embc->Hy_ );
     dumpFieldsPerProc( g, embc->Hz_ );
@@ -1147,7 +1279,8 @@ void  Checkpoint::dump_PML(Tpml embc, H5Write &g ){
     dumpFieldsPerProc( g, embc->Dy_ );
     dumpFieldsPerProc( g, embc->Dz_ );
 }
-void  Checkpoint::dump_PML( ElectroMagnBCAM_PML *embc, H5Write &g, unsigned int imode ){
+template <class W>
+void  Checkpoint::dump_PML( ElectroMagnBCAM_PML *embc, W &g, unsigned int imode ){
     dump_cFieldsPerProc( g, embc->Hl_[imode] );
     dump_cFieldsPerProc( g, embc->Hr_[imode] );
     dump_cFieldsPerProc( g, embc->Ht_[imode] );
@@ -1161,8 +1294,8 @@ void  Checkpoint::dump_PML( ElectroMagnBCAM_PML *embc, H5Write &g, unsigned int
     dump_cFieldsPerProc( g, embc->Dr_[imode] );
     dump_cFieldsPerProc( g, embc->Dt_[imode] );
 }
-template <typename Tpml> //EnvelopBC2D_PML or EnvelopeBC3D_PML
-void  Checkpoint::dump_PMLenvelope(Tpml envbc, H5Write &g, unsigned int bcId ){
+template <typename Tpml, class W> //EnvelopBC2D_PML or EnvelopeBC3D_PML
+void  Checkpoint::dump_PMLenvelope(Tpml envbc, W &g, unsigned int bcId ){
     dumpFieldsPerProc( g, envbc->Chi_ );
     dump_cFieldsPerProc( g, envbc->A_n_ );
     dump_cFieldsPerProc( g, envbc->A_nm1_ );
@@ -1181,7 +1314,8 @@ void  Checkpoint::dump_PMLenvelope(Tpml envbc, H5Write &g, unsigned int bcId ){
         dump_cFieldsPerProc( g, envbc3d->u3_nm1_z_ );
     }
 }
-void  Checkpoint::dump_PMLenvelopeAM(EnvelopeBCAM_PML *envbc, H5Write &g, unsigned int bcId ){
+template <class W>
+void  Checkpoint::dump_PMLenvelopeAM(EnvelopeBCAM_PML *envbc, W &g, unsigned int bcId ){
     dumpFieldsPerProc( g, envbc->Chi_ );
     dump_cFieldsPerProc( g, envbc->A_n_ );
     dump_cFieldsPerProc( g, envbc->A_nm1_ );
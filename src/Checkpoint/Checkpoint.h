@@ -9,6 +9,8 @@
 
 #include <string>
 #include <vector>
+#include <thread>
+#include <atomic>
 
 #include <hdf5.h>
 #include <Tools.h>
@@ -16,6 +18,7 @@
 #include <H5.h>
 #include "ElectroMagnBCAM_PML.h"
 #include "EnvelopeBCAM_PML.h"
+#include "CheckpointStaging.h"
 
 class Params;
 class OpenPMDparams;
@@ -29,6 +32,7 @@ class Species;
 class VectorPatch;
 class Region;
 class Collisions;
+class Timers;
 
 #include <csignal>
 
@@ -53,12 +57,16 @@ public:
     
     //! test before writing everything to file per processor
     //bool dump(unsigned int itime, double time, Params &params);
-    void dump( VectorPatch &vecPatches, Region &region, unsigned int itime, SmileiMPI *smpi, SimWindow *simWindow, Params &params );
+    void dump( VectorPatch &vecPatches, Region &region, unsigned int itime, SmileiMPI *smpi, SimWindow *simWindow, Params &params, Timers &timers );
     // OK
     
     //! dump everything to file per processor
     void dumpAll( VectorPatch &vecPatches, Region &region, unsigned int itime,  SmileiMPI *smpi, SimWindow *simWin, Params &params );
-    void dumpPatch( Patch *patch, Params &params, H5Write &g );
+    template<class W>
+    void dumpPatch( Patch *patch, Params &params, W &g );
+    
+    //! wait for the background writing of the last asynchronous checkpoint
+    void waitAsynchronousDump( Timers &timers );
     
     //! incremental number of times we've done a dump
     unsigned int dump_number;
@@ -93,23 +101,50 @@ public:
     //! exit once dump done
     bool exit_after_dump;
     
+    //! checkpoint files are written by a background thread from a host copy
+    bool asynchronous;
+    
 private:
 
     //! initialize the time zero of the simulation
     void initDumpCases();
     
+    //! dump the content of the file of this processor, in a H5Write or a CheckpointStaging::Group
+    template<class W>
+    void dumpFile( W &f, VectorPatch &vecPatches, Region &region, unsigned int itime,  SmileiMPI *smpi, SimWindow *simWin, Params &params );
+    
     //! dump/restart field per proc
-    void dumpFieldsPerProc( H5Write &g, Field *field );
-    void dump_cFieldsPerProc( H5Write &g, Field *field );
+    template<class W>
+    void dumpFieldsPerProc( W &g, Field *field );
+    template<class W>
+    void dump_cFieldsPerProc( W &g, Field *field );
     void restartFieldsPerProc( H5Read &g, Field *field );
     void restart_cFieldsPerProc( H5Read &g, Field *field );
     //! dump/restart a particles object
-    void dumpParticles( H5Write& s, Particles &p );
+    template<class W>
+    void dumpParticles( W& s, Particles &p );
     void restartParticles( H5Read& s, Particles &p );
     //! dump/restart moving window parameters
-    void dumpMovingWindow( H5Write &f, SimWindow *simWindow );
+    template<class W>
+    void dumpMovingWindow( W &f, SimWindow *simWindow );
     void restartMovingWindow( H5Read &f, SimWindow *simWindow );
     
+    //! Host copies of the checkpoint files: one is filled while the other is being written
+    CheckpointStaging staging_[2];
+    unsigned int current_staging_;
+    
+    //! Maximum size of a staged checkpoint in bytes (0 = no limit)
+    double max_staging_memory_;
+    
+    //! Background thread writing a staged checkpoint
+    std::thread writer_;
+    
+    //! Time spent writing staged checkpoints in the background
+    std::atomic<double> io_time_;
+    
+    //! Write a staged checkpoint (run by the background thread)
+    void writeStaging( unsigned int istaging, std::string dumpName );
+    
     //! to dump and stop a simulation you might just check if a file named stop has been created this variable
     //! is true if since last time a file named stop appeared
     bool stop_file_seen_since_last_check;
@@ -134,12 +169,14 @@ private:
     std::string restart_file;
     
     //! dump PML in the checkpoint file 
-    template <typename Tpml>
-    void  dump_PML(Tpml embc, H5Write &g );
-    void  dump_PML( ElectroMagnBCAM_PML *embc, H5Write &g, unsigned int imode );
-    template <typename Tpml>
-    void  dump_PMLenvelope(Tpml envbc, H5Write &g, unsigned int bcId );
-    void  dump_PMLenvelopeAM(EnvelopeBCAM_PML *envbc, H5Write &g, unsigned int bcId );
+    template <typename Tpml, class W>
+    void  dump_PML(Tpml embc, W &g );
+    template <class W>
+    void  dump_PML( ElectroMagnBCAM_PML *embc, W &g, unsigned int imode );
+    template <typename Tpml, class W>
+    void  dump_PMLenvelope(Tpml envbc, W &g, unsigned int bcId );
+    template <class W>
+    void  dump_PMLenvelopeAM(EnvelopeBCAM_PML *envbc, W &g, unsigned int bcId );
     template <typename Tpml>
     void  restart_PML(Tpml embc, H5Read &g );
     void  restart_PML( ElectroMagnBCAM_PML *embc, H5Read &g, unsigned int imode );
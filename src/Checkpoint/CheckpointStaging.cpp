@@ -0,0 +1,61 @@
+#include "CheckpointStaging.h"
+
+#include "H5.h"
+
+using namespace std;
+
+int CheckpointStaging::addItem( int kind, int parent, std::string name, hid_t type, hsize_t count, const void *data, size_t bytes )
+{
+    // Keep every item aligned on 8 bytes
+    size_t ndoubles = ( bytes + sizeof( double ) - 1 ) / sizeof( double );
+    if( count_only_ ) {
+        arena_size_ += ndoubles*sizeof( double );
+        return -1;
+    }
+
+    Item item;
+    item.kind = kind;
+    item.parent = parent;
+    item.name = name;
+    item.type = type;
+    item.count = count;
+    item.offset = arena_size_;
+
+    if( arena_size_ + ndoubles*sizeof( double ) > arena_.size()*sizeof( double ) ) {
+        arena_.resize( max( 2*arena_.size(), arena_size_/sizeof( double ) + ndoubles ) );
+    }
+    if( bytes > 0 ) {
+        memcpy( reinterpret_cast<char *>( arena_.data() ) + arena_size_, data, bytes );
+    }
+    arena_size_ += ndoubles*sizeof( double );
+
+    items_.push_back( item );
+    return items_.size() - 1;
+}
+
+void CheckpointStaging::write( std::string filename )
+{
+    H5Write f( filename );
+
+    // Groups are opened in recording order, and closed once the file is complete
+    std::vector<H5Write *> groups( items_.size(), NULL );
+    char empty = 0;
+    for( unsigned int i=0; i<items_.size(); i++ ) {
+        Item &item = items_[i];
+        H5Write *loc = item.parent < 0 ? &f : groups[item.parent];
+        char &data = item.count > 0 ? reinterpret_cast<char *>( arena_.data() )[item.offset] : empty;
+        if( item.kind == group_kind ) {
+            groups[i] = new H5Write( loc, item.name );
+        } else if( item.kind == attr_kind ) {
+            loc->attr( item.name, data, item.type );
+        } else if( item.kind == string_attr_kind ) {
+            loc->attr( item.name, string( &data, item.count ) );
+        } else {
+            loc->vect( item.name, data, item.count, item.type );
+        }
+    }
+
+    for( int i=groups.size()-1; i>=0; i-- ) {
+        delete groups[i];
+    }
+}
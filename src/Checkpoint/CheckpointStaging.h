@@ -0,0 +1,179 @@
+/*
+ * CheckpointStaging.h
+ *
+ * Host copy of a checkpoint file, used by the asynchronous checkpoints:
+ * the main loop records the groups, attributes and datasets of the file
+ * in a memory arena, and a background thread writes them afterwards.
+ */
+
+#ifndef CHECKPOINTSTAGING_H
+#define CHECKPOINTSTAGING_H
+
+#include <string>
+#include <vector>
+#include <cstring>
+
+#include <hdf5.h>
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class CheckpointStaging
+//  --------------------------------------------------------------------------------------------------------------------
+class CheckpointStaging
+{
+public:
+    //! When count_only, nothing is recorded: only the size that the staged file would take is computed
+    CheckpointStaging( bool count_only = false ) : count_only_( count_only ) {};
+    ~CheckpointStaging() {};
+
+    //! Handle on a group of the staged file.
+    //! Mimics the subset of H5Write used by the Checkpoint class.
+    class Group
+    {
+    public:
+        Group( CheckpointStaging *staging, int id ) : staging_( staging ), id_( id ) {};
+
+        //! Make a group
+        Group group( std::string group_name )
+        {
+            return Group( staging_, staging_->addItem( group_kind, id_, group_name, -1, 0, NULL, 0 ) );
+        }
+
+        //! Record a string attribute
+        void attr( std::string attribute_name, std::string attribute_value )
+        {
+            staging_->addItem( string_attr_kind, id_, attribute_name, -1, attribute_value.size(), attribute_value.c_str(), attribute_value.size() );
+        }
+        void attr( std::string attribute_name, unsigned int attribute_value )
+        {
+            attr( attribute_name, attribute_value, H5T_NATIVE_UINT );
+        }
+        void attr( std::string attribute_name, unsigned long int attribute_value )
+        {
+            attr( attribute_name, attribute_value, H5T_NATIVE_ULONG );
+        }
+        void attr( std::string attribute_name, int attribute_value )
+        {
+            attr( attribute_name, attribute_value, H5T_NATIVE_INT );
+        }
+        void attr( std::string attribute_name, double attribute_value )
+        {
+            attr( attribute_name, attribute_value, H5T_NATIVE_DOUBLE );
+        }
+        //! Record any scalar attribute
+        template<class T>
+        void attr( std::string attribute_name, T &attribute_value, hid_t type )
+        {
+            staging_->addItem( attr_kind, id_, attribute_name, type, 1, &attribute_value, sizeof( T ) );
+        }
+
+        //! Record a dataset from a vector
+        void vect( std::string name, std::vector<int> &v )
+        {
+            vect( name, v, H5T_NATIVE_INT );
+        }
+        void vect( std::string name, std::vector<unsigned int> &v )
+        {
+            vect( name, v, H5T_NATIVE_UINT );
+        }
+        void vect( std::string name, std::vector<short> &v )
+        {
+            vect( name, v, H5T_NATIVE_SHORT );
+        }
+        void vect( std::string name, std::vector<double> &v )
+        {
+            vect( name, v, H5T_NATIVE_DOUBLE );
+        }
+        template<class T>
+        void vect( std::string name, std::vector<T> &v, hid_t type )
+        {
+            staging_->addItem( vect_kind, id_, name, type, v.size(), v.data(), v.size()*sizeof( T ) );
+        }
+        //! Record a dataset from a contiguous array
+        template<class T>
+        void vect( std::string name, T &v, int size, hid_t type )
+        {
+            staging_->addItem( vect_kind, id_, name, type, size, &v, size*sizeof( T ) );
+        }
+
+        //! Nothing to flush before the file is written
+        void flush() {};
+
+    private:
+        CheckpointStaging *staging_;
+        int id_;
+    };
+
+    //! Root group of the staged file
+    Group root()
+    {
+        return Group( this, -1 );
+    }
+
+    //! Forget the recorded items, keeping the memory for the next checkpoint
+    void clear()
+    {
+        items_.clear();
+        arena_size_ = 0;
+    }
+
+    //! Frees the memory of the arena
+    void release()
+    {
+        clear();
+        std::vector<double>().swap( arena_ );
+    }
+
+    //! Allocates the arena for a staged file of the given number of bytes, so that it does not grow while staging
+    void reserve( size_t bytes )
+    {
+        if( arena_.size()*sizeof( double ) < bytes ) {
+            arena_.resize( ( bytes + sizeof( double ) - 1 ) / sizeof( double ) );
+        }
+    }
+
+    //! Number of bytes currently staged
+    size_t size()
+    {
+        return arena_size_;
+    }
+
+    //! Number of bytes allocated for the arena
+    size_t capacity()
+    {
+        return arena_.capacity()*sizeof( double );
+    }
+
+    //! Write the staged content in a new HDF5 file (not thread-safe regarding other HDF5 calls)
+    void write( std::string filename );
+
+private:
+
+    static const int group_kind = 0;
+    static const int attr_kind = 1;
+    static const int string_attr_kind = 2;
+    static const int vect_kind = 3;
+
+    struct Item {
+        int kind;
+        int parent;
+        std::string name;
+        hid_t type;
+        hsize_t count;
+        size_t offset;
+    };
+
+    //! Append an item and copy its data in the arena, returns its index
+    int addItem( int kind, int parent, std::string name, hid_t type, hsize_t count, const void *data, size_t bytes );
+
+    //! Recorded groups, attributes and datasets, in order
+    std::vector<Item> items_;
+
+    //! Copy of all the data, 8-byte aligned for each item
+    std::vector<double> arena_;
+    size_t arena_size_ = 0;
+
+    //! Only the size is computed
+    bool count_only_;
+};
+
+#endif
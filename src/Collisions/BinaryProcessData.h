@@ -4,7 +4,8 @@
 #ifdef SMILEI_ACCELERATOR_GPU
 #define SMILEI_BINARYPROCESS_BUFFERSIZE 32
 #else
-#define SMILEI_BINARYPROCESS_BUFFERSIZE 8
+// On CPU, the buffers collect the pairs of several bins, so that the kernels loop over full vectors
+#define SMILEI_BINARYPROCESS_BUFFERSIZE 64
 #endif
 
 #define SMILEI_BINARYPROCESS_FLOAT float
@@ -60,8 +61,8 @@ struct BinaryProcessData
     //! Whether the first species is electron
     bool electronFirst;
     
-    //! Debye length
-    SMILEI_BINARYPROCESS_FLOAT debye;
+    //! Debye length (of the bin of each pair)
+    SMILEI_BINARYPROCESS_FLOAT debye[SMILEI_BINARYPROCESS_BUFFERSIZE];
     
     //! Thomas-Fermi length
     SMILEI_BINARYPROCESS_FLOAT lTF[SMILEI_BINARYPROCESS_BUFFERSIZE];
@@ -72,7 +73,8 @@ struct BinaryProcessData
     //! Which group of species may be the screened species
     uint32_t screening_group;
     
-    SMILEI_BINARYPROCESS_FLOAT n123, n223;
+    //! Densities to the power 2/3 (of the bin of each pair)
+    SMILEI_BINARYPROCESS_FLOAT n123[SMILEI_BINARYPROCESS_BUFFERSIZE], n223[SMILEI_BINARYPROCESS_BUFFERSIZE];
     
     //! Other buffers available for the binary processes
     SMILEI_BINARYPROCESS_FLOAT buffer1[SMILEI_BINARYPROCESS_BUFFERSIZE];
@@ -300,6 +300,10 @@ void BinaryProcesses::apply( Params &params, Patch *patch, int itime, vector<Dia
     Random rand( patch->rand_ );
     RandomShuffle shuffler( rand, 1 );
     patch->rand_->add( nbin );
+#ifndef SMILEI_ACCELERATOR_GPU
+    // Number of pairs waiting in the buffers
+    uint32_t npending = 0;
+#endif
     
     
     
@@ -398,10 +402,8 @@ void BinaryProcesses::apply( Params &params, Patch *patch, int itime, vector<Dia
             }
         }
         
-        // Set the debye length
-        if( BinaryProcesses::debye_length_required_ ) {
-            D.debye = sqrt( debye2_ptr[ibin] );
-        }
+        // Get the debye length
+        const SMILEI_BINARYPROCESS_FLOAT debye = BinaryProcesses::debye_length_required_ ? sqrt( debye2_ptr[ibin] ) : 0.;
         
         // Pre-calculate some numbers before the big loop
         const SMILEI_BINARYPROCESS_FLOAT inv_cell_volume = 1. / cellVolume( ibin );
@@ -409,8 +411,8 @@ void BinaryProcesses::apply( Params &params, Patch *patch, int itime, vector<Dia
         const SMILEI_BINARYPROCESS_FLOAT dt_corr = delta_t * ((SMILEI_BINARYPROCESS_FLOAT)ncorr) * inv_cell_volume;
         n1  *= inv_cell_volume;
         n2  *= inv_cell_volume;
-        D.n123 = cbrt( n1 * n1 );
-        D.n223 = cbrt( n2 * n2 );
+        const SMILEI_BINARYPROCESS_FLOAT n123 = cbrt( n1 * n1 );
+        const SMILEI_BINARYPROCESS_FLOAT n223 = cbrt( n2 * n2 );
         
         // Prepare buffers
         const uint32_t buffer_size = ( npairs_not_repeated < SMILEI_BINARYPROCESS_BUFFERSIZE ) ? npairs_not_repeated : SMILEI_BINARYPROCESS_BUFFERSIZE;
@@ -426,33 +428,45 @@ void BinaryProcesses::apply( Params &params, Patch *patch, int itime, vector<Dia
             const uint32_t start = ibuffer * buffer_size;
             const uint32_t n = ( npairs < start + buffer_size ) ? ( uint32_t ) ( npairs - start ) : buffer_size;
             
+#ifdef SMILEI_ACCELERATOR_GPU
+            const uint32_t o = 0;
+#else
+            // On CPU, the pairs of successive bins are appended in the buffers (at offset o).
+            // Two buffers of the same bin may share particles: they must not be processed together.
+            if( npending > 0 && ( ibuffer > 0 || npending + n > SMILEI_BINARYPROCESS_BUFFERSIZE ) ) {
+                processPairs( &rand, D, npending, weight1_ptr, weight2_ptr, charge1_ptr, charge2_ptr, px1_ptr, px2_ptr, py1_ptr, py2_ptr, pz1_ptr, pz2_ptr );
+                npending = 0;
+            }
+            const uint32_t o = npending;
+#endif
+            
             // Determine the shuffled indices in the whole groups of species
             if( intra_ ) {
-                shuffler.next( n, &D.i[0][0] );
-                shuffler.next( n, &D.i[1][0] );
+                shuffler.next( n, &D.i[0][o] );
+                shuffler.next( n, &D.i[1][o] );
             } else if( shuffle1 ) {
-                shuffler.next( n, &D.i[0][0] );
+                shuffler.next( n, &D.i[0][o] );
                 SMILEI_ACCELERATOR_LOOP_VECTOR
-                for( uint32_t i = 0; i<n; i++ ) {
-                    D.i[1][i] = ( i + start ) % npart2;
+                for( uint32_t i = o; i<o+n; i++ ) {
+                    D.i[1][i] = ( i - o + start ) % npart2;
                 }
             } else {
                 SMILEI_ACCELERATOR_LOOP_VECTOR
-                for( uint32_t i = 0; i<n; i++ ) {
-                    D.i[0][i] = ( i + start ) % npart1;
+                for( uint32_t i = o; i<o+n; i++ ) {
+                    D.i[0][i] = ( i - o + start ) % npart1;
                 }
-                shuffler.next( n, &D.i[1][0] );
+                shuffler.next( n, &D.i[1][o] );
             }
             
             // find species and indices of particles
             SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
+            for( uint32_t i = o; i<o+n; i++ ) {
                 for( D.ispec[0][i] = 0; D.i[0][i]>=np1[D.ispec[0][i]]; D.ispec[0][i]++ ) {
                     D.i[0][i] -= np1[D.ispec[0][i]];
                 }
             }
             SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
+            for( uint32_t i = o; i<o+n; i++ ) {
                 for( D.ispec[1][i] = 0; D.i[1][i]>=np2[D.ispec[1][i]]; D.ispec[1][i]++ ) {
                     D.i[1][i] -= np2[D.ispec[1][i]];
                 }
@@ -461,19 +475,19 @@ void BinaryProcesses::apply( Params &params, Patch *patch, int itime, vector<Dia
             // Get screening length & Z
             if( screening_group_ == 0 ) {
                 SMILEI_ACCELERATOR_LOOP_VECTOR
-                for( uint32_t i = 0; i<n; i++ ) { // = no screening
+                for( uint32_t i = o; i<o+n; i++ ) { // = no screening
                     D.lTF[i] = lTF_ptr[screening_group_size - 1];
                     D.Z1Z2[i] = screening_Z_ptr[screening_group_size - 1];
                 }
             } else if( screening_group_ == 1 ) {
                 SMILEI_ACCELERATOR_LOOP_VECTOR
-                for( uint32_t i = 0; i<n; i++ ) {
+                for( uint32_t i = o; i<o+n; i++ ) {
                     D.lTF[i] = lTF_ptr[D.ispec[0][i]];
                     D.Z1Z2[i] = screening_Z_ptr[D.ispec[0][i]];
                 }
             } else if( screening_group_ == 2 ) {
                 SMILEI_ACCELERATOR_LOOP_VECTOR
-                for( uint32_t i = 0; i<n; i++ ) {
+                for( uint32_t i = o; i<o+n; i++ ) {
                     D.lTF[i] = lTF_ptr[D.ispec[1][i]];
                     D.Z1Z2[i] = screening_Z_ptr[D.ispec[1][i]];
                 }
@@ -482,218 +496,112 @@ void BinaryProcesses::apply( Params &params, Patch *patch, int itime, vector<Dia
             // Get particle indices in this bin
             if( ibin > 0 ) {
                 SMILEI_ACCELERATOR_LOOP_VECTOR
-                for( uint32_t i = 0; i<n; i++ ) {
+                for( uint32_t i = o; i<o+n; i++ ) {
                     D.i[0][i] += last_index1_ptr[D.ispec[0][i]][ibin-1];
                 }
                 SMILEI_ACCELERATOR_LOOP_VECTOR
-                for( uint32_t i = 0; i<n; i++ ) {
+                for( uint32_t i = o; i<o+n; i++ ) {
                     D.i[1][i] += last_index2_ptr[D.ispec[1][i]][ibin-1];
                 }
             }
 #ifndef SMILEI_ACCELERATOR_GPU
             // Get pointers to Particles
             SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
+            for( uint32_t i = o; i<o+n; i++ ) {
                 D.p[0][i] = p1_ptr[D.ispec[0][i]];
             }
             SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
+            for( uint32_t i = o; i<o+n; i++ ) {
                 D.p[1][i] = p2_ptr[D.ispec[1][i]];
             }
 #endif
             // Get masses
             SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
+            for( uint32_t i = o; i<o+n; i++ ) {
                 D.m[0][i] = mass1[D.ispec[0][i]];
             }
             SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
+            for( uint32_t i = o; i<o+n; i++ ) {
                 D.m[1][i] = mass2[D.ispec[1][i]];
             }
             // Get Weights
             SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
+            for( uint32_t i = o; i<o+n; i++ ) {
                 D.W[0][i] = weight1_ptr[D.ispec[0][i]][D.i[0][i]];
             }
             SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
+            for( uint32_t i = o; i<o+n; i++ ) {
                 D.W[1][i] = weight2_ptr[D.ispec[1][i]][D.i[1][i]];
             }
             // Get charges
             SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
+            for( uint32_t i = o; i<o+n; i++ ) {
                 D.q[0][i] = charge1_ptr[D.ispec[0][i]][D.i[0][i]];
             }
             SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
+            for( uint32_t i = o; i<o+n; i++ ) {
                 D.q[1][i] = charge2_ptr[D.ispec[1][i]][D.i[1][i]];
             }
             // Get momenta
             SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
+            for( uint32_t i = o; i<o+n; i++ ) {
                 D.px[0][i] = px1_ptr[D.ispec[0][i]][D.i[0][i]];
             }
             SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
+            for( uint32_t i = o; i<o+n; i++ ) {
                 D.px[1][i] = px2_ptr[D.ispec[1][i]][D.i[1][i]];
             }
             SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
+            for( uint32_t i = o; i<o+n; i++ ) {
                 D.py[0][i] = py1_ptr[D.ispec[0][i]][D.i[0][i]];
             }
             SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
+            for( uint32_t i = o; i<o+n; i++ ) {
                 D.py[1][i] = py2_ptr[D.ispec[1][i]][D.i[1][i]];
             }
             SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
+            for( uint32_t i = o; i<o+n; i++ ) {
                 D.pz[0][i] = pz1_ptr[D.ispec[0][i]][D.i[0][i]];
             }
             SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
+            for( uint32_t i = o; i<o+n; i++ ) {
                 D.pz[1][i] = pz2_ptr[D.ispec[1][i]][D.i[1][i]];
             }
             
             // Calculate the timestep correction
             SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
+            for( uint32_t i = o; i<o+n; i++ ) {
                 D.dt_correction[i] = ( D.W[0][i] > D.W[1][i] ? D.W[0][i] : D.W[1][i] ) * dt_corr;
-                double corr2 = ( i + start ) % npairs_not_repeated < npairs % npairs_not_repeated;
+                double corr2 = ( i - o + start ) % npairs_not_repeated < npairs % npairs_not_repeated;
                 double corr1 = 1. - corr2;
                 D.dt_correction[i] *= corr1 * weight_correction_1 + corr2 * weight_correction_2;
             }
             
-            // Calculate gammas
+            // Bin-wise quantities
             SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
-                D.gamma[0][i] = sqrt( 1 + D.px[0][i]*D.px[0][i] + D.py[0][i]*D.py[0][i] + D.pz[0][i]*D.pz[0][i] );
-            }
-            SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
-                D.gamma[1][i] = sqrt( 1 + D.px[1][i]*D.px[1][i] + D.py[1][i]*D.py[1][i] + D.pz[1][i]*D.pz[1][i] );
+            for( uint32_t i = o; i<o+n; i++ ) {
+                D.debye[i] = debye;
+                D.n123[i] = n123;
+                D.n223[i] = n223;
             }
             
-            // Calculate the mass ratio
-            SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
-                D.R[i] = D.m[1][i] / D.m[0][i];
-            }
-            
-            // Calculate the total gamma
-            SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
-                D.gamma_tot[i] = D.gamma[0][i] + D.R[i] * D.gamma[1][i];
-            }
-            
-            // Calculate the total momentum
-            SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
-                D.px_tot[i] = D.px[0][i] + D.R[i] * D.px[1][i];
-            }
-            SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
-                D.py_tot[i] = D.py[0][i] + D.R[i] * D.py[1][i];
-            }
-            SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
-                D.pz_tot[i] = D.pz[0][i] + D.R[i] * D.pz[1][i];
-            }
-            
-            // Calculate the Lorentz invariant gamma1 gamma2 - u1.u2
-            // It is equal to the gamma of one particle in the rest frame of the other particle
-            SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
-                D.gamma0[i] = D.gamma[0][i] * D.gamma[1][i] - D.px[0][i] * D.px[1][i] - D.py[0][i] * D.py[1][i] - D.pz[0][i] * D.pz[1][i];
-            }
-            
-            // Now we calculate quantities in the center-of-mass frame
-            // denoted by the suffix _COM
-            SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
-                D.gamma_tot_COM[i] = sqrt( 2*D.R[i]*D.gamma0[i] + D.R[i] * D.R[i] + 1 );
-                D.gamma_COM0[i] = ( D.R[i] * D.gamma0[i] + 1 ) / D.gamma_tot_COM[i];
-            }
-            
-            SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
-                SMILEI_BINARYPROCESS_FLOAT gg = ( D.gamma[0][i] + D.gamma_COM0[i] ) / ( D.gamma_tot[i] + D.gamma_tot_COM[i] );
-                D.px_COM[i] = D.px[0][i] - gg * D.px_tot[i];
-                D.py_COM[i] = D.py[0][i] - gg * D.py_tot[i];
-                D.pz_COM[i] = D.pz[0][i] - gg * D.pz_tot[i];
-                D.p_COM[i] = sqrt( D.px_COM[i]*D.px_COM[i] + D.py_COM[i]*D.py_COM[i] + D.pz_COM[i]*D.pz_COM[i] );
-            }
-            
-            // Calculate some intermediate quantities
-            SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
-                SMILEI_BINARYPROCESS_FLOAT p_gamma_COM = D.p_COM[i] * D.gamma_tot_COM[i];
-                D.vrel[i] = p_gamma_COM / ( D.gamma_COM0[i] * ( D.gamma_tot_COM[i] - D.gamma_COM0[i] ) ); // | v2_COM - v1_COM |
-            }
-            
-            // Apply all processes (collisions, ionization, ...)
-            #ifndef SMILEI_ACCELERATOR_GPU
-            if( nuclear_reactions_ ) {
-                nuclear_reactions_->apply( &rand, D, n );
-            }
-            #endif
-            if( collisions_ ) {
-                collisions_.apply( &rand, D, n );
-            }
-            #ifndef SMILEI_ACCELERATOR_GPU
-            if( collisional_ionization_ ) {
-                collisional_ionization_->apply( &rand, D, n );
-            }
-            #endif
-            
-            // Update the particle arrays from the buffers
-            // Store Weights
-            SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
-                weight1_ptr[D.ispec[0][i]][D.i[0][i]] = D.W[0][i];
-            }
-            SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
-                weight2_ptr[D.ispec[1][i]][D.i[1][i]] = D.W[1][i];
-            }
-            // Store charges
-            SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
-                charge1_ptr[D.ispec[0][i]][D.i[0][i]] = D.q[0][i];
-            }
-            SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
-                charge2_ptr[D.ispec[1][i]][D.i[1][i]] = D.q[1][i];
-            }
-            // Store momenta
-            SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
-                px1_ptr[D.ispec[0][i]][D.i[0][i]] = D.px[0][i];
-            }
-            SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
-                px2_ptr[D.ispec[1][i]][D.i[1][i]] = D.px[1][i];
-            }
-            SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
-                py1_ptr[D.ispec[0][i]][D.i[0][i]] = D.py[0][i];
-            }
-            SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
-                py2_ptr[D.ispec[1][i]][D.i[1][i]] = D.py[1][i];
-            }
-            SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
-                pz1_ptr[D.ispec[0][i]][D.i[0][i]] = D.pz[0][i];
-            }
-            SMILEI_ACCELERATOR_LOOP_VECTOR
-            for( uint32_t i = 0; i<n; i++ ) {
-                pz2_ptr[D.ispec[1][i]][D.i[1][i]] = D.pz[1][i];
-            }
+#ifdef SMILEI_ACCELERATOR_GPU
+            processPairs( &rand, D, n, weight1_ptr, weight2_ptr, charge1_ptr, charge2_ptr, px1_ptr, px2_ptr, py1_ptr, py2_ptr, pz1_ptr, pz2_ptr );
+#else
+            npending += n;
+#endif
             
         } // end loop on buffers of particles
         
     } // end loop on bins
     
+#ifndef SMILEI_ACCELERATOR_GPU
+    // Process the pairs left in the buffers
+    if( npending > 0 ) {
+        processPairs( &rand, D, npending, weight1_ptr, weight2_ptr, charge1_ptr, charge2_ptr, px1_ptr, px2_ptr, py1_ptr, py2_ptr, pz1_ptr, pz2_ptr );
+    }
+#endif
+    
     // The finishing touch on all processes
     if( nuclear_reactions_ ) {
         nuclear_reactions_->finish( params, patch, localDiags, intra_, species_group1_, species_group2_, itime );
@@ -707,6 +615,142 @@ void BinaryProcesses::apply( Params &params, Patch *patch, int itime, vector<Dia
 }
 
 
+void BinaryProcesses::processPairs( Random *rand, BinaryProcessData &D, uint32_t n,
+    double *__restrict__ *weight1_ptr, double *__restrict__ *weight2_ptr,
+    short *__restrict__ *charge1_ptr, short *__restrict__ *charge2_ptr,
+    double *__restrict__ *px1_ptr, double *__restrict__ *px2_ptr,
+    double *__restrict__ *py1_ptr, double *__restrict__ *py2_ptr,
+    double *__restrict__ *pz1_ptr, double *__restrict__ *pz2_ptr )
+{
+    // Calculate gammas
+    SMILEI_ACCELERATOR_LOOP_VECTOR
+    for( uint32_t i = 0; i<n; i++ ) {
+        D.gamma[0][i] = sqrt( 1 + D.px[0][i]*D.px[0][i] + D.py[0][i]*D.py[0][i] + D.pz[0][i]*D.pz[0][i] );
+    }
+    SMILEI_ACCELERATOR_LOOP_VECTOR
+    for( uint32_t i = 0; i<n; i++ ) {
+        D.gamma[1][i] = sqrt( 1 + D.px[1][i]*D.px[1][i] + D.py[1][i]*D.py[1][i] + D.pz[1][i]*D.pz[1][i] );
+    }
+    
+    // Calculate the mass ratio
+    SMILEI_ACCELERATOR_LOOP_VECTOR
+    for( uint32_t i = 0; i<n; i++ ) {
+        D.R[i] = D.m[1][i] / D.m[0][i];
+    }
+    
+    // Calculate the total gamma
+    SMILEI_ACCELERATOR_LOOP_VECTOR
+    for( uint32_t i = 0; i<n; i++ ) {
+        D.gamma_tot[i] = D.gamma[0][i] + D.R[i] * D.gamma[1][i];
+    }
+    
+    // Calculate the total momentum
+    SMILEI_ACCELERATOR_LOOP_VECTOR
+    for( uint32_t i = 0; i<n; i++ ) {
+        D.px_tot[i] = D.px[0][i] + D.R[i] * D.px[1][i];
+    }
+    SMILEI_ACCELERATOR_LOOP_VECTOR
+    for( uint32_t i = 0; i<n; i++ ) {
+        D.py_tot[i] = D.py[0][i] + D.R[i] * D.py[1][i];
+    }
+    SMILEI_ACCELERATOR_LOOP_VECTOR
+    for( uint32_t i = 0; i<n; i++ ) {
+        D.pz_tot[i] = D.pz[0][i] + D.R[i] * D.pz[1][i];
+    }
+    
+    // Calculate the Lorentz invariant gamma1 gamma2 - u1.u2
+    // It is equal to the gamma of one particle in the rest frame of the other particle
+    SMILEI_ACCELERATOR_LOOP_VECTOR
+    for( uint32_t i = 0; i<n; i++ ) {
+        D.gamma0[i] = D.gamma[0][i] * D.gamma[1][i] - D.px[0][i] * D.px[1][i] - D.py[0][i] * D.py[1][i] - D.pz[0][i] * D.pz[1][i];
+    }
+    
+    // Now we calculate quantities in the center-of-mass frame
+    // denoted by the suffix _COM
+    SMILEI_ACCELERATOR_LOOP_VECTOR
+    for( uint32_t i = 0; i<n; i++ ) {
+        D.gamma_tot_COM[i] = sqrt( 2*D.R[i]*D.gamma0[i] + D.R[i] * D.R[i] + 1 );
+        D.gamma_COM0[i] = ( D.R[i] * D.gamma0[i] + 1 ) / D.gamma_tot_COM[i];
+    }
+    
+    SMILEI_ACCELERATOR_LOOP_VECTOR
+    for( uint32_t i = 0; i<n; i++ ) {
+        SMILEI_BINARYPROCESS_FLOAT gg = ( D.gamma[0][i] + D.gamma_COM0[i] ) / ( D.gamma_tot[i] + D.gamma_tot_COM[i] );
+        D.px_COM[i] = D.px[0][i] - gg * D.px_tot[i];
+        D.py_COM[i] = D.py[0][i] - gg * D.py_tot[i];
+        D.pz_COM[i] = D.pz[0][i] - gg * D.pz_tot[i];
+        D.p_COM[i] = sqrt( D.px_COM[i]*D.px_COM[i] + D.py_COM[i]*D.py_COM[i] + D.pz_COM[i]*D.pz_COM[i] );
+    }
+    
+    // Calculate some intermediate quantities
+    SMILEI_ACCELERATOR_LOOP_VECTOR
+    for( uint32_t i = 0; i<n; i++ ) {
+        SMILEI_BINARYPROCESS_FLOAT p_gamma_COM = D.p_COM[i] * D.gamma_tot_COM[i];
+        D.vrel[i] = p_gamma_COM / ( D.gamma_COM0[i] * ( D.gamma_tot_COM[i] - D.gamma_COM0[i] ) ); // | v2_COM - v1_COM |
+    }
+    
+    // Apply all processes (collisions, ionization, ...)
+    #ifndef SMILEI_ACCELERATOR_GPU
+    if( nuclear_reactions_ ) {
+        nuclear_reactions_->apply( rand, D, n );
+    }
+    #endif
+    if( collisions_ ) {
+        collisions_.apply( rand, D, n );
+    }
+    #ifndef SMILEI_ACCELERATOR_GPU
+    if( collisional_ionization_ ) {
+        collisional_ionization_->apply( rand, D, n );
+    }
+    #endif
+    
+    // Update the particle arrays from the buffers
+    // Store Weights
+    SMILEI_ACCELERATOR_LOOP_VECTOR
+    for( uint32_t i = 0; i<n; i++ ) {
+        weight1_ptr[D.ispec[0][i]][D.i[0][i]] = D.W[0][i];
+    }
+    SMILEI_ACCELERATOR_LOOP_VECTOR
+    for( uint32_t i = 0; i<n; i++ ) {
+        weight2_ptr[D.ispec[1][i]][D.i[1][i]] = D.W[1][i];
+    }
+    // Store charges
+    SMILEI_ACCELERATOR_LOOP_VECTOR
+    for( uint32_t i = 0; i<n; i++ ) {
+        charge1_ptr[D.ispec[0][i]][D.i[0][i]] = D.q[0][i];
+    }
+    SMILEI_ACCELERATOR_LOOP_VECTOR
+    for( uint32_t i = 0; i<n; i++ ) {
+        charge2_ptr[D.ispec[1][i]][D.i[1][i]] = D.q[1][i];
+    }
+    // Store momenta
+    SMILEI_ACCELERATOR_LOOP_VECTOR
+    for( uint32_t i = 0; i<n; i++ ) {
+        px1_ptr[D.ispec[0][i]][D.i[0][i]] = D.px[0][i];
+    }
+    SMILEI_ACCELERATOR_LOOP_VECTOR
+    for( uint32_t i = 0; i<n; i++ ) {
+        px2_ptr[D.ispec[1][i]][D.i[1][i]] = D.px[1][i];
+    }
+    SMILEI_ACCELERATOR_LOOP_VECTOR
+    for( uint32_t i = 0; i<n; i++ ) {
+        py1_ptr[D.ispec[0][i]][D.i[0][i]] = D.py[0][i];
+    }
+    SMILEI_ACCELERATOR_LOOP_VECTOR
+    for( uint32_t i = 0; i<n; i++ ) {
+        py2_ptr[D.ispec[1][i]][D.i[1][i]] = D.py[1][i];
+    }
+    SMILEI_ACCELERATOR_LOOP_VECTOR
+    for( uint32_t i = 0; i<n; i++ ) {
+        pz1_ptr[D.ispec[0][i]][D.i[0][i]] = D.pz[0][i];
+    }
+    SMILEI_ACCELERATOR_LOOP_VECTOR
+    for( uint32_t i = 0; i<n; i++ ) {
+        pz2_ptr[D.ispec[1][i]][D.i[1][i]] = D.pz[1][i];
+    }
+}
+
+
 void BinaryProcesses::debug( Params &params, int itime, unsigned int icoll, VectorPatch &vecPatches )
 {
 
@@ -157,7 +157,19 @@ private:
     
     //! Debugging file name
     std::string filename_;
-    
+
+    //! Compute the kinematics of the n pairs gathered in the buffers, apply the processes,
+    //! and store the results back in the particle arrays
+    #ifdef SMILEI_ACCELERATOR_GPU_OACC
+    #pragma acc routine vector
+    #endif
+    void processPairs( Random *rand, BinaryProcessData &D, uint32_t n,
+        double *__restrict__ *weight1_ptr, double *__restrict__ *weight2_ptr,
+        short *__restrict__ *charge1_ptr, short *__restrict__ *charge2_ptr,
+        double *__restrict__ *px1_ptr, double *__restrict__ *px2_ptr,
+        double *__restrict__ *py1_ptr, double *__restrict__ *py2_ptr,
+        double *__restrict__ *pz1_ptr, double *__restrict__ *pz2_ptr );
+
 };
 
 #endif
@@ -73,7 +73,7 @@ public:
                     b1 = -b1;
                 }
                 bmin[i] = coeff1_ * ( D.buffer1[i] > b1 ? D.buffer1[i] : b1 );
-                lnLD[i] = D.debye > 7.839*bmin[i] ? log( D.debye / bmin[i] ) : 2.;
+                lnLD[i] = D.debye[i] > 7.839*bmin[i] ? log( D.debye[i] / bmin[i] ) : 2.;
             }
             
             // If no Thomas-Fermi screening
@@ -98,7 +98,7 @@ public:
                     // For e-i collisions, consider the bound-electron screening
                     if( D.lTF[i] > 0. ) {
                         SMILEI_BINARYPROCESS_FLOAT ZZZZ = D.Z1Z2[i] * D.Z1Z2[i];
-                        if( D.debye > D.lTF[i] ) {
+                        if( D.debye[i] > D.lTF[i] ) {
                             // Bound-electron (Thomas-Fermi) screening
                             SMILEI_BINARYPROCESS_FLOAT lnLTF = D.lTF[i] > 7.839*bmin[i] ? log( D.lTF[i] / bmin[i] ) : 2.;
                             // Total screening
@@ -137,7 +137,7 @@ public:
         // Low-temperature correction to s
         SMILEI_ACCELERATOR_LOOP_VECTOR
         for( uint32_t i = 0; i<n; i++ ) {
-            SMILEI_BINARYPROCESS_FLOAT n = D.n123 > D.R[i] * D.n223 ? D.n123 : D.R[i] * D.n223;
+            SMILEI_BINARYPROCESS_FLOAT n = D.n123[i] > D.R[i] * D.n223[i] ? D.n123[i] : D.R[i] * D.n223[i];
             SMILEI_BINARYPROCESS_FLOAT smax = coeff4_ * ( 1 + D.R[i] ) * D.vrel[i] / n;
             
             SMILEI_BINARYPROCESS_FLOAT &s = D.buffer5[i];
@@ -6,6 +6,7 @@
 #include "Timers.h"
 
 #include "OpenPMDparams.h"
+#include "DiagnosticWriter.h"
 
 class SmileiMPI;
 class VectorPatch;
@@ -16,8 +17,8 @@ class Diagnostic
 
 public :
 
-    Diagnostic( ) : file_ ( NULL ), openPMD_( NULL ) {};
-    Diagnostic( OpenPMDparams *o, std::string diag_type, int idiag ) : file_ ( NULL ), openPMD_( o ) {
+    Diagnostic( ) : asynchronous_( false ), file_ ( NULL ), openPMD_( NULL ), last_output_( 0 ) {};
+    Diagnostic( OpenPMDparams *o, std::string diag_type, int idiag ) : asynchronous_( false ), file_ ( NULL ), openPMD_( o ), last_output_( 0 ) {
         PyTools::extract( "name", diag_name_, diag_type, idiag );
     };
     virtual ~Diagnostic() {
@@ -72,6 +73,9 @@ public :
     
     bool theTimeIsNow_;
     
+    //! True if the HDF5 writes are made by the DiagnosticWriter thread
+    bool asynchronous_;
+    
     std::string name() {
         return diag_name_;
     };
@@ -86,6 +90,22 @@ protected :
     
     //! Label of the diagnostic (for post-processing)
     std::string diag_name_;
+    
+    //! Extract the `asynchronous` parameter, if the HDF5 library and MPI allow it
+    void extractAsynchronous( std::string diag_type, int idiag )
+    {
+        PyTools::extract( "asynchronous", asynchronous_, diag_type, idiag );
+        if( asynchronous_ && ! DiagnosticWriter::available() ) {
+            WARNING( diag_type << " #" << idiag << ": option `asynchronous` ignored because the HDF5 library is not thread-safe (parallel HDF5 builds rarely are) or MPI does not provide MPI_THREAD_MULTIPLE: written synchronously" );
+            asynchronous_ = false;
+        }
+    };
+    
+    //! Output being prepared for the DiagnosticWriter
+    DiagnosticWriter::Job job_;
+    
+    //! Ticket of the last output given to the DiagnosticWriter
+    uint64_t last_output_;
 };
 
 #endif
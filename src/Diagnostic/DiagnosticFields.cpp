@@ -174,6 +174,9 @@ DiagnosticFields::DiagnosticFields( Params &params, SmileiMPI *smpi, VectorPatch
     // Extract the flush time selection
     flush_timeSelection = new TimeSelection( PyTools::extract_py( "flush_every", "DiagFields", ndiag ), "DiagFields flush_every" );
     
+    // Write in the background thread if requested
+    extractAsynchronous( "DiagFields", ndiag );
+    
     // Extract the datatype
     string datatype = "";
     PyTools::extract( "datatype", datatype, "DiagFields", ndiag );
@@ -294,6 +297,11 @@ void DiagnosticFields::run( SmileiMPI *smpi, VectorPatch &vecPatches, int itime,
     
     #pragma omp master
     {
+        // The previous output must be written before the file structure is modified
+        if( asynchronous_ ) {
+            DiagnosticWriter::instance().wait( last_output_ );
+        }
+        
         // Calculate the structure of the file depending on 1D, 2D, ...
         refHindex = ( unsigned int )( vecPatches.refHindex_ );
         setFileSplitting( smpi, vecPatches );
@@ -304,11 +312,12 @@ void DiagnosticFields::run( SmileiMPI *smpi, VectorPatch &vecPatches, int itime,
         name_t << itime;
         status = data_group_->has( name_t.str() );
         if( ! status ) {
-            iteration_group_ = new H5Write( data_group_, name_t.str() );
-            // Add openPMD attributes ( "basePath" )
-            openPMD_->writeBasePathAttributes( *iteration_group_, itime );
-            // Add openPMD attributes ( "meshesPath" )
-            openPMD_->writeMeshesAttributes( *iteration_group_ );
+            string name = name_t.str();
+            if( asynchronous_ ) {
+                job_.add( [this, name, itime]() { createIterationGroup( name, itime ); } );
+            } else {
+                createIterationGroup( name, itime );
+            }
         }
     }
     #pragma omp barrier
@@ -332,8 +341,6 @@ void DiagnosticFields::run( SmileiMPI *smpi, VectorPatch &vecPatches, int itime,
         
         #pragma omp master
         {
-            // Write
-            H5Write dset = writeField( iteration_group_, fields_names[ifield] );
             // Attributes for openPMD
             Field *f = vecPatches( 0 )->EMfields->allFields[fields_indexes[ifield]];
             vector<double> stagger( f->dims().size() );
@@ -342,10 +349,19 @@ void DiagnosticFields::run( SmileiMPI *smpi, VectorPatch &vecPatches, int itime,
             }
             bool ends_with_m = 0 == fields_names[ifield].compare( fields_names[ifield].length()-2, 2, "_m" );
             double stagger_t = ends_with_m ? vecPatches( 0 )->EMfields->timestep*0.5 : 0.;
-            openPMD_->writeFieldAttributes( dset, subgrid_start_, subgrid_step_ );
-            openPMD_->writeRecordAttributes( dset, field_type[ifield], stagger_t );
-            openPMD_->writeFieldRecordAttributes( dset, stagger );
-            openPMD_->writeComponentAttributes( dset, field_type[ifield] );
+            // Write
+            if( asynchronous_ ) {
+                size_t size;
+                double *buffer = outputBuffer( size );
+                double *copy = job_.copy( buffer, size );
+                job_.add( [this, ifield, copy, stagger, stagger_t]() {
+                    H5Write dset = writeBuffer( iteration_group_, fields_names[ifield], *copy );
+                    writeFieldAttributes( dset, ifield, stagger, stagger_t );
+                } );
+            } else {
+                H5Write dset = writeField( iteration_group_, fields_names[ifield] );
+                writeFieldAttributes( dset, ifield, stagger, stagger_t );
+            }
         }
         #pragma omp barrier 
     }
@@ -355,15 +371,47 @@ void DiagnosticFields::run( SmileiMPI *smpi, VectorPatch &vecPatches, int itime,
         
         // write x_moved
         double x_moved = simWindow ? simWindow->getXmoved() : 0.;
-        iteration_group_->attr( "x_moved", x_moved );
-        delete iteration_group_;
-        if( flush_timeSelection->theTimeIsNow( itime ) ) {
-            file_->flush();
+        bool flush = flush_timeSelection->theTimeIsNow( itime );
+        if( asynchronous_ ) {
+            job_.add( [this, x_moved, flush]() { closeIterationGroup( x_moved, flush ); } );
+            last_output_ = DiagnosticWriter::instance().push( job_ );
+            // Flushing also waits for the data to be written
+            if( flush ) {
+                DiagnosticWriter::instance().wait( last_output_ );
+            }
+        } else {
+            closeIterationGroup( x_moved, flush );
         }
     }
     #pragma omp barrier
 }
 
+void DiagnosticFields::createIterationGroup( string name, int itime )
+{
+    iteration_group_ = new H5Write( data_group_, name );
+    // Add openPMD attributes ( "basePath" )
+    openPMD_->writeBasePathAttributes( *iteration_group_, itime );
+    // Add openPMD attributes ( "meshesPath" )
+    openPMD_->writeMeshesAttributes( *iteration_group_ );
+}
+
+void DiagnosticFields::writeFieldAttributes( H5Write &dset, unsigned int ifield, vector<double> stagger, double stagger_t )
+{
+    openPMD_->writeFieldAttributes( dset, subgrid_start_, subgrid_step_ );
+    openPMD_->writeRecordAttributes( dset, field_type[ifield], stagger_t );
+    openPMD_->writeFieldRecordAttributes( dset, stagger );
+    openPMD_->writeComponentAttributes( dset, field_type[ifield] );
+}
+
+void DiagnosticFields::closeIterationGroup( double x_moved, bool flush )
+{
+    iteration_group_->attr( "x_moved", x_moved );
+    delete iteration_group_;
+    if( flush ) {
+        file_->flush();
+    }
+}
+
 bool DiagnosticFields::needsRhoJs( int itime )
 {
     
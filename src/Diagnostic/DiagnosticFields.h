@@ -25,6 +25,19 @@ public :
     
     virtual H5Write writeField( H5Write*, std::string ) = 0;
     
+    //! Write a copy of the output buffer (for asynchronous output)
+    H5Write writeBuffer( H5Write *loc, std::string name, double &buffer )
+    {
+        return loc->array( name, buffer, H5T_NATIVE_DOUBLE, filespace, memspace, false, file_datatype_ );
+    };
+    
+    //! Output buffer filled by getField, and its number of doubles
+    virtual double *outputBuffer( size_t &size )
+    {
+        size = data.size();
+        return data.data();
+    };
+    
     virtual bool needsRhoJs( int itime ) override;
     
     void findSubgridIntersection( unsigned int subgrid_start,
@@ -87,6 +100,15 @@ protected :
     //! Copy patch field to current "data" buffer
     virtual void getField( Patch *patch, unsigned int ) = 0;
     
+    //! Create the group of the current iteration and its openPMD attributes
+    void createIterationGroup( std::string name, int itime );
+    
+    //! Write the openPMD attributes of a field dataset
+    void writeFieldAttributes( H5Write &dset, unsigned int ifield, std::vector<double> stagger, double stagger_t );
+    
+    //! Write the last attributes of the current iteration and close its group
+    void closeIterationGroup( double x_moved, bool flush );
+    
     //! Variable to store the status of a dataset (whether it exists or not)
     bool status;
     
@@ -22,6 +22,15 @@ public:
     
     H5Write writeField( H5Write*, std::string ) override;
     template<typename F> H5Write writeField( H5Write*, std::string, F& linearized_data );
+    
+    double *outputBuffer( size_t &size ) override
+    {
+        if( is_complex_ ) {
+            size = 2 * idata.size();
+            return reinterpret_cast<double *>( idata.data() );
+        }
+        return DiagnosticFields::outputBuffer( size );
+    };
 
 private:
     std::vector<unsigned int> buffer_skip_x, buffer_skip_y;
@@ -246,28 +246,28 @@ void DiagnosticNewParticles::writeOther( VectorPatch &vecPatches, size_t iprop,
 }
 
 
-void DiagnosticNewParticles::write_scalar_uint64( H5Write * location, string /*name*/, uint64_t &buffer, H5Space *file_space, H5Space *mem_space, unsigned int /*unit_type*/ )
+void DiagnosticNewParticles::write_scalar_uint64( H5Write *&location, string /*name*/, uint64_t &buffer, H5Space *file_space, H5Space *mem_space, unsigned int /*unit_type*/ )
 {
     location->write( buffer, H5T_NATIVE_UINT64, file_space, mem_space );
 }
-void DiagnosticNewParticles::write_scalar_short( H5Write * location, string /*name*/, short &buffer, H5Space *file_space, H5Space *mem_space, unsigned int /*unit_type*/ )
+void DiagnosticNewParticles::write_scalar_short( H5Write *&location, string /*name*/, short &buffer, H5Space *file_space, H5Space *mem_space, unsigned int /*unit_type*/ )
 {
     location->write( buffer, H5T_NATIVE_SHORT, file_space, mem_space );
 }
-void DiagnosticNewParticles::write_scalar_double( H5Write * location, string /*name*/, double &buffer, H5Space *file_space, H5Space *mem_space, unsigned int /*unit_type*/ )
+void DiagnosticNewParticles::write_scalar_double( H5Write *&location, string /*name*/, double &buffer, H5Space *file_space, H5Space *mem_space, unsigned int /*unit_type*/ )
 {
     location->write( buffer, H5T_NATIVE_DOUBLE, file_space, mem_space );
 }
 
-void DiagnosticNewParticles::write_component_uint64( H5Write * location, string /*name*/, uint64_t &buffer, H5Space *file_space, H5Space *mem_space, unsigned int /*unit_type*/ )
+void DiagnosticNewParticles::write_component_uint64( H5Write *&location, string /*name*/, uint64_t &buffer, H5Space *file_space, H5Space *mem_space, unsigned int /*unit_type*/ )
 {
     location->write( buffer, H5T_NATIVE_UINT64, file_space, mem_space );
 }
-void DiagnosticNewParticles::write_component_short( H5Write * location, string /*name*/, short &buffer, H5Space *file_space, H5Space *mem_space, unsigned int /*unit_type*/ )
+void DiagnosticNewParticles::write_component_short( H5Write *&location, string /*name*/, short &buffer, H5Space *file_space, H5Space *mem_space, unsigned int /*unit_type*/ )
 {
     location->write( buffer, H5T_NATIVE_SHORT, file_space, mem_space );
 }
-void DiagnosticNewParticles::write_component_double( H5Write * location, string /*name*/, double &buffer, H5Space *file_space, H5Space *mem_space, unsigned int /*unit_type*/ )
+void DiagnosticNewParticles::write_component_double( H5Write *&location, string /*name*/, double &buffer, H5Space *file_space, H5Space *mem_space, unsigned int /*unit_type*/ )
 {
     location->write( buffer, H5T_NATIVE_DOUBLE, file_space, mem_space );
 }
@@ -35,12 +35,12 @@ public :
     void writeOther( VectorPatch &, size_t, H5Space *, H5Space * ) override;
     
     //! Write a dataset
-    void write_scalar_uint64( H5Write * location, std::string name, uint64_t &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) override;
-    void write_scalar_short ( H5Write * location, std::string name, short    &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) override;
-    void write_scalar_double( H5Write * location, std::string name, double   &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) override;
-    void write_component_uint64( H5Write * location, std::string name, uint64_t &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) override;
-    void write_component_short ( H5Write * location, std::string name, short    &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) override;
-    void write_component_double( H5Write * location, std::string name, double   &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) override;
+    void write_scalar_uint64( H5Write *&location, std::string name, uint64_t &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) override;
+    void write_scalar_short ( H5Write *&location, std::string name, short    &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) override;
+    void write_scalar_double( H5Write *&location, std::string name, double   &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) override;
+    void write_component_uint64( H5Write *&location, std::string name, uint64_t &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) override;
+    void write_component_short ( H5Write *&location, std::string name, short    &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) override;
+    void write_component_double( H5Write *&location, std::string name, double   &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) override;
     
     H5Write * newDataset( H5Write &group, std::string name, hid_t dtype, H5Space &file_space, unsigned int unit_type ) {
         H5Write * d = new H5Write( &group, name, dtype, &file_space );
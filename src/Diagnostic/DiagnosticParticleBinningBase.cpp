@@ -75,6 +75,7 @@ DiagnosticParticleBinningBase::DiagnosticParticleBinningBase(
     
     // Create the Histogram object based on the extracted parameters above
     histogram = HistogramFactory::create( params, deposited_quantity, pyAxes, species_indices, patch, excluded_axes, errorPrefix );
+    histogram->setAxisKeys( species_indices );
     total_axes = histogram->axes.size();
     dims.resize( total_axes );
     for( int iaxis=0; iaxis<total_axes; iaxis++ ) {
@@ -288,7 +289,7 @@ void DiagnosticParticleBinningBase::calculate_auto_limits( Patch *patch, SimWind
 }
 
 // run one particle binning diagnostic
-void DiagnosticParticleBinningBase::run( Patch *patch, int, SimWindow *simWindow )
+void DiagnosticParticleBinningBase::run( Patch *patch, int, SimWindow *simWindow, HistogramAxisCache *cache )
 {
 
     
@@ -319,12 +320,67 @@ void DiagnosticParticleBinningBase::run( Patch *patch, int, SimWindow *simWindow
     vector<int> int_buffer( npart, 0 );
     vector<double> double_buffer( npart );
     
-    histogram->digitize( species, double_buffer, int_buffer, simWindow );
+    histogram->digitize( species, double_buffer, int_buffer, simWindow, cache );
     histogram->valuate( species, double_buffer, int_buffer );
-    histogram->distribute( double_buffer, int_buffer, data_sum );
+    histogram->distribute( double_buffer, int_buffer, outputArray(), !thread_data_.empty() );
     
 } // END run
 
+set<string> DiagnosticParticleBinningBase::sharedAxisKeys( vector<DiagnosticParticleBinningBase *> &diags )
+{
+    set<string> keys, shared_keys;
+    for( unsigned int idiag=0; idiag<diags.size(); idiag++ ) {
+        // Count each key once per diagnostic
+        set<string> diag_keys( diags[idiag]->histogram->axis_keys.begin(), diags[idiag]->histogram->axis_keys.end() );
+        for( set<string>::iterator it = diag_keys.begin(); it != diag_keys.end(); it++ ) {
+            if( it->empty() ) {
+                continue;
+            }
+            if( ! keys.insert( *it ).second ) {
+                shared_keys.insert( *it );
+            }
+        }
+    }
+    return shared_keys;
+}
+
+void DiagnosticParticleBinningBase::initThreadData()
+{
+    // Above this size, the reduction of the thread arrays would cost more than the atomic updates
+    const unsigned int max_thread_data_size = 65536;
+    
+    unsigned int nthreads = Tools::getOMPNumThreads();
+    if( nthreads < 2 || output_size > max_thread_data_size ) {
+        thread_data_.clear();
+        return;
+    }
+    // Kept from a run to the next, as reduceThreadData resets them
+    if( thread_data_.size() == nthreads ) {
+        return;
+    }
+    thread_data_.resize( nthreads );
+    for( unsigned int ithread=0; ithread<nthreads; ithread++ ) {
+        thread_data_[ithread].assign( output_size, 0. );
+    }
+}
+
+void DiagnosticParticleBinningBase::reduceThreadData()
+{
+    if( thread_data_.empty() ) {
+        return;
+    }
+    unsigned int nthreads = thread_data_.size();
+    #pragma omp for schedule(static)
+    for( unsigned int i=0; i<output_size; i++ ) {
+        double sum = 0.;
+        for( unsigned int ithread=0; ithread<nthreads; ithread++ ) {
+            sum += thread_data_[ithread][i];
+            thread_data_[ithread][i] = 0.;
+        }
+        data_sum[i] += sum;
+    }
+}
+
 bool DiagnosticParticleBinningBase::writeNow( int itime ) {
     return itime - timeSelection->previousTime() == time_average-1;
 }
@@ -36,7 +36,22 @@ public :
     
     void calculate_auto_limits( Patch *patch, SimWindow *simWindow, unsigned int ipatch );
     
-    virtual void run( Patch *patch, int itime, SimWindow *simWindow ) override;
+    void run( Patch *patch, int itime, SimWindow *simWindow ) override
+    {
+        run( patch, itime, simWindow, NULL );
+    };
+    
+    //! Run on one patch, sharing the axes computed by other diagnostics on the same patch (cache may be NULL)
+    virtual void run( Patch *patch, int itime, SimWindow *simWindow, HistogramAxisCache *cache );
+    
+    //! Keys of the axes that are computed by more than one of these diagnostics
+    static std::set<std::string> sharedAxisKeys( std::vector<DiagnosticParticleBinningBase *> &diags );
+    
+    //! Allocate one output array per thread at the first run, if the output is small enough (must be called by one thread)
+    void initThreadData();
+    
+    //! Sum the output arrays of all threads in data_sum (must be called by all threads)
+    void reduceThreadData();
     
     virtual bool writeNow( int itime );
     
@@ -48,7 +63,7 @@ public :
     //! Get memory footprint of current diagnostic
     int getMemFootPrint() override
     {
-        int size = output_size*sizeof( double );
+        int size = output_size*sizeof( double ) * ( 1 + thread_data_.size() );
         // + data_array + index_array +  axis_array
         // + nparts_max * (sizeof(double)+sizeof(int)+sizeof(double))
         return size;
@@ -76,6 +91,15 @@ protected:
     //! Histogram object
     Histogram *histogram;
     
+    //! Output array of each thread, summed in data_sum after all patches ran (empty if atomics are used)
+    std::vector<std::vector<double> > thread_data_;
+    
+    //! Output array to be filled by the current thread
+    std::vector<double> &outputArray()
+    {
+        return thread_data_.empty() ? data_sum : thread_data_[Tools::getOMPThreadNum()];
+    };
+    
     unsigned int output_size;
     
     int total_axes;
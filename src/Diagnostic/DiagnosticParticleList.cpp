@@ -170,6 +170,11 @@ void DiagnosticParticleList::run( SmileiMPI *smpi, VectorPatch &vecPatches, int
     H5Space *file_space=NULL, *mem_space=NULL;
     #pragma omp master
     {
+        // The previous output must be written before the HDF5 locations are replaced
+        if( asynchronous_ ) {
+            DiagnosticWriter::instance().wait( last_output_ );
+        }
+        
         // Obtain the particle partition of all the patches in this MPI
         nParticles_local = 0;
         patch_start.resize( vecPatches.size() );
@@ -442,7 +447,19 @@ void DiagnosticParticleList::run( SmileiMPI *smpi, VectorPatch &vecPatches, int
         delete mem_space;
         deleteH5();
         
-        if( flush_timeSelection->theTimeIsNow( itime ) ) {
+        bool flush = flush_timeSelection->theTimeIsNow( itime );
+        if( asynchronous_ ) {
+            job_.add( [this, flush]() {
+                if( flush ) {
+                    file_->flush();
+                }
+            } );
+            last_output_ = DiagnosticWriter::instance().push( job_ );
+            // Flushing also waits for the data to be written
+            if( flush ) {
+                DiagnosticWriter::instance().wait( last_output_ );
+            }
+        } else if( flush ) {
             file_->flush();
         }
     }
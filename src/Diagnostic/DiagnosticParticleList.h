@@ -84,12 +84,12 @@ public :
     };
 
     //! Write a dataset
-    virtual void write_scalar_uint64( H5Write * location, std::string name, uint64_t &, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) = 0;
-    virtual void write_scalar_short ( H5Write * location, std::string name, short    &, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) = 0;
-    virtual void write_scalar_double( H5Write * location, std::string name, double   &, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) = 0;
-    virtual void write_component_uint64( H5Write * location, std::string name, uint64_t &, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) = 0;
-    virtual void write_component_short ( H5Write * location, std::string name, short    &, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) = 0;
-    virtual void write_component_double( H5Write * location, std::string name, double   &, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) = 0;
+    virtual void write_scalar_uint64( H5Write *&location, std::string name, uint64_t &, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) = 0;
+    virtual void write_scalar_short ( H5Write *&location, std::string name, short    &, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) = 0;
+    virtual void write_scalar_double( H5Write *&location, std::string name, double   &, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) = 0;
+    virtual void write_component_uint64( H5Write *&location, std::string name, uint64_t &, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) = 0;
+    virtual void write_component_short ( H5Write *&location, std::string name, short    &, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) = 0;
+    virtual void write_component_double( H5Write *&location, std::string name, double   &, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) = 0;
     
     //! Index of the species used
     unsigned int species_index_;
@@ -1,5 +1,6 @@
 #include "PyTools.h"
 #include <iomanip>
+#include <algorithm>
 
 #include "DiagnosticPerformances.h"
 
@@ -9,6 +10,13 @@ using namespace std;
 const unsigned int n_quantities_double = 19;
 const unsigned int n_quantities_uint   = 4;
 
+// Names of the performance counters of each patch and species (see Species::performance_counters_)
+const char *performance_counter_names[] = {
+    "timer_dynamics", "timer_sort", "cycles", "instructions",
+    "timer_interpolation", "timer_push", "timer_projection", "timer_cell_keys",
+    "timer_ionization", "timer_radiation", "timer_breit_wheeler"
+};
+
 // Constructor
 DiagnosticPerformances::DiagnosticPerformances( Params &params, SmileiMPI *smpi )
 : mpi_size_( smpi->getSize() ),
@@ -41,6 +49,7 @@ DiagnosticPerformances::DiagnosticPerformances( Params &params, SmileiMPI *smpi
     
     // Get patch information flag
     PyTools::extract( "patch_information", patch_information, "DiagPerformances"  );
+    patch_timers = params.patch_timers;
     
     // Output info on diagnostics
     if( smpi->isMaster() ) {
@@ -228,7 +237,7 @@ void DiagnosticPerformances::run( SmileiMPI *, VectorPatch &vecPatches, int itim
         iteration_group.array( "quantities_double", quantities_double[0], &filespace_double, &memspace_double );
         
         // Patch information
-        if( patch_information ) {
+        if( patch_information || patch_timers ) {
         
             // Creation of the group
             H5Write patch_group = iteration_group.group( "patches" );
@@ -284,6 +293,22 @@ void DiagnosticPerformances::run( SmileiMPI *, VectorPatch &vecPatches, int itim
                     // Write patch vectorization status  to file
                     species_group.vect( "vecto", buffer[0], size, H5T_NATIVE_UINT, offset, npoints );
                 }
+                
+                // Performance counters since the previous output, then reset
+                if( patch_timers ) {
+                    vector<double> counters( number_of_patches );
+                    for( unsigned int icounter=0; icounter < Species::n_performance_counters_; icounter++ ) {
+                        for( unsigned int ipatch=0; ipatch < number_of_patches; ipatch++ ) {
+                            vector<double> &patch_counters = vecPatches( ipatch )->vecSpecies[ispecies]->performance_counters_;
+                            counters[ipatch] = icounter < patch_counters.size() ? patch_counters[icounter] : 0.;
+                        }
+                        species_group.vect( performance_counter_names[icounter], counters[0], size, H5T_NATIVE_DOUBLE, offset, npoints );
+                    }
+                    for( unsigned int ipatch=0; ipatch < number_of_patches; ipatch++ ) {
+                        vector<double> &patch_counters = vecPatches( ipatch )->vecSpecies[ispecies]->performance_counters_;
+                        fill( patch_counters.begin(), patch_counters.end(), 0. );
+                    }
+                }
             }
             
             // Write MPI process the owns the patch
@@ -306,7 +331,7 @@ void DiagnosticPerformances::run( SmileiMPI *, VectorPatch &vecPatches, int itim
 
 
 // SUPPOSED TO BE EXECUTED ONLY BY MASTER MPI
-uint64_t DiagnosticPerformances::getDiskFootPrint( int istart, int istop, Patch * )
+uint64_t DiagnosticPerformances::getDiskFootPrint( int istart, int istop, Patch *patch )
 {
     uint64_t footprint = 0;
     
@@ -325,5 +350,10 @@ uint64_t DiagnosticPerformances::getDiskFootPrint( int istart, int istop, Patch
     // Add size of each dump
     footprint += ndumps * ( uint64_t )( mpi_size_ ) * ( uint64_t )( n_quantities_double * sizeof( double ) + n_quantities_uint * sizeof( unsigned int ) );
     
+    // Add size of the performance counters of each patch and species
+    if( patch_timers ) {
+        footprint += ndumps * ( uint64_t )( tot_number_of_patches ) * ( uint64_t )( patch->vecSpecies.size() * Species::n_performance_counters_ * sizeof( double ) );
+    }
+    
     return footprint;
 }
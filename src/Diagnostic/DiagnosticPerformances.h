@@ -65,6 +65,9 @@ private :
     //! Whether to output patch information
     bool patch_information;
     
+    //! Whether to output the performance counters of each patch and species
+    bool patch_timers;
+    
     //! Number of cells per patch
     unsigned int ncells_per_patch;
     
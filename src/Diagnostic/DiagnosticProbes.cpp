@@ -106,6 +106,9 @@ DiagnosticProbes::DiagnosticProbes( Params &params, SmileiMPI *smpi, VectorPatch
         name.str()
     );
 
+    // Write in the background thread if requested
+    extractAsynchronous( "DiagProbe", n_probe );
+
     // Extract "number" (number of points you have in each dimension of the probe,
     // which must be smaller than the code dimensions)
     PyTools::extractV( "number", vecNumber, "DiagProbe", n_probe );
@@ -660,6 +663,11 @@ void DiagnosticProbes::run( SmileiMPI *smpi, VectorPatch &vecPatches, int itime,
     // Leave if this timestep has already been written
     #pragma omp master
     {
+        // The previous output must be written before the probe structure is modified
+        if( asynchronous_ ) {
+            DiagnosticWriter::instance().wait( last_output_ );
+        }
+        
         name_t.str( "" );
         name_t << "/" << setfill( '0' ) << setw( 10 ) << itime;
         dataset_name = name_t.str();
@@ -703,12 +711,15 @@ void DiagnosticProbes::run( SmileiMPI *smpi, VectorPatch &vecPatches, int itime,
                     posArray = new Field2D();
                 }
                 
-                // Define spaces
-                H5Space memspace( {nPart_MPI, nDim_particle}, {}, {} );
-                H5Space filespace( {nPart_total_actual, nDim_particle}, {offset_in_file[0], 0}, {nPart_MPI, nDim_particle} );
-                // Create dataset
-                file_->array( "positions", *(posArray->data_), &filespace, &memspace, false, file_datatype_ );
-                file_->flush();
+                if( asynchronous_ ) {
+                    double *positions = job_.copy( posArray->data_, nPart_MPI * nDim_particle );
+                    hsize_t npart = nPart_MPI, npart_total = nPart_total_actual, offset = offset_in_file[0];
+                    job_.add( [this, positions, npart, npart_total, offset]() {
+                        writePositions( *positions, npart, npart_total, offset );
+                    } );
+                } else {
+                    writePositions( *(posArray->data_), nPart_MPI, nPart_total_actual, offset_in_file[0] );
+                }
                 
                 delete posArray;
                 positions_written = true;
@@ -884,23 +895,54 @@ void DiagnosticProbes::run( SmileiMPI *smpi, VectorPatch &vecPatches, int itime,
     #pragma omp master
     {
         if( timeSelection->theTimeIsNow( itime ) ) {
-            // Define spaces
-            H5Space memspace( {(hsize_t)nFields, nPart_MPI}, {}, {} );
-            H5Space filespace( {(hsize_t)nFields, nPart_total_actual}, {0, offset_in_file[0]}, {(hsize_t)nFields, nPart_MPI} );
-            // Create new dataset for this timestep
-            H5Write d = file_->array( dataset_name, *(probesArray->data_), &filespace, &memspace, true, file_datatype_ );
-            // Write x_moved
-            d.attr( "x_moved", x_moved );
+            bool flush = flush_timeSelection->theTimeIsNow( itime );
+            hsize_t nfields = nFields, npart = nPart_MPI, npart_total = nPart_total_actual, offset = offset_in_file[0];
+            if( asynchronous_ ) {
+                double *data = job_.copy( probesArray->data_, nFields * nPart_MPI );
+                string name = dataset_name;
+                job_.add( [this, name, data, nfields, npart, npart_total, offset, x_moved, flush]() {
+                    writeData( name, *data, nfields, npart, npart_total, offset, x_moved, flush );
+                } );
+                last_output_ = DiagnosticWriter::instance().push( job_ );
+                // Flushing also waits for the data to be written
+                if( flush ) {
+                    DiagnosticWriter::instance().wait( last_output_ );
+                }
+            } else {
+                writeData( dataset_name, *(probesArray->data_), nfields, npart, npart_total, offset, x_moved, flush );
+            }
             
             delete probesArray;
-            if( flush_timeSelection->theTimeIsNow( itime ) ) {
-                file_->flush();
-            }
         }
     }
     #pragma omp barrier
 }
 
+void DiagnosticProbes::writePositions( double &positions, hsize_t npart, hsize_t npart_total, hsize_t offset )
+{
+    // Define spaces
+    H5Space memspace( {npart, nDim_particle}, {}, {} );
+    H5Space filespace( {npart_total, nDim_particle}, {offset, 0}, {npart, nDim_particle} );
+    // Create dataset
+    file_->array( "positions", positions, &filespace, &memspace, false, file_datatype_ );
+    file_->flush();
+}
+
+void DiagnosticProbes::writeData( string name, double &data, hsize_t nfields, hsize_t npart, hsize_t npart_total, hsize_t offset, double x_moved, bool flush )
+{
+    // Define spaces
+    H5Space memspace( {nfields, npart}, {}, {} );
+    H5Space filespace( {nfields, npart_total}, {0, offset}, {nfields, npart} );
+    // Create new dataset for this timestep
+    H5Write d = file_->array( name, data, &filespace, &memspace, true, file_datatype_ );
+    // Write x_moved
+    d.attr( "x_moved", x_moved );
+    
+    if( flush ) {
+        file_->flush();
+    }
+}
+
 bool DiagnosticProbes::needsRhoJs( int itime )
 {
     return hasRhoJs && timeSelection->theTimeIsNow( itime );
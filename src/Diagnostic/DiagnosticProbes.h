@@ -33,6 +33,12 @@ public :
     //! Creates the probe's particles (or "points")
     void createPoints( SmileiMPI *smpi, VectorPatch &vecPatches, double x_moved );
     
+    //! Writes the positions of the points of this MPI process
+    void writePositions( double &positions, hsize_t npart, hsize_t npart_total, hsize_t offset );
+    
+    //! Writes the data of one timestep for the points of this MPI process
+    void writeData( std::string name, double &data, hsize_t nfields, hsize_t npart, hsize_t npart_total, hsize_t offset, double x_moved, bool flush );
+    
     //! Get memory footprint of current diagnostic
     int getMemFootPrint() override
     {
@@ -117,7 +117,7 @@ void DiagnosticRadiationSpectrum::openFile( Params& params, SmileiMPI* smpi )
 }
 
 // run one particle binning diagnostic
-void DiagnosticRadiationSpectrum::run( Patch* patch, int, SimWindow* simWindow )
+void DiagnosticRadiationSpectrum::run( Patch* patch, int, SimWindow* simWindow, HistogramAxisCache *cache )
 {
 
     // Calculate the total number of particles in this patch and resize buffers
@@ -132,7 +132,11 @@ void DiagnosticRadiationSpectrum::run( Patch* patch, int, SimWindow* simWindow )
     vector<double> double_buffer( npart );
     
     // Get the index (int_buffer) of each particle in the final array (data_sum)
-    histogram->digitize( species, double_buffer, int_buffer, simWindow );
+    histogram->digitize( species, double_buffer, int_buffer, simWindow, cache );
+    
+    // Without atomics if each thread has its own output array
+    vector<double> &output = outputArray();
+    bool thread_private = !thread_data_.empty();
     
     // loop species & fill the histogram
     unsigned int istart = 0;
@@ -183,8 +187,12 @@ void DiagnosticRadiationSpectrum::run( Patch* patch, int, SimWindow* simWindow )
                 nu   = two_third_ov_chi * zeta;
                 cst  = xi * zeta;
                 increment = increment0 * delta_energies[i] * xi * RadiationTools::computeBesselPartsRadiatedPower(nu,cst);
-                #pragma omp atomic
-                data_sum[ind+i] += increment;
+                if( thread_private ) {
+                    output[ind+i] += increment;
+                } else {
+                    #pragma omp atomic
+                    output[ind+i] += increment;
+                }
             }
         }
         
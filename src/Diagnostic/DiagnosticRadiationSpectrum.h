@@ -16,7 +16,8 @@ public :
     
     void openFile( Params &params, SmileiMPI *smpi ) override;
     
-    void run( Patch *patch, int itime, SimWindow *simWindow ) override;
+    using DiagnosticParticleBinningBase::run;
+    void run( Patch *patch, int itime, SimWindow *simWindow, HistogramAxisCache *cache ) override;
     
     static std::vector<std::string> excludedAxes() {
         std::vector<std::string> excluded_axes( 0 );
@@ -235,7 +235,7 @@ void DiagnosticScalar::init( Params &params, SmileiMPI *, VectorPatch &vecPatche
     // 2 - Prepare the Scalar* objects that will contain the data
     // ----------------------------------------------------------
     
-    values_SUM   .reserve( 13 + nspec*5 + 6 + 2*npoy );
+    values_SUM   .reserve( 14 + nspec*5 + 6 + 2*npoy );
     
     if( !params.Laser_Envelope_model ) {
         values_MINLOC.reserve( 10 );
@@ -258,6 +258,7 @@ void DiagnosticScalar::init( Params &params, SmileiMPI *, VectorPatch &vecPatche
     Ukin_out_mvw = newScalar_SUM( "Ukin_out_mvw" );
     Ukin_inj_mvw = newScalar_SUM( "Ukin_inj_mvw" );
     Ukin_new     = newScalar_SUM( "Ukin_new" );
+    Ukin_sub     = newScalar_SUM( "Ukin_sub" );
     Uelm_bnd     = newScalar_SUM( "Uelm_bnd" );
     Uelm_out_mvw = newScalar_SUM( "Uelm_out_mvw" );
     Uelm_inj_mvw = newScalar_SUM( "Uelm_inj_mvw" );
@@ -422,6 +423,7 @@ void DiagnosticScalar::compute( Patch *patch, int )
     double Ukin_out_mvw_=0.;     // total energy lost due to particles being suppressed by the moving-window
     double Ukin_inj_mvw_=0.;     // total energy added due to particles created by the moving-window
     double Ukin_new_=0.;         // total energy added due to new particles (injector)
+    double Ukin_sub_=0.;         // total energy gained by the subcycled species
     
     // Compute scalars for each species
     for( unsigned int ispec=0; ispec<vecSpecies.size(); ispec++ ) {
@@ -611,6 +613,9 @@ void DiagnosticScalar::compute( Patch *patch, int )
         // particle energy from new particles
         Ukin_new_ += vecSpecies[ispec]->nrj_new_part_;
         
+        // particle energy gained during subcycled pushes
+        Ukin_sub_ += vecSpecies[ispec]->nrj_subcycling_;
+        
     } // for ispec
     
     // Add the calculated energies to the data arrays
@@ -629,6 +634,7 @@ void DiagnosticScalar::compute( Patch *patch, int )
         *Ukin_inj_mvw += Ukin_inj_mvw_ ;
     }
     *Ukin_new += Ukin_new_;
+    *Ukin_sub += Ukin_sub_;
     
     // --------------------------------
     // ELECTROMAGNETIC-related energies
@@ -940,7 +946,7 @@ uint64_t DiagnosticScalar::getDiskFootPrint( int istart, int istop, Patch *patch
     
     // Calculate the number of scalars
     // 1 - general scalars
-    vector<string> scalars = {"Ubal_norm", "Ubal", "Utot", "Uexp", "Ukin", "Urad", "UmBWpairs", "Uelm", "Ukin_bnd", "Ukin_out_mvw", "Ukin_inj_mvw", "Ukin_new", "Uelm_bnd", "Uelm_out_mvw", "Uelm_inj_mvw"};
+    vector<string> scalars = {"Ubal_norm", "Ubal", "Utot", "Uexp", "Ukin", "Urad", "UmBWpairs", "Uelm", "Ukin_bnd", "Ukin_out_mvw", "Ukin_inj_mvw", "Ukin_new", "Ukin_sub", "Uelm_bnd", "Uelm_out_mvw", "Uelm_inj_mvw"};
     // 2 - species scalars
     unsigned int nspec = patch->vecSpecies.size();
     for( unsigned int ispec=0; ispec<nspec; ispec++ ) {
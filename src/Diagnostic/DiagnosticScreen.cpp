@@ -150,6 +150,9 @@ DiagnosticScreen::DiagnosticScreen(
         }
     }
     
+    // Only the few particles crossing the screen are digitized: do not share axes with other diagnostics
+    histogram->axis_keys.clear();
+    
     data_sum.resize( output_size, 0. );
     
 } // END DiagnosticScreen::DiagnosticScreen
@@ -170,7 +173,7 @@ bool DiagnosticScreen::prepare( int )
 
 
 // run one screen diagnostic
-void DiagnosticScreen::run( Patch *patch, int, SimWindow *simWindow )
+void DiagnosticScreen::run( Patch *patch, int, SimWindow *simWindow, HistogramAxisCache * )
 {
 
     unsigned int ndim = screen_point.size();
@@ -338,7 +341,7 @@ void DiagnosticScreen::run( Patch *patch, int, SimWindow *simWindow )
         }
     }
     
-    histogram->distribute( double_buffer, int_buffer, data_sum );
+    histogram->distribute( double_buffer, int_buffer, outputArray(), !thread_data_.empty() );
     
 } // END run
 
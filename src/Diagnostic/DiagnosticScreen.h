@@ -17,7 +17,8 @@ public :
     
     bool prepare( int itime ) override;
     
-    void run( Patch *patch, int itime, SimWindow *simWindow ) override;
+    using DiagnosticParticleBinningBase::run;
+    void run( Patch *patch, int itime, SimWindow *simWindow, HistogramAxisCache *cache ) override;
     
     bool writeNow( int itime ) override;
     
@@ -22,6 +22,9 @@ DiagnosticTrack::DiagnosticTrack( Params &params, SmileiMPI *smpi, VectorPatch &
         vecPatches( ipatch )->vecSpecies[species_index_]->tracking_diagnostic = idiag;
     }
     
+    // Write in the background thread if requested
+    extractAsynchronous( "DiagTrackParticles", iDiagTrackParticles );
+    
     // Obtain the approximate number of particles in the species
     if( params.print_expected_disk_usage ) {
         PeekAtSpecies peek( params, species_index_ );
@@ -78,6 +81,23 @@ void DiagnosticTrack::init( Params &params, SmileiMPI *smpi, VectorPatch &vecPat
 
 
 H5Space * DiagnosticTrack::prepareH5( SimWindow *simWindow, SmileiMPI *smpi, int itime, uint32_t nParticles_local, uint64_t nParticles_global, uint64_t offset )
+{
+    double x_moved = simWindow ? simWindow->getXmoved() : 0.;
+    int nranks = smpi->getSize(), rank = smpi->getRank();
+    if( asynchronous_ ) {
+        // The writer thread creates the groups and spaces, and keeps them until deleteH5
+        uint64_t latest_Id_copy = latest_Id;
+        job_.add( [this, itime, x_moved, latest_Id_copy, nranks, rank, nParticles_local, nParticles_global, offset]() {
+            uint64_t latest = latest_Id_copy;
+            async_file_space_ = createH5( itime, x_moved, latest, nranks, rank, nParticles_local, nParticles_global, offset );
+            async_mem_space_ = new H5Space( ( hsize_t ) nParticles_local );
+        } );
+        return NULL;
+    }
+    return createH5( itime, x_moved, latest_Id, nranks, rank, nParticles_local, nParticles_global, offset );
+}
+
+H5Space * DiagnosticTrack::createH5( int itime, double x_moved, uint64_t &latest, int nranks, int rank, uint32_t nParticles_local, uint64_t nParticles_global, uint64_t offset )
 {
     // Make a new group for this iteration
     ostringstream t( "" );
@@ -129,11 +149,11 @@ H5Space * DiagnosticTrack::prepareH5( SimWindow *simWindow, SmileiMPI *smpi, int
     openPMD_->writeSpeciesAttributes( *species_group );
     
     // Write x_moved
-    iteration_group.attr( "x_moved", simWindow ? simWindow->getXmoved() : 0. );
+    iteration_group.attr( "x_moved", x_moved );
 
     // Create the "latest_IDs" dataset
     // Create file space and select one element for each proc
-    iteration_group.vect( "latest_IDs", latest_Id, smpi->getSize(), H5T_NATIVE_UINT64, smpi->getRank(), 1 );
+    iteration_group.vect( "latest_IDs", latest, nranks, H5T_NATIVE_UINT64, rank, 1 );
     
     // Filespace and chunks
     hsize_t chunk = 0;
@@ -158,6 +178,19 @@ H5Space * DiagnosticTrack::prepareH5( SimWindow *simWindow, SmileiMPI *smpi, int
 }
 
 void DiagnosticTrack::deleteH5()
+{
+    if( asynchronous_ ) {
+        job_.add( [this]() {
+            deleteH5Now();
+            delete async_file_space_;
+            delete async_mem_space_;
+        } );
+    } else {
+        deleteH5Now();
+    }
+}
+
+void DiagnosticTrack::deleteH5Now()
 {
     delete loc_position_[0];
     delete loc_momentum_[0];
@@ -210,39 +243,53 @@ void DiagnosticTrack::setIDs( Particles &particles )
 }
 
 
-void DiagnosticTrack::write_scalar_uint64( H5Write * location, string name, uint64_t &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type )
+void DiagnosticTrack::write_scalar_uint64( H5Write *&location, string name, uint64_t &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type )
 {
-    H5Write a = location->array( name, buffer, H5T_NATIVE_UINT64, file_space, mem_space );
-    openPMD_->writeRecordAttributes( a, unit_type );
-    openPMD_->writeComponentAttributes( a, unit_type );
+    write( location, name, buffer, H5T_NATIVE_UINT64, file_space, mem_space, unit_type, true );
 }
-void DiagnosticTrack::write_scalar_short( H5Write * location, string name, short &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type )
+void DiagnosticTrack::write_scalar_short( H5Write *&location, string name, short &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type )
 {
-    H5Write a = location->array( name, buffer, H5T_NATIVE_SHORT, file_space, mem_space );
-    openPMD_->writeRecordAttributes( a, unit_type );
-    openPMD_->writeComponentAttributes( a, unit_type );
+    write( location, name, buffer, H5T_NATIVE_SHORT, file_space, mem_space, unit_type, true );
 }
-void DiagnosticTrack::write_scalar_double( H5Write * location, string name, double &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type )
+void DiagnosticTrack::write_scalar_double( H5Write *&location, string name, double &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type )
 {
-    H5Write a = location->array( name, buffer, H5T_NATIVE_DOUBLE, file_space, mem_space );
-    openPMD_->writeRecordAttributes( a, unit_type );
-    openPMD_->writeComponentAttributes( a, unit_type );
+    write( location, name, buffer, H5T_NATIVE_DOUBLE, file_space, mem_space, unit_type, true );
 }
 
-void DiagnosticTrack::write_component_uint64( H5Write * location, string name, uint64_t &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type )
+void DiagnosticTrack::write_component_uint64( H5Write *&location, string name, uint64_t &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type )
+{
+    write( location, name, buffer, H5T_NATIVE_UINT64, file_space, mem_space, unit_type, false );
+}
+void DiagnosticTrack::write_component_short( H5Write *&location, string name, short &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type )
 {
-    H5Write a = location->array( name, buffer, H5T_NATIVE_UINT64, file_space, mem_space );
-    openPMD_->writeComponentAttributes( a, unit_type );
+    write( location, name, buffer, H5T_NATIVE_SHORT, file_space, mem_space, unit_type, false );
 }
-void DiagnosticTrack::write_component_short( H5Write * location, string name, short &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type )
+void DiagnosticTrack::write_component_double( H5Write *&location, string name, double &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type )
 {
-    H5Write a = location->array( name, buffer, H5T_NATIVE_SHORT, file_space, mem_space );
-    openPMD_->writeComponentAttributes( a, unit_type );
+    write( location, name, buffer, H5T_NATIVE_DOUBLE, file_space, mem_space, unit_type, false );
 }
-void DiagnosticTrack::write_component_double( H5Write * location, string name, double &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type )
+
+template<class T>
+void DiagnosticTrack::write( H5Write *&location, string name, T &buffer, hid_t type, H5Space *file_space, H5Space *mem_space, unsigned int unit_type, bool record )
 {
-    H5Write a = location->array( name, buffer, H5T_NATIVE_DOUBLE, file_space, mem_space );
-    openPMD_->writeComponentAttributes( a, unit_type );
+    if( asynchronous_ ) {
+        // The location is only known when the writer thread has executed prepareH5
+        H5Write **loc = &location;
+        T *copy = job_.copy( &buffer, nParticles_local );
+        job_.add( [this, loc, name, copy, type, unit_type, record]() {
+            H5Write a = ( *loc )->array( name, *copy, type, async_file_space_, async_mem_space_ );
+            if( record ) {
+                openPMD_->writeRecordAttributes( a, unit_type );
+            }
+            openPMD_->writeComponentAttributes( a, unit_type );
+        } );
+    } else {
+        H5Write a = location->array( name, buffer, type, file_space, mem_space );
+        if( record ) {
+            openPMD_->writeRecordAttributes( a, unit_type );
+        }
+        openPMD_->writeComponentAttributes( a, unit_type );
+    }
 }
 
 
@@ -31,19 +31,25 @@ public :
     //! Prepare all HDF5 groups, datasets and spaces
     H5Space * prepareH5( SimWindow *simWindow, SmileiMPI *smpi, int itime, uint32_t nParticles_local, uint64_t nParticles_global, uint64_t offset ) override;
     
+    //! Create all HDF5 groups, datasets and spaces (in the writer thread for asynchronous output)
+    H5Space * createH5( int itime, double x_moved, uint64_t &latest, int nranks, int rank, uint32_t nParticles_local, uint64_t nParticles_global, uint64_t offset );
+    
     //! Close HDF5 groups, datasets and spaces
     void deleteH5() override;
+    void deleteH5Now();
     
     //! Modify the filtered particles (apply new ID)
     void modifyFiltered( VectorPatch &, unsigned int ) override;
     
     //! Write a dataset
-    void write_scalar_uint64( H5Write * location, std::string name, uint64_t &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) override;
-    void write_scalar_short ( H5Write * location, std::string name, short    &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) override;
-    void write_scalar_double( H5Write * location, std::string name, double   &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) override;
-    void write_component_uint64( H5Write * location, std::string name, uint64_t &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) override;
-    void write_component_short ( H5Write * location, std::string name, short    &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) override;
-    void write_component_double( H5Write * location, std::string name, double   &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) override;
+    void write_scalar_uint64( H5Write *&location, std::string name, uint64_t &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) override;
+    void write_scalar_short ( H5Write *&location, std::string name, short    &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) override;
+    void write_scalar_double( H5Write *&location, std::string name, double   &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) override;
+    void write_component_uint64( H5Write *&location, std::string name, uint64_t &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) override;
+    void write_component_short ( H5Write *&location, std::string name, short    &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) override;
+    void write_component_double( H5Write *&location, std::string name, double   &buffer, H5Space *file_space, H5Space *mem_space, unsigned int unit_type ) override;
+    template<class T>
+    void write( H5Write *&location, std::string name, T &buffer, hid_t type, H5Space *file_space, H5Space *mem_space, unsigned int unit_type, bool record );
     
     //! Set a given patch's particles with the required IDs (used at initialization & simWindow)
     void setIDs( Patch * );
@@ -60,6 +66,9 @@ public :
 private :
     
     H5Write * data_group_;
+    
+    //! File and memory spaces of the output being written by the writer thread
+    H5Space *async_file_space_ = NULL, *async_mem_space_ = NULL;
 };
 
 #endif
@@ -0,0 +1,124 @@
+#include "DiagnosticWriter.h"
+
+#include <algorithm>
+
+#include <hdf5.h>
+#include <mpi.h>
+
+using namespace std;
+
+DiagnosticWriter &DiagnosticWriter::instance()
+{
+    static DiagnosticWriter writer;
+    return writer;
+}
+
+DiagnosticWriter::DiagnosticWriter() :
+    pushed_( 0 ),
+    done_( 0 ),
+    stop_( false )
+{
+}
+
+DiagnosticWriter::~DiagnosticWriter()
+{
+    if( thread_.joinable() ) {
+        {
+            unique_lock<mutex> lock( mutex_ );
+            stop_ = true;
+        }
+        job_pushed_.notify_all();
+        thread_.join();
+    }
+}
+
+bool DiagnosticWriter::available()
+{
+    hbool_t threadsafe = false;
+    H5is_library_threadsafe( &threadsafe );
+    // Parallel files are written with MPI-IO collectives from the writer thread
+    int mpi_thread_level;
+    MPI_Query_thread( &mpi_thread_level );
+    return threadsafe && mpi_thread_level == MPI_THREAD_MULTIPLE;
+}
+
+uint64_t DiagnosticWriter::push( Job &job )
+{
+    uint64_t ticket;
+    {
+        unique_lock<mutex> lock( mutex_ );
+        jobs_.push_back( Job() );
+        jobs_.back().actions_.swap( job.actions_ );
+        jobs_.back().buffers_.swap( job.buffers_ );
+        ticket = ++pushed_;
+        // The thread is only started when the first job arrives
+        if( ! thread_.joinable() ) {
+            thread_ = thread( &DiagnosticWriter::loop, this );
+        }
+    }
+    job_pushed_.notify_one();
+    return ticket;
+}
+
+void DiagnosticWriter::wait( uint64_t ticket )
+{
+    unique_lock<mutex> lock( mutex_ );
+    job_done_.wait( lock, [this, ticket] { return done_ >= ticket; } );
+}
+
+void DiagnosticWriter::waitAll()
+{
+    unique_lock<mutex> lock( mutex_ );
+    job_done_.wait( lock, [this] { return done_ >= pushed_; } );
+}
+
+void DiagnosticWriter::loop()
+{
+    unique_lock<mutex> lock( mutex_ );
+    while( true ) {
+        job_pushed_.wait( lock, [this] { return stop_ || ! jobs_.empty(); } );
+        if( jobs_.empty() ) {
+            return;
+        }
+        Job job;
+        job.actions_.swap( jobs_.front().actions_ );
+        job.buffers_.swap( jobs_.front().buffers_ );
+        jobs_.pop_front();
+
+        // Write without holding the lock, so that the next jobs can be pushed meanwhile
+        lock.unlock();
+        for( unsigned int i=0; i<job.actions_.size(); i++ ) {
+            job.actions_[i]();
+        }
+        lock.lock();
+
+        for( unsigned int i=0; i<job.buffers_.size(); i++ ) {
+            pool_.push_back( vector<double>() );
+            pool_.back().swap( job.buffers_[i] );
+        }
+        done_++;
+        job_done_.notify_all();
+    }
+}
+
+vector<double> DiagnosticWriter::acquireBuffer( size_t n )
+{
+    vector<double> buffer;
+    {
+        unique_lock<mutex> lock( mutex_ );
+        // Take the smallest pooled buffer that is large enough
+        int best = -1;
+        for( unsigned int i=0; i<pool_.size(); i++ ) {
+            if( pool_[i].capacity() >= n && ( best < 0 || pool_[i].capacity() < pool_[best].capacity() ) ) {
+                best = i;
+            }
+        }
+        if( best >= 0 ) {
+            buffer.swap( pool_[best] );
+            pool_.erase( pool_.begin() + best );
+        }
+    }
+    // Never empty, so that the first element can be passed by reference to HDF5
+    buffer.resize( max( n, ( size_t ) 1 ) );
+    return buffer;
+}
@@ -0,0 +1,112 @@
+/*
+ * DiagnosticWriter.h
+ *
+ * Background writer of the asynchronous diagnostics (Fields, Probes, TrackParticles):
+ * the master thread copies the data of one output in a job, together with the HDF5
+ * calls to be made, and a single thread per MPI process executes the jobs in order.
+ * All processes push the same jobs in the same order, so that the collective HDF5
+ * calls of the jobs match between processes.
+ */
+
+#ifndef DIAGNOSTICWRITER_H
+#define DIAGNOSTICWRITER_H
+
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <stdint.h>
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class DiagnosticWriter
+//  --------------------------------------------------------------------------------------------------------------------
+class DiagnosticWriter
+{
+public:
+
+    //! HDF5 calls and copied data of one output
+    class Job
+    {
+    public:
+        //! Add an action, executed by the writer thread after the previous ones
+        void add( std::function<void()> action )
+        {
+            actions_.push_back( action );
+        };
+
+        //! Copy some data in a buffer owned by the job, and return the copy
+        template<class T>
+        T *copy( const T *data, size_t n )
+        {
+            size_t bytes = n*sizeof( T );
+            buffers_.push_back( DiagnosticWriter::instance().acquireBuffer( ( bytes + sizeof( double ) - 1 ) / sizeof( double ) ) );
+            if( bytes > 0 ) {
+                memcpy( buffers_.back().data(), data, bytes );
+            }
+            return reinterpret_cast<T *>( buffers_.back().data() );
+        };
+
+        //! True if nothing was added
+        bool empty()
+        {
+            return actions_.empty();
+        };
+
+    private:
+        friend class DiagnosticWriter;
+
+        std::vector<std::function<void()> > actions_;
+
+        //! Buffers taken from the pool of the writer, given back once the job is done
+        std::vector<std::vector<double> > buffers_;
+    };
+
+    //! The writer of this MPI process
+    static DiagnosticWriter &instance();
+
+    ~DiagnosticWriter();
+
+    //! Whether the HDF5 library and MPI can be used from the writer thread
+    static bool available();
+
+    //! Give the job to the writer thread (the job is left empty), and return its ticket
+    uint64_t push( Job &job );
+
+    //! Wait until the job with this ticket has been written
+    void wait( uint64_t ticket );
+
+    //! Wait until all jobs have been written.
+    //! Must be called before any collective HDF5 operation made outside of the writer thread.
+    void waitAll();
+
+private:
+
+    DiagnosticWriter();
+
+    //! Loop of the writer thread
+    void loop();
+
+    //! Get a buffer of n doubles from the pool
+    std::vector<double> acquireBuffer( size_t n );
+
+    std::thread thread_;
+    std::mutex mutex_;
+    std::condition_variable job_pushed_, job_done_;
+
+    //! Jobs waiting to be written
+    std::deque<Job> jobs_;
+
+    //! Number of jobs pushed and written since the beginning
+    uint64_t pushed_, done_;
+
+    bool stop_;
+
+    //! Buffers of the finished jobs, reused by the next ones
+    std::vector<std::vector<double> > pool_;
+};
+
+#endif
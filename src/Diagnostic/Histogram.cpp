@@ -4,6 +4,7 @@
 #include "ParticleData.h"
 
 #include <algorithm>
+#include <iomanip>
 
 using namespace std;
 
@@ -11,31 +12,61 @@ using namespace std;
 void Histogram::digitize( vector<Species *> species,
                           vector<double> &double_buffer,
                           vector<int>    &int_buffer,
-                          SimWindow *simWindow )
+                          SimWindow *simWindow,
+                          HistogramAxisCache *cache )
 {
     unsigned int npart = double_buffer.size();
     
     for( unsigned int iaxis=0 ; iaxis < axes.size() ; iaxis++ ) {
         
         HistogramAxis * axis = axes[iaxis];
+        const double *value = double_buffer.data();
         
-        // first loop on particles to store the indexing (axis) quantity
-        unsigned int istart = 0;
-        for( unsigned int ispec=0; ispec < species.size(); ispec++ ) {
-            unsigned int npart = species[ispec]->getNbrOfParticles();
-            axis->calculate_locations( species[ispec], &double_buffer[istart], &int_buffer[istart], npart, simWindow );
-            istart += npart;
-        }
-        // Now, double_buffer has the location of each particle along the axis
-        
-        // if log scale, loop again and convert to log
-        if( axis->logscale ) {
-            for( unsigned int ipart = 0 ; ipart < npart ; ipart++ ) {
-                if( int_buffer[ipart] < 0 ) {
-                    continue;
+        if( cache && iaxis < axis_keys.size() && cache->isShared( axis_keys[iaxis] ) ) {
+            
+            // This quantity is shared with other histograms: compute it once for all particles of the patch
+            map<string, vector<double> >::iterator it = cache->values_.find( axis_keys[iaxis] );
+            if( it == cache->values_.end() ) {
+                vector<double> &values = cache->values_[axis_keys[iaxis]];
+                values.resize( npart );
+                vector<int> all_particles( npart, 0 );
+                unsigned int istart = 0;
+                for( unsigned int ispec=0; ispec < species.size(); ispec++ ) {
+                    unsigned int npart = species[ispec]->getNbrOfParticles();
+                    axis->calculate_locations( species[ispec], &values[istart], &all_particles[istart], npart, simWindow );
+                    istart += npart;
                 }
-                double_buffer[ipart] = log10( abs( double_buffer[ipart] ) );
+                if( axis->logscale ) {
+                    for( unsigned int ipart = 0 ; ipart < npart ; ipart++ ) {
+                        values[ipart] = log10( abs( values[ipart] ) );
+                    }
+                }
+                value = values.data();
+            } else {
+                value = it->second.data();
+            }
+            
+        } else {
+            
+            // first loop on particles to store the indexing (axis) quantity
+            unsigned int istart = 0;
+            for( unsigned int ispec=0; ispec < species.size(); ispec++ ) {
+                unsigned int npart = species[ispec]->getNbrOfParticles();
+                axis->calculate_locations( species[ispec], &double_buffer[istart], &int_buffer[istart], npart, simWindow );
+                istart += npart;
             }
+            // Now, double_buffer has the location of each particle along the axis
+            
+            // if log scale, loop again and convert to log
+            if( axis->logscale ) {
+                for( unsigned int ipart = 0 ; ipart < npart ; ipart++ ) {
+                    if( int_buffer[ipart] < 0 ) {
+                        continue;
+                    }
+                    double_buffer[ipart] = log10( abs( double_buffer[ipart] ) );
+                }
+            }
+            
         }
         
         double actual_min = axis->logscale ? log10( axis->global_min ) : axis->global_min;
@@ -45,47 +76,34 @@ void Histogram::digitize( vector<Species *> species,
         // The indexes are "reshaped" in one dimension.
         // For instance, in 3d, the index has the form  i = i3 + n3*( i2 + n2*i1 )
         // Here we do the multiplication by n3 or n2 (etc.)
-        if( iaxis>0 ) {
-            for( unsigned int ipart = 0 ; ipart < npart ; ipart++ ) {
-                int_buffer[ipart] *= axis->nbins;
-            }
-        }
+        int stride = iaxis>0 ? axis->nbins : 1;
+        int nbins = axis->nbins;
+        double last_bin = ( double )( nbins-1 );
+        int *index = int_buffer.data();
         
         // loop again on the particles and calculate the index
         // This is separated in two cases: edge_inclusive and edge_exclusive
+        // Both loops are written without branches so that they vectorize;
+        // discarded particles (negative index) are left negative
         if( !axis->edge_inclusive ) { // if the particles out of the "box" must be excluded
         
+            #pragma omp simd
             for( unsigned int ipart = 0 ; ipart < npart ; ipart++ ) {
-                // skip already discarded particles
-                if( int_buffer[ipart] < 0 ) {
-                    continue;
-                }
-                // calculate index
-                int ind = floor( ( double_buffer[ipart]-actual_min ) * coeff );
+                double bin = floor( ( value[ipart]-actual_min ) * coeff );
                 // index valid only if in the "box"
-                if( ind >= 0  &&  ind < axis->nbins ) {
-                    int_buffer[ipart] += ind;
-                } else {
-                    int_buffer[ipart] = -1;    // discard particle
-                }
+                bool valid = index[ipart] >= 0 && bin >= 0. && bin < nbins;
+                index[ipart] = valid ? index[ipart] * stride + int( bin ) : -1;
             }
             
         } else { // if the particles out of the "box" must be included
 
+            #pragma omp simd
             for( unsigned int ipart = 0 ; ipart < npart ; ipart++ ) {
-                // skip already discarded particles
-                if( int_buffer[ipart] < 0 ) {
-                    continue;
-                }
-                // calculate index
-                int ind = floor( ( double_buffer[ipart]-actual_min ) * coeff );
+                double bin = floor( ( value[ipart]-actual_min ) * coeff );
                 // move out-of-range indexes back into range
-                if( ind < 0 ) {
-                    ind = 0;
-                } else if( ind >= axis->nbins ) {
-                    ind = axis->nbins-1;
-                }
-                int_buffer[ipart] += ind;
+                bin = bin > 0. ? bin : 0.;
+                bin = bin < last_bin ? bin : last_bin;
+                index[ipart] = index[ipart] >= 0 ? index[ipart] * stride + int( bin ) : -1;
             }
 
         }
@@ -96,7 +114,8 @@ void Histogram::digitize( vector<Species *> species,
 void Histogram::distribute(
     std::vector<double> &double_buffer,
     std::vector<int>    &int_buffer,
-    std::vector<double> &output_array )
+    std::vector<double> &output_array,
+    bool thread_private )
 {
 
     unsigned int ipart, npart=double_buffer.size();
@@ -104,17 +123,50 @@ void Histogram::distribute(
     
     // Sum the data into the data_sum according to the indexes
     // ---------------------------------------------------------------
-    for( ipart = 0 ; ipart < npart ; ipart++ ) {
-        ind = int_buffer[ipart];
-        if( ind<0 ) {
-            continue;    // skip discarded particles
+    if( thread_private ) {
+        for( ipart = 0 ; ipart < npart ; ipart++ ) {
+            ind = int_buffer[ipart];
+            if( ind<0 ) {
+                continue;    // skip discarded particles
+            }
+            output_array[ind] += double_buffer[ipart];
+        }
+    } else {
+        for( ipart = 0 ; ipart < npart ; ipart++ ) {
+            ind = int_buffer[ipart];
+            if( ind<0 ) {
+                continue;    // skip discarded particles
+            }
+            #pragma omp atomic
+            output_array[ind] += double_buffer[ipart];
         }
-        #pragma omp atomic
-        output_array[ind] += double_buffer[ipart];
     }
     
 }
 
+void Histogram::setAxisKeys( vector<unsigned int> species_indices )
+{
+    axis_keys.resize( axes.size() );
+    for( unsigned int iaxis=0; iaxis<axes.size(); iaxis++ ) {
+        HistogramAxis *axis = axes[iaxis];
+        // User functions are not compared between diagnostics
+        if( axis->type.substr( 0, 13 ) == "user_function" ) {
+            axis_keys[iaxis] = "";
+            continue;
+        }
+        ostringstream key( "" );
+        key << setprecision( 17 ) << axis->type << ( axis->logscale ? " log" : " lin" ) << " [";
+        for( unsigned int i=0; i<axis->coefficients.size(); i++ ) {
+            key << " " << axis->coefficients[i];
+        }
+        key << " ] species";
+        for( unsigned int i=0; i<species_indices.size(); i++ ) {
+            key << " " << species_indices[i];
+        }
+        axis_keys[iaxis] = key.str();
+    }
+}
+
 
 
 void HistogramAxis::init( string type_, double min_, double max_, int nbins_, bool logscale_, bool edge_inclusive_, vector<double> coefficients_ )
@@ -7,6 +7,8 @@
 #include "Patch.h"
 #include "SimWindow.h"
 #include <algorithm>
+#include <map>
+#include <set>
 
 // Class for each axis of the particle diags
 class HistogramAxis
@@ -68,6 +70,25 @@ public:
 };
 
 
+// Axis values of the particles of one patch, shared by several histograms
+class HistogramAxisCache
+{
+public:
+    HistogramAxisCache( const std::set<std::string> &shared_keys ) : shared_keys_( shared_keys ) {};
+    
+    //! Whether the axis identified by this key is used by more than one histogram
+    bool isShared( const std::string &key ) const
+    {
+        return !key.empty() && shared_keys_.count( key ) > 0;
+    };
+    
+    //! Keys of the axes used by more than one histogram
+    const std::set<std::string> &shared_keys_;
+    
+    //! Values of the shared axes for all the particles of the current patch (log10 already applied)
+    std::map<std::string, std::vector<double> > values_;
+};
+
 // Class for making a histogram of particle data
 class Histogram
 {
@@ -80,7 +101,8 @@ public:
     };
     
     //! Compute the index of each particle in the final histogram
-    void digitize( std::vector<Species *>, std::vector<double> &, std::vector<int> &, SimWindow * );
+    //! The axes shared with other histograms are computed once per patch through the cache (may be NULL)
+    void digitize( std::vector<Species *>, std::vector<double> &, std::vector<int> &, SimWindow *, HistogramAxisCache *cache = NULL );
     //! Calculate the quantity of each particle to be summed in the histogram
     virtual void valuate( Species *, double *, int * ) {
         ERROR( "`deposited_quantity` should not be empty" );
@@ -94,11 +116,18 @@ public:
         }
     };
     //! Add the contribution of each particle in the histogram
-    void distribute( std::vector<double> &, std::vector<int> &, std::vector<double> & );
+    //! Atomic updates are not needed when the output array is private to the thread
+    void distribute( std::vector<double> &, std::vector<int> &, std::vector<double> &, bool thread_private = false );
+    
+    //! Set the keys identifying the quantity of each axis, for the given species
+    void setAxisKeys( std::vector<unsigned int> species_indices );
 
     std::string deposited_quantity;
 
     std::vector<HistogramAxis *> axes;
+    
+    //! Key of each axis (empty if the axis cannot be shared with other histograms)
+    std::vector<std::string> axis_keys;
 };
 
 
@@ -36,7 +36,8 @@ ElectroMagn::ElectroMagn( Params &params, vector<Species *> &vecSpecies, Patch *
     nrj_mw_out( 0. ),
     nrj_mw_inj( 0. ),
     filter_( NULL ),
-    use_BTIS3(params.use_BTIS3)
+    use_BTIS3(params.use_BTIS3),
+    poisson_pcg_( params.poisson_solver == "PCG" )
 {
     size_ = patch->size_;
     oversize = patch->oversize;
@@ -75,7 +76,8 @@ ElectroMagn::ElectroMagn( ElectroMagn *emFields, Params &params, Patch *patch )
     nrj_mw_out( 0. ),
     nrj_mw_inj( 0. ),
     filter_( NULL ),
-    use_BTIS3(emFields->use_BTIS3)
+    use_BTIS3(emFields->use_BTIS3),
+    poisson_pcg_( emFields->poisson_pcg_ )
 {
     dimPrim = emFields->dimPrim;
     dimDual = emFields->dimDual;
@@ -551,6 +553,162 @@ void ElectroMagn::applyAntenna( unsigned int iAntenna, double intensity )
     }
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Preconditioner of the PCG Poisson solver, for cartesian geometries (1D and 2D fields are treated as 3D with
+// single-node dimensions). The nodes of the patch are split in:
+//   - the nodes shared with the neighbouring patches (first and last primal node of a patch), where M = diag(A)
+//     so that all patches compute the same value on their copy of these nodes,
+//   - the other nodes of the patch, where M^-1 is one symmetric Gauss-Seidel sweep on A restricted to the patch.
+// M is symmetric positive definite: the ghost cells of z are left to zero and must be exchanged afterwards.
+// ---------------------------------------------------------------------------------------------------------------------
+void ElectroMagn::preconditionPoisson( Field *r, Field *z, double gamma_mean )
+{
+    unsigned int n[3]     = { 1, 1, 1 };
+    int          ilo[3]   = { 0, 0, 0 };
+    int          ihi[3]   = { 0, 0, 0 };
+    int          lo[3]    = { 0, 0, 0 };
+    int          hi[3]    = { 0, 0, 0 };
+    double       coeff[3] = { 0., 0., 0. };
+    for( unsigned int i=0; i<nDim_field; i++ ) {
+        n[i]     = dimPrim[i];
+        coeff[i] = 1.0/( cell_length[i]*cell_length[i] );
+        // Nodes of the patch, including the first node of the next patch (except on Xmax)
+        lo[i]    = index_min_p_[i];
+        hi[i]    = index_max_p_[i] < dimPrim[i]-1 ? index_max_p_[i]+1 : index_max_p_[i];
+        // Nodes which are not shared
+        ilo[i]   = lo[i] == ( int )oversize[i] ? lo[i]+1 : lo[i];
+        ihi[i]   = hi[i] == ( int )index_max_p_[i]+1 ? hi[i]-1 : hi[i];
+    }
+    coeff[0] /= gamma_mean*gamma_mean;
+    const double diag = -2.0*( coeff[0]+coeff[1]+coeff[2] );
+    const int s0 = n[1]*n[2];
+    const int s1 = n[2];
+    
+    const double *const R = r->data();
+    double *const Z = z->data();
+    
+    z->put_to( 0. );
+    
+    // Shared nodes
+    for( int i=lo[0]; i<=hi[0]; i++ ) {
+        for( int j=lo[1]; j<=hi[1]; j++ ) {
+            for( int k=lo[2]; k<=hi[2]; k++ ) {
+                if( i<ilo[0] || i>ihi[0] || j<ilo[1] || j>ihi[1] || k<ilo[2] || k>ihi[2] ) {
+                    Z[i*s0+j*s1+k] = R[i*s0+j*s1+k] / diag;
+                }
+            }
+        }
+    }
+    
+    // Forward Gauss-Seidel sweep inside the patch, starting from z = 0
+    for( int i=ilo[0]; i<=ihi[0]; i++ ) {
+        for( int j=ilo[1]; j<=ihi[1]; j++ ) {
+            for( int k=ilo[2]; k<=ihi[2]; k++ ) {
+                int ijk = i*s0+j*s1+k;
+                double sum = R[ijk];
+                if( i>ilo[0] ) {
+                    sum -= coeff[0]*Z[ijk-s0];
+                }
+                if( j>ilo[1] ) {
+                    sum -= coeff[1]*Z[ijk-s1];
+                }
+                if( k>ilo[2] ) {
+                    sum -= coeff[2]*Z[ijk-1];
+                }
+                Z[ijk] = sum / diag;
+            }
+        }
+    }
+    
+    // Backward Gauss-Seidel sweep inside the patch
+    for( int i=ihi[0]; i>=ilo[0]; i-- ) {
+        for( int j=ihi[1]; j>=ilo[1]; j-- ) {
+            for( int k=ihi[2]; k>=ilo[2]; k-- ) {
+                int ijk = i*s0+j*s1+k;
+                double sum = R[ijk];
+                if( i>ilo[0] ) {
+                    sum -= coeff[0]*Z[ijk-s0];
+                }
+                if( i<ihi[0] ) {
+                    sum -= coeff[0]*Z[ijk+s0];
+                }
+                if( j>ilo[1] ) {
+                    sum -= coeff[1]*Z[ijk-s1];
+                }
+                if( j<ihi[1] ) {
+                    sum -= coeff[1]*Z[ijk+s1];
+                }
+                if( k>ilo[2] ) {
+                    sum -= coeff[2]*Z[ijk-1];
+                }
+                if( k<ihi[2] ) {
+                    sum -= coeff[2]*Z[ijk+1];
+                }
+                Z[ijk] = sum / diag;
+            }
+        }
+    }
+    
+} // preconditionPoisson
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Scalar product of two fields of the Poisson solver, over the same nodes as compute_r
+// ---------------------------------------------------------------------------------------------------------------------
+double ElectroMagn::poissonDotProduct( Field *a, Field *b )
+{
+    unsigned int n[3]  = { 1, 1, 1 };
+    unsigned int lo[3] = { 0, 0, 0 };
+    unsigned int hi[3] = { 0, 0, 0 };
+    for( unsigned int i=0; i<nDim_field; i++ ) {
+        n[i]  = dimPrim[i];
+        lo[i] = index_min_p_[i];
+        hi[i] = index_max_p_[i];
+    }
+    
+    const double *const A = a->data();
+    const double *const B = b->data();
+    double a_dot_b = 0.;
+    for( unsigned int i=lo[0]; i<=hi[0]; i++ ) {
+        for( unsigned int j=lo[1]; j<=hi[1]; j++ ) {
+            for( unsigned int k=lo[2]; k<=hi[2]; k++ ) {
+                unsigned int ijk = ( i*n[1]+j )*n[2]+k;
+                a_dot_b += A[ijk]*B[ijk];
+            }
+        }
+    }
+    return a_dot_b;
+} // poissonDotProduct
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Update of the PCG Poisson solver on all nodes: p_ and Ap_ are the direction and its image by A,
+// u and w the preconditioned residual and its image by A
+// ---------------------------------------------------------------------------------------------------------------------
+void ElectroMagn::updatePoissonPCG( Field *u, Field *w, double alpha, double beta, bool first_iteration )
+{
+    double *const phi = phi_->data();
+    double *const r   = r_->data();
+    double *const p   = p_->data();
+    double *const Ap  = Ap_->data();
+    const double *const U = u->data();
+    const double *const W = w->data();
+    
+    if( first_iteration ) {
+        for( unsigned int i=0; i<phi_->number_of_points_; i++ ) {
+            p[i]  = U[i];
+            Ap[i] = W[i];
+        }
+    } else {
+        for( unsigned int i=0; i<phi_->number_of_points_; i++ ) {
+            p[i]  = U[i] + beta*p[i];
+            Ap[i] = W[i] + beta*Ap[i];
+        }
+    }
+    for( unsigned int i=0; i<phi_->number_of_points_; i++ ) {
+        phi[i] += alpha*p[i];
+        r[i]   -= alpha*Ap[i];
+    }
+} // updatePoissonPCG
+
 // ---------------------------------------------------------------------------------------------------------------------
 //! Compute the total density and currents from species density and currents on Device
 //! This function is valid wathever the geometry
@@ -205,6 +205,9 @@ public:
     
     bool use_BTIS3;
     
+    //! Preconditioned Poisson solver (Main.poisson_solver = "PCG")
+    bool poisson_pcg_;
+    
     // Fields for relativistic Initialization
     Field *Ex_rel_;
     Field *Ey_rel_;
@@ -348,6 +351,13 @@ public:
     virtual void center_fields_from_relativistic_Poisson() = 0; // centers in Yee cells the fields
     virtual void sum_rel_fields_to_em_fields() = 0;
     virtual void initRelativisticPoissonFields() = 0;
+    //! Preconditioner of the PCG Poisson solver (cartesian geometries): z = M^-1 r where M is block-diagonal,
+    //! with a symmetric Gauss-Seidel sweep inside the patch and a diagonal scaling on the nodes shared with neighbours
+    void preconditionPoisson( Field *r, Field *z, double gamma_mean );
+    //! Scalar product of two fields of the Poisson solver over the nodes owned by the patch
+    double poissonDotProduct( Field *a, Field *b );
+    //! PCG Poisson solver update: p = u + beta p, Ap = w + beta Ap, phi += alpha p, r -= alpha Ap
+    void updatePoissonPCG( Field *u, Field *w, double alpha, double beta, bool first_iteration );
     virtual void centeringE( std::vector<double> E_Add ) = 0;
     virtual void centeringErel( std::vector<double> E_Add ) = 0;
 
@@ -373,6 +383,9 @@ public:
     Field *r_;
     Field *p_;
     Field *Ap_;
+    //! Preconditioned residual and its image by A, for the PCG Poisson solver only
+    Field *u_;
+    Field *w_;
 
     cField *phi_AM_;
     cField *r_AM_;
@@ -236,6 +236,10 @@ void ElectroMagn1D::initPoisson( Patch *patch )
     r_   = new Field1D( dimPrim );  // residual vector
     p_   = new Field1D( dimPrim );  // direction vector
     Ap_  = new Field1D( dimPrim );  // A*p vector
+    if( poisson_pcg_ ) {
+        u_ = new Field1D( dimPrim, "u" ); // preconditioned residual
+        w_ = new Field1D( dimPrim, "w" ); // A*u vector
+    }
 
     // double       dx_sq          = dx*dx;
 
@@ -358,6 +362,10 @@ void ElectroMagn1D::initE( Patch *patch )
     delete r_;
     delete p_;
     delete Ap_;
+    if( poisson_pcg_ ) {
+        delete u_;
+        delete w_;
+    }
 
 } // initE
 
@@ -394,6 +402,10 @@ void ElectroMagn1D::initE_relativistic_Poisson( Patch *patch, double gamma_mean
     delete r_;
     delete p_;
     delete Ap_;
+    if( poisson_pcg_ ) {
+        delete u_;
+        delete w_;
+    }
 
 } // initE_relativistic_Poisson
 
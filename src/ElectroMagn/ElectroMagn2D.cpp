@@ -247,6 +247,10 @@ void ElectroMagn2D::initPoisson( Patch *patch )
     r_   = new Field2D( dimPrim );  // residual vector
     p_   = new Field2D( dimPrim );  // direction vector
     Ap_  = new Field2D( dimPrim );  // A*p vector
+    if( poisson_pcg_ ) {
+        u_ = new Field2D( dimPrim, "u" ); // preconditioned residual
+        w_ = new Field2D( dimPrim, "w" ); // A*u vector
+    }
     
     
     for( unsigned int i=0; i<dimPrim[0]; i++ ) {
@@ -487,6 +491,10 @@ void ElectroMagn2D::initE( Patch *patch )
     delete r_;
     delete p_;
     delete Ap_;
+    if( poisson_pcg_ ) {
+        delete u_;
+        delete w_;
+    }
     
 } // initE
 
@@ -561,6 +569,10 @@ void ElectroMagn2D::initE_relativistic_Poisson( Patch *patch, double gamma_mean
     delete r_;
     delete p_;
     delete Ap_;
+    if( poisson_pcg_ ) {
+        delete u_;
+        delete w_;
+    }
     
 } // initE_relativistic_Poisson
 
@@ -282,6 +282,10 @@ void ElectroMagn3D::initPoisson( Patch *patch )
     r_   = new Field3D( dimPrim );  // residual vector
     p_   = new Field3D( dimPrim );  // direction vector
     Ap_  = new Field3D( dimPrim );  // A*p vector
+    if( poisson_pcg_ ) {
+        u_ = new Field3D( dimPrim, "u" ); // preconditioned residual
+        w_ = new Field3D( dimPrim, "w" ); // A*u vector
+    }
 
 
     for( unsigned int i=0; i<dimPrim[0]; i++ ) {
@@ -598,6 +602,10 @@ void ElectroMagn3D::initE( Patch *patch )
     delete r_;
     delete p_;
     delete Ap_;
+    if( poisson_pcg_ ) {
+        delete u_;
+        delete w_;
+    }
 
 } // initE
 
@@ -731,6 +739,10 @@ void ElectroMagn3D::initE_relativistic_Poisson( Patch *patch, double gamma_mean
     delete r_;
     delete p_;
     delete Ap_;
+    if( poisson_pcg_ ) {
+        delete u_;
+        delete w_;
+    }
 
 } // initE_relativistic_Poisson
 
@@ -2138,7 +2150,7 @@ void ElectroMagn3D::copyInLocalDensities(int ispec, int ibin, double* b_Jx, doub
     for (int i = 0; i < b_dim0 ; i++) {
 	      iloc = ibin + i ;
         for (int j = 0; j < b_dim1 ; j++) {
-            for (int k = 0; k < b_dim2 ; k++) {
+            for (int k = 0; k < (b_dim2+1) ; k++) {
                 Jz3D->data_[ (iloc*b_dim1+j)*Jz3D->dims_[2]+k ] += b_Jz [(i*(b_dim1)+j)*(b_dim2+1)+k];
                 //(*Jz3D) (iloc,j,k) +=  b_Jz [(i*b_dim1+j)*(b_dim2+1)+k];
             }
@@ -223,10 +223,15 @@ Laser::Laser( Params &params, int ilaser, Patch *patch, bool verbose )
         PyTools::extractV( "delay_phase", delay_phase, "Laser", ilaser );
         info << endl << "\t\tdelay phase      (y) : " << delay_phase[0];
         info << endl << "\t\tdelay phase      (z) : " << delay_phase[1];
+        
+        // Sampling of the python time envelope and chirp
+        unsigned int time_envelope_samples;
+        PyTools::extract( "time_envelope_samples", time_envelope_samples, "Laser", ilaser );
+        double table_step = time_envelope_samples > 0 ? params.timestep / time_envelope_samples : 0.;
 
         // Create the LaserProfiles
-        profiles.push_back( new LaserProfileSeparable( omega, pchirp1, ptime1, pspace1, pphase1, delay_phase[0], true , normal_axis ) );
-        profiles.push_back( new LaserProfileSeparable( omega, pchirp2, ptime2, pspace2, pphase2, delay_phase[1], false, normal_axis ) );
+        profiles.push_back( new LaserProfileSeparable( omega, pchirp1, ptime1, pspace1, pphase1, delay_phase[0], true , normal_axis, table_step ) );
+        profiles.push_back( new LaserProfileSeparable( omega, pchirp2, ptime2, pspace2, pphase2, delay_phase[1], false, normal_axis, table_step ) );
 
     }
 
@@ -283,10 +288,126 @@ void Laser::disable()
 }
 
 
+LaserPoints::LaserPoints( Patch *patch, ElectroMagn *EMfields, vector<double> &d,
+                          unsigned int axis1, bool dual1, unsigned int jmin, unsigned int jmax ) :
+    ndim_( 1 ),
+    jmin_( jmin ),
+    jmax_( jmax ),
+    kmin_( 0 ),
+    kmax_( 1 ),
+    stride_( 1 )
+{
+    x0_[0] = patch->getDomainLocalMin( axis1 );
+    shift_[0] = ( dual1 ? -0.5 : 0. ) - ( double ) EMfields->oversize[axis1];
+    d_[0] = d[axis1];
+    x0_[1] = 0.;
+    shift_[1] = 0.;
+    d_[1] = 0.;
+}
+
+LaserPoints::LaserPoints( Patch *patch, ElectroMagn *EMfields, vector<double> &d,
+                          unsigned int axis1, bool dual1, unsigned int jmin, unsigned int jmax,
+                          unsigned int axis2, bool dual2, unsigned int kmin, unsigned int kmax, unsigned int stride ) :
+    ndim_( 2 ),
+    jmin_( jmin ),
+    jmax_( jmax ),
+    kmin_( kmin ),
+    kmax_( kmax ),
+    stride_( stride )
+{
+    x0_[0] = patch->getDomainLocalMin( axis1 );
+    shift_[0] = ( dual1 ? -0.5 : 0. ) - ( double ) EMfields->oversize[axis1];
+    d_[0] = d[axis1];
+    x0_[1] = patch->getDomainLocalMin( axis2 );
+    shift_[1] = ( dual2 ? -0.5 : 0. ) - ( double ) EMfields->oversize[axis2];
+    d_[1] = d[axis2];
+}
+
+void LaserPoints::positions( vector<double> &x, vector<double *> &coordinates )
+{
+    unsigned int n = size();
+    unsigned int nk = kmax_ - kmin_;
+    x.resize( ndim_ * n );
+    coordinates.resize( ndim_ );
+    for( unsigned int i=0; i<ndim_; i++ ) {
+        coordinates[i] = &x[i*n];
+    }
+    for( unsigned int j=jmin_; j<jmax_; j++ ) {
+        for( unsigned int k=kmin_; k<kmax_; k++ ) {
+            unsigned int i = ( j-jmin_ )*nk + k-kmin_;
+            coordinates[0][i] = position( 0, j );
+            if( ndim_ > 1 ) {
+                coordinates[1][i] = position( 1, k );
+            }
+        }
+    }
+}
+
+
+bool LaserTimeTable::cover( double tmin, double tmax )
+{
+    // Largest number of samples
+    const long max_samples = 1 << 20;
+    
+    if( !( tmin <= tmax ) || !( std::abs( tmin ) < 1e12*step_ ) || !( std::abs( tmax ) < 1e12*step_ ) ) {
+        return false;
+    }
+    long imin = ( long ) std::floor( tmin / step_ );
+    long imax = ( long ) std::floor( tmax / step_ ) + 1;
+    long n = values_.size();
+    if( imin >= first_ && imax < first_ + n ) {
+        return true;
+    }
+    
+    // New window, extended towards later times, keeping the samples already available
+    long new_n = imax - imin + 1 + chunk_;
+    if( new_n > max_samples ) {
+        return false;
+    }
+    vector<double> values( new_n );
+    vector<double> times;
+    vector<long> missing;
+    for( long i=0; i<new_n; i++ ) {
+        long iold = imin + i - first_;
+        if( iold >= 0 && iold < n ) {
+            values[i] = values_[iold];
+        } else {
+            times.push_back( ( imin + i ) * step_ );
+            missing.push_back( i );
+        }
+    }
+    vector<double> samples( times.size() );
+    vector<double *> coordinates( 1, &times[0] );
+    profile_->valuesAt( coordinates, times.size(), &samples[0] );
+    for( unsigned int i=0; i<missing.size(); i++ ) {
+        values[missing[i]] = samples[i];
+    }
+    values_.swap( values );
+    first_ = imin;
+    return true;
+}
+
+
+// Amplitudes of any laser profile, point by point
+void LaserProfile::addAmplitudes( LaserPoints &points, double t, double *ret )
+{
+    vector<double> pos( points.ndim_ );
+    for( unsigned int j=points.jmin_; j<points.jmax_; j++ ) {
+        pos[0] = points.position( 0, j );
+        for( unsigned int k=points.kmin_; k<points.kmax_; k++ ) {
+            if( points.ndim_ > 1 ) {
+                pos[1] = points.position( 1, k );
+            }
+            ret[j*points.stride_+k] += getAmplitude( pos, t, j, k );
+        }
+    }
+}
+
+
 // Separable laser profile constructor
 LaserProfileSeparable::LaserProfileSeparable(
     double omega, Profile *chirpProfile, Profile *timeProfile,
-    Profile *spaceProfile, Profile *phaseProfile, double delay_phase, bool primal, unsigned int axis
+    Profile *spaceProfile, Profile *phaseProfile, double delay_phase, bool primal, unsigned int axis, double table_step
 ):
     primal_( primal ),
     omega_( omega ),
@@ -295,10 +416,12 @@ LaserProfileSeparable::LaserProfileSeparable(
     spaceProfile_( spaceProfile ),
     phaseProfile_( phaseProfile ),
     delay_phase_( delay_phase ),
-    axis_( axis )
+    axis_( axis ),
+    table_step_( table_step )
 {
     space_envelope = NULL;
     phase = NULL;
+    createTables();
 }
 // Separable laser profile cloning constructor
 LaserProfileSeparable::LaserProfileSeparable( LaserProfileSeparable *lp ) :
@@ -309,14 +432,22 @@ LaserProfileSeparable::LaserProfileSeparable( LaserProfileSeparable *lp ) :
     spaceProfile_( new Profile( lp->spaceProfile_ ) ),
     phaseProfile_( new Profile( lp->phaseProfile_ ) ),
     delay_phase_( lp->delay_phase_ ),
-    axis_( lp->axis_ )
+    axis_( lp->axis_ ),
+    table_step_( lp->table_step_ )
 {
     space_envelope = NULL;
     phase = NULL;
+    createTables();
 }
 // Separable laser profile destructor
 LaserProfileSeparable::~LaserProfileSeparable()
 {
+    if( time_table_ ) {
+        delete time_table_;
+    }
+    if( chirp_table_ ) {
+        delete chirp_table_;
+    }
     if( timeProfile_ ) {
         delete timeProfile_;
     }
@@ -398,13 +529,14 @@ void LaserProfileSeparable::initFields( Params &params, Patch *patch, ElectroMag
         unsigned int dim = primal_ ? n_p : n_d;
         
         // Assign profile
-        vector<double> pos( 1 );
+        vector<double> pos( dim );
         pos[0] = patch->getDomainLocalMin( ax1 ) - ( ( primal_?0.:0.5 ) + oversize[ax1] )*d;
-        for( unsigned int j=0 ; j<dim ; j++ ) {
-            ( *space_envelope )( j, 0 ) = spaceProfile_->valueAt( pos );
-            ( *phase )( j, 0 ) = phaseProfile_->valueAt( pos );
-            pos[0] += d;
+        for( unsigned int j=1 ; j<dim ; j++ ) {
+            pos[j] = pos[j-1] + d;
         }
+        vector<double *> coordinates( 1, &pos[0] );
+        spaceProfile_->valuesAt( coordinates, dim, space_envelope->data() );
+        phaseProfile_->valuesAt( coordinates, dim, phase->data() );
         
     } else if( params.geometry=="AMcylindrical" ) {
         
@@ -414,12 +546,13 @@ void LaserProfileSeparable::initFields( Params &params, Patch *patch, ElectroMag
         unsigned int dim = nr_p + nr_d; // Need to account for both primal and dual positions
         
         // Assign profile
-        vector<double> pos( 1 );
+        vector<double> pos( dim );
         for( unsigned int j=0 ; j<dim ; j++ ) {
-            pos[0] = patch->getDomainLocalMin( 1 ) + ( j*0.5 - 0.5 - oversize[1] )*dr ; // Increment half cells
-            ( *space_envelope )( j, 0 ) = spaceProfile_->valueAt( pos );
-            ( *phase )( j, 0 ) = phaseProfile_->valueAt( pos );
+            pos[j] = patch->getDomainLocalMin( 1 ) + ( j*0.5 - 0.5 - oversize[1] )*dr ; // Increment half cells
         }
+        vector<double *> coordinates( 1, &pos[0] );
+        spaceProfile_->valuesAt( coordinates, dim, space_envelope->data() );
+        phaseProfile_->valuesAt( coordinates, dim, phase->data() );
         
     } else if( params.geometry=="3Dcartesian" ) {
         
@@ -434,31 +567,112 @@ void LaserProfileSeparable::initFields( Params &params, Patch *patch, ElectroMag
         unsigned int dim1 = primal_ ? n1_p : n1_d;
         unsigned int dim2 = primal_ ? n2_d : n2_p;
         
-        // Assign profile
-        vector<double> pos( 2 );
-        pos[0] = patch->getDomainLocalMin( ax1 ) - ( ( primal_?0.:0.5 ) + oversize[ax1] )*d1;
+        // Assign profile, with the same layout as the fields
+        vector<double> pos1( dim1*dim2 ), pos2( dim1*dim2 );
+        double p1 = patch->getDomainLocalMin( ax1 ) - ( ( primal_?0.:0.5 ) + oversize[ax1] )*d1;
         for( unsigned int j=0 ; j<dim1 ; j++ ) {
-            pos[1] = patch->getDomainLocalMin( ax2 ) - ( ( primal_?0.5:0. ) + oversize[ax2] )*d2;
+            double p2 = patch->getDomainLocalMin( ax2 ) - ( ( primal_?0.5:0. ) + oversize[ax2] )*d2;
             for( unsigned int k=0 ; k<dim2 ; k++ ) {
-                ( *space_envelope )( j, k ) = spaceProfile_->valueAt( pos );
-                ( *phase )( j, k ) = phaseProfile_->valueAt( pos );
-                pos[1] += d2;
+                pos1[j*dim2+k] = p1;
+                pos2[j*dim2+k] = p2;
+                p2 += d2;
             }
-            pos[0] += d1;
+            p1 += d1;
         }
+        vector<double *> coordinates = { &pos1[0], &pos2[0] };
+        spaceProfile_->valuesAt( coordinates, dim1*dim2, space_envelope->data() );
+        phaseProfile_->valuesAt( coordinates, dim1*dim2, phase->data() );
+    }
+}
+
+// Only the time and chirp profiles calling python are sampled: the others are cheap
+void LaserProfileSeparable::createTables()
+{
+    // Samples added by chunks, to follow the time
+    const unsigned int chunk = 512;
+    
+    time_table_ = NULL;
+    chirp_table_ = NULL;
+    if( table_step_ > 0. && timeProfile_->callsPython() ) {
+        time_table_ = new LaserTimeTable( timeProfile_, table_step_, chunk );
     }
+    if( table_step_ > 0. && chirpProfile_->callsPython() ) {
+        chirp_table_ = new LaserTimeTable( chirpProfile_, table_step_, chunk );
+    }
+    phase_extent_known_ = false;
+    phase_min_ = 0.;
+    phase_max_ = 0.;
+    time_covered_ = false;
+}
+
+double LaserProfileSeparable::omegaAt( double t )
+{
+    double omega;
+    if( chirp_table_ && chirp_table_->cover( t, t ) ) {
+        omega = omega_ * chirp_table_->valueAt( t );
+    } else {
+        omega = omega_ * chirpProfile_->valueAt( t );
+    }
+    
+    // The time envelope is required at t - ( phase + delay )/omega, for all the phases of the patch
+    if( time_table_ ) {
+        if( ! phase_extent_known_ ) {
+            phase_min_ = phase->data()[0];
+            phase_max_ = phase_min_;
+            for( unsigned int i=1; i<phase->number_of_points_; i++ ) {
+                phase_min_ = min( phase_min_, phase->data()[i] );
+                phase_max_ = max( phase_max_, phase->data()[i] );
+            }
+            phase_extent_known_ = true;
+        }
+        double t1 = t - ( phase_min_ + delay_phase_ ) / omega;
+        double t2 = t - ( phase_max_ + delay_phase_ ) / omega;
+        time_covered_ = time_table_->cover( min( t1, t2 ), max( t1, t2 ) );
+    }
+    return omega;
 }
 
 // Amplitude of a separable laser profile
 double LaserProfileSeparable::getAmplitude( std::vector<double>, double t, int j, int k )
 {
     double amp;
-    double omega = omega_ * chirpProfile_->valueAt( t );
+    double omega = omegaAt( t );
     double phi = ( *phase )( j, k );
-    amp = timeProfile_->valueAt( t-( phi+delay_phase_ )/omega ) * ( *space_envelope )( j, k ) * sin( omega*t - phi );
+    amp = timeEnvelopeAt( t-( phi+delay_phase_ )/omega ) * ( *space_envelope )( j, k ) * sin( omega*t - phi );
     return amp;
 }
 
+// Amplitudes of a separable laser profile, with a single evaluation of the frequency
+void LaserProfileSeparable::addAmplitudes( LaserPoints &points, double t, double *ret )
+{
+    double omega = omegaAt( t );
+    for( unsigned int j=points.jmin_; j<points.jmax_; j++ ) {
+        for( unsigned int k=points.kmin_; k<points.kmax_; k++ ) {
+            double phi = ( *phase )( j, k );
+            ret[j*points.stride_+k] += timeEnvelopeAt( t-( phi+delay_phase_ )/omega ) * ( *space_envelope )( j, k ) * sin( omega*t - phi );
+        }
+    }
+}
+
+// Amplitudes of a non-separable laser profile, with a single evaluation of the profile
+void LaserProfileNonSeparable::addAmplitudes( LaserPoints &points, double t, double *ret )
+{
+    unsigned int n = points.size();
+    if( n == 0 ) {
+        return;
+    }
+    vector<double> x, amplitudes( n );
+    vector<double *> coordinates;
+    points.positions( x, coordinates );
+    spaceAndTimeProfile_->valuesAt( coordinates, n, &amplitudes[0], 2, t );
+    unsigned int nk = points.kmax_ - points.kmin_;
+    for( unsigned int j=points.jmin_; j<points.jmax_; j++ ) {
+        for( unsigned int k=points.kmin_; k<points.kmax_; k++ ) {
+            ret[j*points.stride_+k] += amplitudes[( j-points.jmin_ )*nk + k-points.kmin_];
+        }
+    }
+}
+
 //Destructor
 LaserProfileNonSeparable::~LaserProfileNonSeparable()
 {
@@ -563,6 +777,30 @@ double LaserProfileFile::getAmplitude( std::vector<double> pos, double t, int j,
     return amp;
 }
 
+// Amplitudes of a laser profile from a file, with a single evaluation of the extra envelope
+void LaserProfileFile::addAmplitudes( LaserPoints &points, double t, double *ret )
+{
+    unsigned int n = points.size();
+    if( n == 0 ) {
+        return;
+    }
+    vector<double> x, envelope( n );
+    vector<double *> coordinates;
+    points.positions( x, coordinates );
+    extraProfile->valuesAt( coordinates, n, &envelope[0], 2, t );
+    unsigned int nk = points.kmax_ - points.kmin_;
+    unsigned int nomega = omega.size();
+    for( unsigned int j=points.jmin_; j<points.jmax_; j++ ) {
+        for( unsigned int k=points.kmin_; k<points.kmax_; k++ ) {
+            double amp = 0;
+            for( unsigned int i=0; i<nomega; i++ ) {
+                amp += ( *magnitude )( j, k, i ) * cos( omega[i] * t + ( *phase )( j, k, i ) );
+            }
+            ret[j*points.stride_+k] += amp * envelope[( j-points.jmin_ )*nk + k-points.kmin_];
+        }
+    }
+}
+
 //Destructor
 LaserProfileFile::~LaserProfileFile()
 {
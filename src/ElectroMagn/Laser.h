@@ -12,11 +12,83 @@
 #include <vector>
 #include <string>
 #include <cmath>
+#include <algorithm>
 
 class Params;
 class Patch;
 
 
+// Rectangle of points (j,k) of the boundary plane where the laser amplitudes are computed at once.
+// Along each axis of the plane, the coordinate of the point of index j is x0 + ( j + shift )*d,
+// and its amplitude is stored at j*stride + k.
+class LaserPoints
+{
+public:
+    //! Points along one axis of the patch (2D), primal or dual
+    LaserPoints( Patch *patch, ElectroMagn *EMfields, std::vector<double> &d,
+                 unsigned int axis1, bool dual1, unsigned int jmin, unsigned int jmax );
+    //! Points along two axes of the patch (3D), primal or dual
+    LaserPoints( Patch *patch, ElectroMagn *EMfields, std::vector<double> &d,
+                 unsigned int axis1, bool dual1, unsigned int jmin, unsigned int jmax,
+                 unsigned int axis2, bool dual2, unsigned int kmin, unsigned int kmax, unsigned int stride );
+    
+    //! Coordinate of the point of index j along the axis i of the plane
+    inline double position( unsigned int i, unsigned int j )
+    {
+        return x0_[i] + ( j + shift_[i] ) * d_[i];
+    };
+    
+    //! Number of points
+    inline unsigned int size()
+    {
+        return ( jmax_ - jmin_ ) * ( kmax_ - kmin_ );
+    };
+    
+    //! Coordinates of all the points, in arrays of size() elements
+    void positions( std::vector<double> &x, std::vector<double *> &coordinates );
+    
+    //! Number of axes of the plane
+    unsigned int ndim_;
+    //! Ranges of indices
+    unsigned int jmin_, jmax_, kmin_, kmax_;
+    //! Distance between the first index of a row and the next
+    unsigned int stride_;
+private:
+    double x0_[2], shift_[2], d_[2];
+};
+
+
+// Samples of a time profile on a regular grid t = i*step, over a window which is moved
+// and extended by chunks when the requested times leave it, and linear interpolation
+class LaserTimeTable
+{
+public:
+    LaserTimeTable( Profile *profile, double step, unsigned int chunk )
+        : profile_( profile ), step_( step ), chunk_( chunk ), first_( 0 ) {};
+    
+    //! Make sure that the samples cover [tmin, tmax]. Returns false if the interval is too large.
+    bool cover( double tmin, double tmax );
+    
+    //! Value at time t, which must be covered
+    inline double valueAt( double t )
+    {
+        double x = t / step_ - first_;
+        int i = std::min( std::max( ( int ) std::floor( x ), 0 ), ( int ) values_.size() - 2 );
+        double w = x - i;
+        return ( 1. - w ) * values_[i] + w * values_[i+1];
+    };
+    
+private:
+    Profile *profile_;
+    double step_;
+    //! Number of samples added beyond the requested times
+    unsigned int chunk_;
+    //! Index of the first sample
+    long first_;
+    std::vector<double> values_;
+};
+
+
 // Class for choosing specific profiles
 class LaserProfile
 {
@@ -25,6 +97,8 @@ public:
     LaserProfile() {};
     virtual ~LaserProfile() {};
     virtual double getAmplitude( std::vector<double> pos, double t, int j, int k ) = 0;
+    //! Adds the amplitudes at all the points to ret
+    virtual void addAmplitudes( LaserPoints &points, double t, double *ret );
     virtual std::complex<double> getAmplitudecomplex( std::vector<double>, double, int, int )
     {
         return 0.;
@@ -66,6 +140,17 @@ public:
         return profiles[1]->getAmplitude( pos, t, j, k );
     }
 
+    //! Adds the amplitudes (By) at all the points to ret
+    inline void addAmplitudes0( LaserPoints &points, double t, double *ret )
+    {
+        profiles[0]->addAmplitudes( points, t, ret );
+    }
+    //! Adds the amplitudes (Bz) at all the points to ret
+    inline void addAmplitudes1( LaserPoints &points, double t, double *ret )
+    {
+        profiles[1]->addAmplitudes( points, t, ret );
+    }
+
     inline std::complex<double> getAmplitudecomplexN( std::vector<double> pos, double t, int j, int k, int imode )
     {
         return profiles[imode]->getAmplitudecomplex( pos, t, j, k );
@@ -110,12 +195,13 @@ class LaserProfileSeparable : public LaserProfile
     friend class SmileiMPI;
     friend class Patch;
 public:
-    LaserProfileSeparable( double, Profile *, Profile *, Profile *, Profile *, double, bool, unsigned int );
+    LaserProfileSeparable( double, Profile *, Profile *, Profile *, Profile *, double, bool, unsigned int, double );
     LaserProfileSeparable( LaserProfileSeparable * );
     ~LaserProfileSeparable();
     void createFields( Params &params, Patch *patch, ElectroMagn *EMfields ) override;
     void initFields( Params &params, Patch *patch, ElectroMagn *EMfields ) override;
     double getAmplitude( std::vector<double> pos, double t, int j, int k ) override;
+    void addAmplitudes( LaserPoints &points, double t, double *ret ) override;
 protected:
     Field *space_envelope, *phase;
 private:
@@ -124,6 +210,26 @@ private:
     Profile *timeProfile_, *chirpProfile_, *spaceProfile_, *phaseProfile_;
     double delay_phase_;
     unsigned int axis_;
+    
+    //! Time between the samples of the python time and chirp profiles (0 if not sampled)
+    double table_step_;
+    //! Samples of the time and chirp profiles (NULL if evaluated directly)
+    LaserTimeTable *time_table_, *chirp_table_;
+    //! Extent of the phase in this patch (computed at the first use)
+    bool phase_extent_known_;
+    double phase_min_, phase_max_;
+    //! Whether the samples of the time profile cover the current times
+    bool time_covered_;
+    
+    //! Frequency at time t, and preparation of the time envelope at all the phases
+    double omegaAt( double t );
+    //! Time envelope
+    inline double timeEnvelopeAt( double t )
+    {
+        return time_covered_ ? time_table_->valueAt( t ) : timeProfile_->valueAt( t );
+    };
+    //! Create the samples of the python profiles
+    void createTables();
 };
 
 // Laser profile for non-separable space and time
@@ -149,6 +255,8 @@ public:
         amp = spaceAndTimeProfile_->complexValueAt( pos, t );
         return amp;
     }
+    
+    void addAmplitudes( LaserPoints &points, double t, double *ret ) override;
 
 private:
     Profile *spaceAndTimeProfile_;
@@ -168,6 +276,7 @@ public:
     void createFields( Params &params, Patch *patch, ElectroMagn *EMfields ) override;
     void initFields( Params &params, Patch *patch, ElectroMagn *EMfields ) override;
     double getAmplitude( std::vector<double> pos, double t, int j, int k ) override;
+    void addAmplitudes( LaserPoints &points, double t, double *ret ) override;
 protected:
     Field3D *magnitude, *phase;
     std::vector<double> omega;
@@ -189,6 +298,10 @@ public:
     {
         return 0.;
     }
+    
+    inline void addAmplitudes( LaserPoints &, double, double * ) override
+    {
+    }
 };
 
 
@@ -268,32 +268,26 @@ void ElectroMagnBC2D_PML::apply( ElectroMagn *EMfields, double time_dual, Patch
         pml_solver_->compute_H_from_B( EMfields, iDim, min_or_max, dimPrim, solvermin, solvermax);
 
         //Injecting a laser
-        vector<double> yp( 1 );
+        vector<double> byW( n_p[1], 0. );
+        LaserPoints byW_points( patch, EMfields, d, 1, false, patch->isYmin(), n_p[1]-patch->isYmax() );
+        // Lasers
+        for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
+            vecLaser[ilaser]->addAmplitudes0( byW_points, time_dual, &byW[0] );
+        }
         for( unsigned int j=patch->isYmin() ; j<n_p[1]-patch->isYmax() ; j++ ) {
-
-            double byW = 0.;
-            yp[0] = patch->getDomainLocalMin( 1 ) + ( ( int )j - ( int )EMfields->oversize[1] )*d[1];
-
-            // Lasers
-            for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
-                byW += vecLaser[ilaser]->getAmplitude0( yp, time_dual, j, 0 );
-            }
-            (*Hy_)( ncells_pml_domain-domain_oversize_x-nsolver/2, j ) += factor_laser_space_time*factor_laser_angle_W*byW ;
-            (*By_)( ncells_pml_domain-domain_oversize_x-nsolver/2, j ) += factor_laser_space_time*factor_laser_angle_W*byW ;
+            (*Hy_)( ncells_pml_domain-domain_oversize_x-nsolver/2, j ) += factor_laser_space_time*factor_laser_angle_W*byW[j] ;
+            (*By_)( ncells_pml_domain-domain_oversize_x-nsolver/2, j ) += factor_laser_space_time*factor_laser_angle_W*byW[j] ;
         }
 
-        vector<double> yd( 1 );
+        vector<double> bzW( n_d[1], 0. );
+        LaserPoints bzW_points( patch, EMfields, d, 1, true, patch->isYmin(), n_d[1]-patch->isYmax() );
+        // Lasers
+        for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
+            vecLaser[ilaser]->addAmplitudes1( bzW_points, time_dual, &bzW[0] );
+        }
         for( unsigned int j=patch->isYmin() ; j<n_d[1]-patch->isYmax() ; j++ ) {
-
-            double bzW = 0.;
-            yd[0] = patch->getDomainLocalMin( 1 ) + ( ( int )j - 0.5 - ( int )EMfields->oversize[1] )*d[1];
-
-            // Lasers
-            for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
-                bzW += vecLaser[ilaser]->getAmplitude1( yd, time_dual, j, 0 );
-            }
-            (*Hz_)( ncells_pml_domain-domain_oversize_x-nsolver/2, j ) += factor_laser_space_time*factor_laser_angle_W*bzW ;
-            (*Bz_)( ncells_pml_domain-domain_oversize_x-nsolver/2, j ) += factor_laser_space_time*factor_laser_angle_W*bzW ;
+            (*Hz_)( ncells_pml_domain-domain_oversize_x-nsolver/2, j ) += factor_laser_space_time*factor_laser_angle_W*bzW[j] ;
+            (*Bz_)( ncells_pml_domain-domain_oversize_x-nsolver/2, j ) += factor_laser_space_time*factor_laser_angle_W*bzW[j] ;
         }
 
         // 4. Exchange PML -> Domain
@@ -350,32 +344,26 @@ void ElectroMagnBC2D_PML::apply( ElectroMagn *EMfields, double time_dual, Patch
         pml_solver_->compute_H_from_B( EMfields, iDim, min_or_max, dimPrim, solvermin, solvermax);
 
         //Injecting a laser
-        vector<double> yp( 1 );
+        vector<double> byE( n_p[1], 0. );
+        LaserPoints byE_points( patch, EMfields, d, 1, false, patch->isYmin(), n_p[1]-patch->isYmax() );
+        // Lasers
+        for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
+            vecLaser[ilaser]->addAmplitudes0( byE_points, time_dual, &byE[0] );
+        }
         for( unsigned int j=patch->isYmin() ; j<n_p[1]-patch->isYmax() ; j++ ) {
-
-            double byE = 0.;
-            yp[0] = patch->getDomainLocalMin( 1 ) + ( ( int )j - ( int )EMfields->oversize[1] )*d[1];
-
-            // Lasers
-            for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
-                byE += vecLaser[ilaser]->getAmplitude0( yp, time_dual, j, 0 );
-            }
-            (*Hy_)( domain_oversize_x+nsolver/2, j ) += factor_laser_space_time*factor_laser_angle_E*byE ;
-            (*By_)( domain_oversize_x+nsolver/2, j ) += factor_laser_space_time*factor_laser_angle_E*byE ;
+            (*Hy_)( domain_oversize_x+nsolver/2, j ) += factor_laser_space_time*factor_laser_angle_E*byE[j] ;
+            (*By_)( domain_oversize_x+nsolver/2, j ) += factor_laser_space_time*factor_laser_angle_E*byE[j] ;
         }
 
-        vector<double> yd( 1 );
+        vector<double> bzE( n_d[1], 0. );
+        LaserPoints bzE_points( patch, EMfields, d, 1, true, patch->isYmin(), n_d[1]-patch->isYmax() );
+        // Lasers
+        for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
+            vecLaser[ilaser]->addAmplitudes1( bzE_points, time_dual, &bzE[0] );
+        }
         for( unsigned int j=patch->isYmin() ; j<n_d[1]-patch->isYmax() ; j++ ) {
-
-            double bzE = 0.;
-            yd[0] = patch->getDomainLocalMin( 1 ) + ( ( int )j - 0.5 - ( int )EMfields->oversize[1] )*d[1];
-
-            // Lasers
-            for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
-                bzE += vecLaser[ilaser]->getAmplitude1( yd, time_dual, j, 0 );
-            }
-            (*Hz_)( domain_oversize_x+nsolver/2, j ) += factor_laser_space_time*factor_laser_angle_E*bzE ;
-            (*Bz_)( domain_oversize_x+nsolver/2, j ) += factor_laser_space_time*factor_laser_angle_E*bzE ;
+            (*Hz_)( domain_oversize_x+nsolver/2, j ) += factor_laser_space_time*factor_laser_angle_E*bzE[j] ;
+            (*Bz_)( domain_oversize_x+nsolver/2, j ) += factor_laser_space_time*factor_laser_angle_E*bzE[j] ;
         }
 
         // 4. Exchange Domain -> PML
@@ -542,32 +530,26 @@ void ElectroMagnBC2D_PML::apply( ElectroMagn *EMfields, double time_dual, Patch
         pml_solver_->compute_H_from_B( EMfields, iDim, min_or_max, dimPrim, solvermin, solvermax);
 
         //Injecting a laser
-        vector<double> xp( 1 );
+        vector<double> bxS( n_p[0], 0. );
+        LaserPoints bxS_points( patch, EMfields, d, 0, false, patch->isXmin(), n_p[0]-patch->isXmax() );
+        // Lasers
+        for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
+            vecLaser[ilaser]->addAmplitudes0( bxS_points, time_dual, &bxS[0] );
+        }
         for( unsigned int i=patch->isXmin() ; i<n_p[0]-patch->isXmax() ; i++ ) {
-
-            double bxS = 0.;
-            xp[0] = patch->getDomainLocalMin( 0 ) + ( ( int )i - ( int )EMfields->oversize[0] )*d[0];
-
-            // Lasers
-            for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
-                bxS += vecLaser[ilaser]->getAmplitude0( xp, time_dual, i, 0 );
-            }
-            (*Hx_)( ncells_pml_xmin+i, ncells_pml_domain-domain_oversize_y-nsolver/2 ) += factor_laser_space_time*factor_laser_angle_S*bxS ;
-            (*Bx_)( ncells_pml_xmin+i, ncells_pml_domain-domain_oversize_y-nsolver/2 ) += factor_laser_space_time*factor_laser_angle_S*bxS ;
+            (*Hx_)( ncells_pml_xmin+i, ncells_pml_domain-domain_oversize_y-nsolver/2 ) += factor_laser_space_time*factor_laser_angle_S*bxS[i] ;
+            (*Bx_)( ncells_pml_xmin+i, ncells_pml_domain-domain_oversize_y-nsolver/2 ) += factor_laser_space_time*factor_laser_angle_S*bxS[i] ;
         }
 
-        vector<double> xd( 1 );
+        vector<double> bzS( n_d[0], 0. );
+        LaserPoints bzS_points( patch, EMfields, d, 0, true, patch->isXmin(), n_d[0]-patch->isXmax() );
+        // Lasers
+        for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
+            vecLaser[ilaser]->addAmplitudes1( bzS_points, time_dual, &bzS[0] );
+        }
         for( unsigned int i=patch->isXmin() ; i<n_d[0]-patch->isXmax() ; i++ ) {
-            
-            double bzS = 0.;
-            xd[0] = patch->getDomainLocalMin( 0 ) + ( ( int )i - 0.5 - ( int )EMfields->oversize[0] )*d[0];
-            
-            // Lasers
-            for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
-                bzS += vecLaser[ilaser]->getAmplitude1( xd, time_dual, i, 0 );
-            }
-            (*Hz_)( ncells_pml_xmin+i, ncells_pml_domain-domain_oversize_y-nsolver/2 ) += factor_laser_space_time*factor_laser_angle_S*bzS ;
-            (*Bz_)( ncells_pml_xmin+i, ncells_pml_domain-domain_oversize_y-nsolver/2 ) += factor_laser_space_time*factor_laser_angle_S*bzS ;
+            (*Hz_)( ncells_pml_xmin+i, ncells_pml_domain-domain_oversize_y-nsolver/2 ) += factor_laser_space_time*factor_laser_angle_S*bzS[i] ;
+            (*Bz_)( ncells_pml_xmin+i, ncells_pml_domain-domain_oversize_y-nsolver/2 ) += factor_laser_space_time*factor_laser_angle_S*bzS[i] ;
         }
 
         // 4. Exchange PML -> Domain
@@ -814,32 +796,26 @@ void ElectroMagnBC2D_PML::apply( ElectroMagn *EMfields, double time_dual, Patch
         pml_solver_->compute_H_from_B( EMfields, iDim, min_or_max, dimPrim, solvermin, solvermax);
 
         //Injecting a laser
-        vector<double> xp( 1 );
+        vector<double> bxN( n_p[0], 0. );
+        LaserPoints bxN_points( patch, EMfields, d, 0, false, patch->isXmin(), n_p[0]-patch->isXmax() );
+        // Lasers
+        for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
+            vecLaser[ilaser]->addAmplitudes0( bxN_points, time_dual, &bxN[0] );
+        }
         for( unsigned int i=patch->isXmin() ; i<n_p[0]-patch->isXmax() ; i++ ) {
-
-            double bxN = 0.;
-            xp[0] = patch->getDomainLocalMin( 0 ) + ( ( int )i - ( int )EMfields->oversize[0] )*d[0];
-
-            // Lasers
-            for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
-                bxN += vecLaser[ilaser]->getAmplitude0( xp, time_dual, i, 0 );
-            }
-            (*Hx_)( ncells_pml_xmin+i , domain_oversize_y+nsolver/2 ) += factor_laser_space_time*factor_laser_angle_N*bxN ;
-            (*Bx_)( ncells_pml_xmin+i , domain_oversize_y+nsolver/2 ) += factor_laser_space_time*factor_laser_angle_N*bxN ;
+            (*Hx_)( ncells_pml_xmin+i , domain_oversize_y+nsolver/2 ) += factor_laser_space_time*factor_laser_angle_N*bxN[i] ;
+            (*Bx_)( ncells_pml_xmin+i , domain_oversize_y+nsolver/2 ) += factor_laser_space_time*factor_laser_angle_N*bxN[i] ;
         }
 
-        vector<double> xd( 1 );
+        vector<double> bzN( n_d[0], 0. );
+        LaserPoints bzN_points( patch, EMfields, d, 0, true, patch->isXmin(), n_d[0]-patch->isXmax() );
+        // Lasers
+        for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
+            vecLaser[ilaser]->addAmplitudes1( bzN_points, time_dual, &bzN[0] );
+        }
         for( unsigned int i=patch->isXmin() ; i<n_d[0]-patch->isXmax() ; i++ ) {
-
-            double bzN = 0.;
-            xd[0] = patch->getDomainLocalMin( 0 ) + ( ( int )i - 0.5 - ( int )EMfields->oversize[0] )*d[0];
-
-            // Lasers
-            for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
-                bzN += vecLaser[ilaser]->getAmplitude1( xd, time_dual, i, 0 );
-            }
-            (*Hz_)( ncells_pml_xmin+i, domain_oversize_y+nsolver/2 ) += factor_laser_space_time*factor_laser_angle_N*bzN ;
-            (*Bz_)( ncells_pml_xmin+i, domain_oversize_y+nsolver/2 ) += factor_laser_space_time*factor_laser_angle_N*bzN ;
+            (*Hz_)( ncells_pml_xmin+i, domain_oversize_y+nsolver/2 ) += factor_laser_space_time*factor_laser_angle_N*bzN[i] ;
+            (*Bz_)( ncells_pml_xmin+i, domain_oversize_y+nsolver/2 ) += factor_laser_space_time*factor_laser_angle_N*bzN[i] ;
         }
 
         // 4. Exchange PML -> Domain
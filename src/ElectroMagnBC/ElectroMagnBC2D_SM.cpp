@@ -170,14 +170,11 @@ void ElectroMagnBC2D_SM::apply( ElectroMagn *EMfields, double time_dual, Patch *
 
         const int b1_size = n1p ;
         const int b2_size = n1d ;
-        std::vector<double> pos( 1 );
 
         if( ! vecLaser.empty() ) {
-            for( unsigned int j=isBoundary1min ; j<n1p-isBoundary1max ; j++ ) {
-                pos[0] = patch->getDomainLocalMin( axis1_ ) + ( ( int )j - ( int )EMfields->oversize[axis1_] )*d[axis1_];
-                for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
-                    db1[j] += vecLaser[ilaser]->getAmplitude0( pos, time_dual, j, 0 );
-                }
+            LaserPoints points( patch, EMfields, d, axis1_, false, isBoundary1min, n1p-isBoundary1max );
+            for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
+                vecLaser[ilaser]->addAmplitudes0( points, time_dual, db1 );
             }
         }
         smilei::tools::gpu::HostDeviceMemoryManagement::DeviceAllocateAndCopyHostToDevice( db1, b1_size );
@@ -224,11 +221,9 @@ void ElectroMagnBC2D_SM::apply( ElectroMagn *EMfields, double time_dual, Patch *
         double *const __restrict__ db2 = b2.data();
 
         if( ! vecLaser.empty() ) {
-            for( unsigned int j=isBoundary1min; j<n1d-isBoundary1max ; j++ ) {
-                pos[0] = patch->getDomainLocalMin( axis1_ ) + ( ( int )j - 0.5 - ( int )EMfields->oversize[axis1_] )*d[axis1_];
-                for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
-                    db2[j] += vecLaser[ilaser]->getAmplitude1( pos, time_dual, j, 0 );
-                }
+            LaserPoints points( patch, EMfields, d, axis1_, true, isBoundary1min, n1d-isBoundary1max );
+            for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
+                vecLaser[ilaser]->addAmplitudes1( points, time_dual, db2 );
             }
         }
         smilei::tools::gpu::HostDeviceMemoryManagement::DeviceAllocateAndCopyHostToDevice( db2, b2_size );
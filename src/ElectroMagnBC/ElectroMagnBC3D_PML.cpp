@@ -292,8 +292,6 @@ void ElectroMagnBC3D_PML::apply( ElectroMagn *EMfields, double time_dual, Patch
     Field3D *By_domain = static_cast<Field3D *>( EMfields->By_ );
     Field3D *Bz_domain = static_cast<Field3D *>( EMfields->Bz_ );
 
-    vector<double> pos( 2 );
-
     if( ! patch->isBoundary( i_boundary_ ) ) return;
 
     if( i_boundary_ == 0 ) {
@@ -339,28 +337,28 @@ void ElectroMagnBC3D_PML::apply( ElectroMagn *EMfields, double time_dual, Patch
 
         //Injecting a laser
         vector<double> by( n_p[1]*n_d[2], 0. );
+        LaserPoints by_points( patch, EMfields, d, 1, false, patch->isYmin(), n_p[1]-patch->isYmax(),
+                               2, true, patch->isZmin(), n_d[2]-patch->isZmax(), n_d[2] );
+        // Lasers
+        for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
+            vecLaser[ilaser]->addAmplitudes0( by_points, time_dual, &by[0] );
+        }
         for( unsigned int j=patch->isYmin() ; j<n_p[1]-patch->isYmax() ; j++ ) {
-            pos[0] = patch->getDomainLocalMin( 1 ) + ( ( int )j - ( int )EMfields->oversize[1] )*d[1];
             for( unsigned int k=patch->isZmin() ; k<n_d[2]-patch->isZmax() ; k++ ) {
-                pos[1] = patch->getDomainLocalMin( 2 ) + ( ( int )k - 0.5 - ( int )EMfields->oversize[2] )*d[2];
-                // Lasers
-                for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
-                    by[ j*n_d[2]+k ] += vecLaser[ilaser]->getAmplitude0( pos, time_dual, j, k );
-                }
                 (*Hy_)( ncells_pml_domain-domain_oversize_x-nsolver/2, j , k ) += factor_laser_angle_W*by[j*n_d[2]+k] ;
                 (*By_)( ncells_pml_domain-domain_oversize_x-nsolver/2, j , k ) += factor_laser_angle_W*by[j*n_d[2]+k] ;
             }
         }
 
         vector<double> bz( n_d[1]*n_p[2], 0. );
+        LaserPoints bz_points( patch, EMfields, d, 1, true, patch->isYmin(), n_d[1]-patch->isYmax(),
+                               2, false, patch->isZmin(), n_p[2]-patch->isZmax(), n_p[2] );
+        // Lasers
+        for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
+            vecLaser[ilaser]->addAmplitudes1( bz_points, time_dual, &bz[0] );
+        }
         for( unsigned int j=patch->isYmin() ; j<n_d[1]-patch->isYmax() ; j++ ) {
-            pos[0] = patch->getDomainLocalMin( 1 ) + ( ( int )j - 0.5 - ( int )EMfields->oversize[1] )*d[1];
             for( unsigned int k=patch->isZmin() ; k<n_p[2]-patch->isZmax() ; k++ ) {
-                pos[1] = patch->getDomainLocalMin( 2 ) + ( ( int )k - ( int )EMfields->oversize[2] )*d[2];
-                // Lasers
-                for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
-                    bz[ j*n_p[2]+k] += vecLaser[ilaser]->getAmplitude1( pos, time_dual, j, k );
-                }
                 (*Hz_)( ncells_pml_domain-domain_oversize_x-nsolver/2, j , k) += factor_laser_angle_W*bz[ j*n_p[2]+k ] ;
                 (*Bz_)( ncells_pml_domain-domain_oversize_x-nsolver/2, j , k) += factor_laser_angle_W*bz[ j*n_p[2]+k ] ;
             }
@@ -442,28 +440,28 @@ void ElectroMagnBC3D_PML::apply( ElectroMagn *EMfields, double time_dual, Patch
 
         //Injecting a laser
         vector<double> by( n_p[1]*n_d[2], 0. );
+        LaserPoints by_points( patch, EMfields, d, 1, false, patch->isYmin(), n_p[1]-patch->isYmax(),
+                               2, true, patch->isZmin(), n_d[2]-patch->isZmax(), n_d[2] );
+        // Lasers
+        for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
+            vecLaser[ilaser]->addAmplitudes0( by_points, time_dual, &by[0] );
+        }
         for( unsigned int j=patch->isYmin() ; j<n_p[1]-patch->isYmax() ; j++ ) {
-            pos[0] = patch->getDomainLocalMin( 1 ) + ( ( int )j - ( int )EMfields->oversize[1] )*d[1];
             for( unsigned int k=patch->isZmin() ; k<n_d[2]-patch->isZmax() ; k++ ) {
-                pos[1] = patch->getDomainLocalMin( 2 ) + ( ( int )k - 0.5 - ( int )EMfields->oversize[2] )*d[2];
-                // Lasers
-                for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
-                    by[ j*n_d[2]+k ] += vecLaser[ilaser]->getAmplitude0( pos, time_dual, j, k );
-                }
                 (*Hy_)( domain_oversize_x+nsolver/2, j, k ) += factor_laser_angle_E*by[j*n_d[2]+k] ;
                 (*By_)( domain_oversize_x+nsolver/2, j, k ) += factor_laser_angle_E*by[j*n_d[2]+k] ;
             }
         }
 
         vector<double> bz( n_d[1]*n_p[2], 0. );
+        LaserPoints bz_points( patch, EMfields, d, 1, true, patch->isYmin(), n_d[1]-patch->isYmax(),
+                               2, false, patch->isZmin(), n_p[2]-patch->isZmax(), n_p[2] );
+        // Lasers
+        for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
+            vecLaser[ilaser]->addAmplitudes1( bz_points, time_dual, &bz[0] );
+        }
         for( unsigned int j=patch->isYmin() ; j<n_d[1]-patch->isYmax() ; j++ ) {
-            pos[0] = patch->getDomainLocalMin( 1 ) + ( ( int )j - 0.5 - ( int )EMfields->oversize[1] )*d[1];
             for( unsigned int k=patch->isZmin() ; k<n_p[2]-patch->isZmax() ; k++ ) {
-                pos[1] = patch->getDomainLocalMin( 2 ) + ( ( int )k - ( int )EMfields->oversize[2] )*d[2];
-                // Lasers
-                for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
-                    bz[ j*n_p[2]+k] += vecLaser[ilaser]->getAmplitude1( pos, time_dual, j, k );
-                }
                 (*Hz_)( domain_oversize_x+nsolver/2, j, k ) += factor_laser_angle_E*bz[ j*n_p[2]+k ] ;
                 (*Bz_)( domain_oversize_x+nsolver/2, j, k ) += factor_laser_angle_E*bz[ j*n_p[2]+k ] ;
             }
@@ -670,28 +668,28 @@ void ElectroMagnBC3D_PML::apply( ElectroMagn *EMfields, double time_dual, Patch
 
         //Injecting a laser
         vector<double> bx( n_p[0]*n_d[2], 0. );
+        LaserPoints bx_points( patch, EMfields, d, 0, false, patch->isXmin(), n_p[0]-patch->isXmax(),
+                               2, true, patch->isZmin(), n_d[2]-patch->isZmax(), n_d[2] );
+        // Lasers
+        for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
+            vecLaser[ilaser]->addAmplitudes0( bx_points, time_dual, &bx[0] );
+        }
         for( unsigned int i=patch->isXmin() ; i<n_p[0]-patch->isXmax() ; i++ ) {
-            pos[0] = patch->getDomainLocalMin( 0 ) + ( ( int )i - ( int )EMfields->oversize[0] )*d[0];
             for( unsigned int k=patch->isZmin() ; k<n_d[2]-patch->isZmax() ; k++ ) {
-                pos[1] = patch->getDomainLocalMin( 2 ) + ( ( int )k -0.5 - ( int )EMfields->oversize[2] )*d[2];
-                // Lasers
-                for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
-                    bx[ i*n_d[2]+k ] += vecLaser[ilaser]->getAmplitude0( pos, time_dual, i, k );
-                }
                 (*Hx_)( ncells_pml_xmin+i, ncells_pml_domain-domain_oversize_y-nsolver/2, k ) += factor_laser_angle_S*bx[ i*n_d[2]+k ] ;
                 (*Bx_)( ncells_pml_xmin+i, ncells_pml_domain-domain_oversize_y-nsolver/2, k ) += factor_laser_angle_S*bx[ i*n_d[2]+k ] ;
             }
         }
 
         vector<double> bz( n_d[0]*n_p[2], 0. );
+        LaserPoints bz_points( patch, EMfields, d, 0, true, patch->isXmin(), n_d[0]-patch->isXmax(),
+                               2, false, patch->isZmin(), n_p[2]-patch->isZmax(), n_p[2] );
+        // Lasers
+        for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
+            vecLaser[ilaser]->addAmplitudes1( bz_points, time_dual, &bz[0] );
+        }
         for( unsigned int i=patch->isXmin() ; i<n_d[0]-patch->isXmax() ; i++ ) {
-            pos[0] = patch->getDomainLocalMin( 0 ) + ( ( int )i -0.5 - ( int )EMfields->oversize[0] )*d[0];
             for( unsigned int k=patch->isZmin() ; k<n_p[2]-patch->isZmax() ; k++ ) {
-                pos[1] = patch->getDomainLocalMin( 2 ) + ( ( int )k - ( int )EMfields->oversize[2] )*d[2];
-                // Lasers
-                for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
-                    bz[ i*n_p[2]+k ] += vecLaser[ilaser]->getAmplitude1( pos, time_dual, i, k );
-                }
                 (*Hz_)( ncells_pml_xmin+i, ncells_pml_domain-domain_oversize_y-nsolver/2, k ) += factor_laser_angle_S*bz[ i*n_p[2]+k ] ;
                 (*Bz_)( ncells_pml_xmin+i, ncells_pml_domain-domain_oversize_y-nsolver/2, k ) += factor_laser_angle_S*bz[ i*n_p[2]+k ] ;
             }
@@ -1000,28 +998,28 @@ void ElectroMagnBC3D_PML::apply( ElectroMagn *EMfields, double time_dual, Patch
 
         //Injecting a laser
         vector<double> bx( n_p[0]*n_d[2], 0. );
+        LaserPoints bx_points( patch, EMfields, d, 0, false, patch->isXmin(), n_p[0]-patch->isXmax(),
+                               2, true, patch->isZmin(), n_d[2]-patch->isZmax(), n_d[2] );
+        // Lasers
+        for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
+            vecLaser[ilaser]->addAmplitudes0( bx_points, time_dual, &bx[0] );
+        }
         for( unsigned int i=patch->isXmin() ; i<n_p[0]-patch->isXmax() ; i++ ) {
-            pos[0] = patch->getDomainLocalMin( 0 ) + ( ( int )i - ( int )EMfields->oversize[0] )*d[0];
             for( unsigned int k=patch->isZmin() ; k<n_d[2]-patch->isZmax() ; k++ ) {
-                pos[1] = patch->getDomainLocalMin( 2 ) + ( ( int )k -0.5 - ( int )EMfields->oversize[2] )*d[2];
-                // Lasers
-                for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
-                    bx[ i*n_d[2]+k ] += vecLaser[ilaser]->getAmplitude0( pos, time_dual, i, k );
-                }
                 (*Hx_)( ncells_pml_xmin+i , domain_oversize_y+nsolver/2, k ) += factor_laser_angle_N*bx[ i*n_d[2]+k ] ;
                 (*Bx_)( ncells_pml_xmin+i , domain_oversize_y+nsolver/2, k ) += factor_laser_angle_N*bx[ i*n_d[2]+k ] ;
             }
         }
 
         vector<double> bz( n_d[0]*n_p[2], 0. );
+        LaserPoints bz_points( patch, EMfields, d, 0, true, patch->isXmin(), n_d[0]-patch->isXmax(),
+                               2, false, patch->isZmin(), n_p[2]-patch->isZmax(), n_p[2] );
+        // Lasers
+        for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
+            vecLaser[ilaser]->addAmplitudes1( bz_points, time_dual, &bz[0] );
+        }
         for( unsigned int i=patch->isXmin() ; i<n_d[0]-patch->isXmax() ; i++ ) {
-            pos[0] = patch->getDomainLocalMin( 0 ) + ( ( int )i -0.5 - ( int )EMfields->oversize[0] )*d[0];
             for( unsigned int k=patch->isZmin() ; k<n_p[2]-patch->isZmax() ; k++ ) {
-                pos[1] = patch->getDomainLocalMin( 2 ) + ( ( int )k - ( int )EMfields->oversize[2] )*d[2];
-                // Lasers
-                for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
-                    bz[ i*n_p[2]+k ] += vecLaser[ilaser]->getAmplitude1( pos, time_dual, i, k );
-                }
                 (*Hz_)( ncells_pml_xmin+i, domain_oversize_y+nsolver/2, k ) += factor_laser_angle_N*bz[ i*n_p[2]+k ] ;
                 (*Bz_)( ncells_pml_xmin+i, domain_oversize_y+nsolver/2, k ) += factor_laser_angle_N*bz[ i*n_p[2]+k ] ;
             }
@@ -1494,28 +1492,28 @@ void ElectroMagnBC3D_PML::apply( ElectroMagn *EMfields, double time_dual, Patch
 
         //Injecting a laser
         vector<double> bx( n_p[0]*n_d[1], 0. ); // Bx(p,d,d)
+        LaserPoints bx_points( patch, EMfields, d, 0, false, patch->isXmin(), n_p[0]-patch->isXmax(),
+                               1, true, patch->isYmin(), n_d[1]-patch->isYmax(), n_d[1] );
+        // Lasers
+        for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
+            vecLaser[ilaser]->addAmplitudes0( bx_points, time_dual, &bx[0] );
+        }
         for( unsigned int i=patch->isXmin() ; i<n_p[0]-patch->isXmax() ; i++ ) {
-            pos[0] = patch->getDomainLocalMin( 0 ) + ( ( int )i - ( int )EMfields->oversize[0] )*d[0];
             for( unsigned int j=patch->isYmin() ; j<n_d[1]-patch->isYmax() ; j++ ) {
-                pos[1] = patch->getDomainLocalMin( 1 ) + ( ( int )j - 0.5 - ( int )EMfields->oversize[1] )*d[1];
-                // Lasers
-                for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
-                    bx[ i*n_d[1]+j ] += vecLaser[ilaser]->getAmplitude0( pos, time_dual, i, j );
-                }
                 (*Hx_)( ncells_pml_xmin+i, ncells_pml_ymin+j, ncells_pml_domain-domain_oversize_z-nsolver/2 ) += factor_laser_angle_B*bx[ i*n_d[1]+j ] ;
                 (*Bx_)( ncells_pml_xmin+i, ncells_pml_ymin+j, ncells_pml_domain-domain_oversize_z-nsolver/2 ) += factor_laser_angle_B*bx[ i*n_d[1]+j ] ;
             }
         }
 
         vector<double> by( n_d[0]*n_p[1], 0. ); // By(d,p,d)
+        LaserPoints by_points( patch, EMfields, d, 0, true, patch->isXmin(), n_d[0]-patch->isXmax(),
+                               1, false, patch->isYmin(), n_p[1]-patch->isYmax(), n_p[1] );
+        // Lasers
+        for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
+            vecLaser[ilaser]->addAmplitudes1( by_points, time_dual, &by[0] );
+        }
         for( unsigned int i=patch->isXmin() ; i<n_d[0]-patch->isXmax() ; i++ ) {
-            pos[0] = patch->getDomainLocalMin( 0 ) + ( ( int )i -0.5 - ( int )EMfields->oversize[0] )*d[0];
             for( unsigned int j=patch->isYmin() ; j<n_p[1]-patch->isYmax() ; j++ ) {
-                pos[1] = patch->getDomainLocalMin( 1 ) + ( ( int )j - ( int )EMfields->oversize[1] )*d[1];
-                // Lasers
-                for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
-                    by[ i*n_p[1]+j ] += vecLaser[ilaser]->getAmplitude1( pos, time_dual, i, j );
-                }
                 (*Hy_)( ncells_pml_xmin+i, ncells_pml_ymin+j, ncells_pml_domain-domain_oversize_z-nsolver/2 ) += factor_laser_angle_B*by[ i*n_p[1]+j ] ;
                 (*By_)( ncells_pml_xmin+i, ncells_pml_ymin+j, ncells_pml_domain-domain_oversize_z-nsolver/2 ) += factor_laser_angle_B*by[ i*n_p[1]+j ] ;
             }
@@ -2081,28 +2079,28 @@ void ElectroMagnBC3D_PML::apply( ElectroMagn *EMfields, double time_dual, Patch
 
         //Injecting a laser
         vector<double> bx( n_p[0]*n_d[1], 0. ); // Bx(p,d,d)
+        LaserPoints bx_points( patch, EMfields, d, 0, false, patch->isXmin(), n_p[0]-patch->isXmax(),
+                               1, true, patch->isYmin(), n_d[1]-patch->isYmax(), n_d[1] );
+        // Lasers
+        for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
+            vecLaser[ilaser]->addAmplitudes0( bx_points, time_dual, &bx[0] );
+        }
         for( unsigned int i=patch->isXmin() ; i<n_p[0]-patch->isXmax() ; i++ ) {
-            pos[0] = patch->getDomainLocalMin( 0 ) + ( ( int )i - ( int )EMfields->oversize[0] )*d[0];
             for( unsigned int j=patch->isYmin() ; j<n_d[1]-patch->isYmax() ; j++ ) {
-                pos[1] = patch->getDomainLocalMin( 1 ) + ( ( int )j - 0.5 - ( int )EMfields->oversize[1] )*d[1];
-                // Lasers
-                for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
-                    bx[ i*n_d[1]+j ] += vecLaser[ilaser]->getAmplitude0( pos, time_dual, i, j );
-                }
                 (*Hx_)( ncells_pml_xmin+i, ncells_pml_ymin+j, domain_oversize_z+nsolver/2 ) += factor_laser_angle_T*bx[ i*n_d[1]+j ] ;
                 (*Bx_)( ncells_pml_xmin+i, ncells_pml_ymin+j, domain_oversize_z+nsolver/2 ) += factor_laser_angle_T*bx[ i*n_d[1]+j ] ;
             }
         }
 
         vector<double> by( n_d[0]*n_p[1], 0. ); // By(d,p,d)
+        LaserPoints by_points( patch, EMfields, d, 0, true, patch->isXmin(), n_d[0]-patch->isXmax(),
+                               1, false, patch->isYmin(), n_p[1]-patch->isYmax(), n_p[1] );
+        // Lasers
+        for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
+            vecLaser[ilaser]->addAmplitudes1( by_points, time_dual, &by[0] );
+        }
         for( unsigned int i=patch->isXmin() ; i<n_d[0]-patch->isXmax() ; i++ ) {
-            pos[0] = patch->getDomainLocalMin( 0 ) + ( ( int )i -0.5 - ( int )EMfields->oversize[0] )*d[0];
             for( unsigned int j=patch->isYmin() ; j<n_p[1]-patch->isYmax() ; j++ ) {
-                pos[1] = patch->getDomainLocalMin( 1 ) + ( ( int )j - ( int )EMfields->oversize[1] )*d[1];
-                // Lasers
-                for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
-                    by[ i*n_p[1]+j ] += vecLaser[ilaser]->getAmplitude1( pos, time_dual, i, j );
-                }
                 (*Hy_)( ncells_pml_xmin+i, ncells_pml_ymin+j, domain_oversize_z+nsolver/2 ) += factor_laser_angle_T*by[ i*n_p[1]+j ] ;
                 (*By_)( ncells_pml_xmin+i, ncells_pml_ymin+j, domain_oversize_z+nsolver/2 ) += factor_laser_angle_T*by[ i*n_p[1]+j ] ;
             }
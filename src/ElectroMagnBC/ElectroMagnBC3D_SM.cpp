@@ -176,7 +176,6 @@ void ElectroMagnBC3D_SM::apply( ElectroMagn *EMfields, double time_dual, Patch *
 
         std::vector<double> b1( b1_size, 0. );
         std::vector<double> b2( b2_size, 0. );
-        std::vector<double> pos( 2 );
 
         double *const __restrict__ db1 = b1.data();
         double *const __restrict__ db2 = b2.data();
@@ -202,14 +201,10 @@ void ElectroMagnBC3D_SM::apply( ElectroMagn *EMfields, double time_dual, Patch *
         // Component along axis 1
         // Lasers
         if( !vecLaser.empty() ) {
-            for( unsigned int j=isBoundary1min; j<n1p-isBoundary1max ; j++ ) {
-                pos[0] = patch->getDomainLocalMin( axis1_ ) + ( ( int )j - ( int )EMfields->oversize[axis1_] )*d[axis1_];
-                for( unsigned int k=isBoundary2min; k<n2d-isBoundary2max; k++ ) {
-                    pos[1] = patch->getDomainLocalMin( axis2_ ) + ( ( int )k -0.5 - ( int )EMfields->oversize[axis2_] )*d[axis2_];
-                    for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
-                        db1[ j*n2d+k ] += vecLaser[ilaser]->getAmplitude0( pos, time_dual, j, k );
-                    }
-                }
+            LaserPoints points( patch, EMfields, d, axis1_, false, isBoundary1min, n1p-isBoundary1max,
+                                axis2_, true, isBoundary2min, n2d-isBoundary2max, n2d );
+            for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
+                vecLaser[ilaser]->addAmplitudes0( points, time_dual, db1 );
             }
         }
 
@@ -289,14 +284,10 @@ void ElectroMagnBC3D_SM::apply( ElectroMagn *EMfields, double time_dual, Patch *
         // Component along axis 2
         // Lasers
         if( !vecLaser.empty() ) {
-            for( unsigned int j=isBoundary1min; j<n1d-isBoundary1max; j++ ) {
-                pos[0] = patch->getDomainLocalMin( axis1_ ) + ( ( int )j - 0.5 - ( int )EMfields->oversize[axis1_] )*d[axis1_];
-                for( unsigned int k=isBoundary2min; k<n2p-isBoundary2max; k++ ) {
-                    pos[1] = patch->getDomainLocalMin( axis2_ ) + ( ( int )k - ( int )EMfields->oversize[axis2_] )*d[axis2_];
-                    for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
-                        db2[ j*n2p+k ] += vecLaser[ilaser]->getAmplitude1( pos, time_dual, j, k );
-                    }
-                }
+            LaserPoints points( patch, EMfields, d, axis1_, true, isBoundary1min, n1d-isBoundary1max,
+                                axis2_, false, isBoundary2min, n2p-isBoundary2max, n2p );
+            for( unsigned int ilaser=0; ilaser< vecLaser.size(); ilaser++ ) {
+                vecLaser[ilaser]->addAmplitudes1( points, time_dual, db2 );
             }
         }
 
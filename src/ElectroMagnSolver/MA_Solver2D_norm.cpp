@@ -1,6 +1,7 @@
 
 #include "MA_Solver2D_norm.h"
 
+#include <algorithm>
 #include "ElectroMagn.h"
 #include "Field2D.h"
 
@@ -16,6 +17,13 @@ MA_Solver2D_norm::~MA_Solver2D_norm()
 }
 
 void MA_Solver2D_norm::operator()( ElectroMagn *fields )
+{
+    const unsigned int box_start[2] = { 0, 0 };
+    const unsigned int box_end[2] = { fields->dimDual[0], fields->dimDual[1] };
+    updateBoxByTiles( fields, box_start, box_end );
+}
+
+void MA_Solver2D_norm::updateBox( ElectroMagn *fields, const unsigned int *box_start, const unsigned int *box_end )
 {
     double *const __restrict__ Ex2D       = fields->Ex_->data(); // [x * ny_p + y] : dual in x   primal in y,z
     double *const __restrict__ Ey2D       = fields->Ey_->data(); // [x * ny_d + y] : dual in y   primal in x,z
@@ -31,6 +39,14 @@ void MA_Solver2D_norm::operator()( ElectroMagn *fields )
     const unsigned int nx_d = fields->dimDual[0];
     const unsigned int ny_p = fields->dimPrim[1];
     const unsigned int ny_d = fields->dimDual[1];
+
+    // Loop bounds
+    const unsigned int x_begin = box_start[0];
+    const unsigned int x_end_d = std::min( nx_d, box_end[0] );
+    const unsigned int x_end_p = std::min( nx_p, box_end[0] );
+    const unsigned int y_begin = box_start[1];
+    const unsigned int y_end_d = std::min( ny_d, box_end[1] );
+    const unsigned int y_end_p = std::min( ny_p, box_end[1] );
  
     // double sumJx = 0;
     // double sumJy = 0;
@@ -51,14 +67,14 @@ void MA_Solver2D_norm::operator()( ElectroMagn *fields )
     #pragma omp target
     #pragma omp teams distribute parallel for collapse( 2 )
 #endif
-    for( unsigned int x = 0; x < nx_d; ++x ) {
+    for( unsigned int x = x_begin; x < x_end_d; ++x ) {
 #ifdef SMILEI_ACCELERATOR_GPU_OACC
         #pragma acc loop worker
 #endif
 #if !defined( SMILEI_ACCELERATOR_GPU )
         #pragma omp simd
 #endif
-        for( unsigned int y = 0; y < ny_p; ++y ) {
+        for( unsigned int y = y_begin; y < y_end_p; ++y ) {
             Ex2D[x * ny_p + y] += -dt * Jx2D[x * ny_p + y] + dt_ov_dy * ( Bz2D[x * ny_d + y + 1] - Bz2D[x * ny_d + y] );
         }
     }
@@ -71,14 +87,14 @@ void MA_Solver2D_norm::operator()( ElectroMagn *fields )
     #pragma omp target
     #pragma omp teams distribute parallel for collapse( 2 )
 #endif
-    for( unsigned int x = 0; x < nx_p; ++x ) {
+    for( unsigned int x = x_begin; x < x_end_p; ++x ) {
 #ifdef SMILEI_ACCELERATOR_GPU_OACC
         #pragma acc loop worker
 #endif
 #if !defined( SMILEI_ACCELERATOR_GPU )
         #pragma omp simd
 #endif
-        for( unsigned int y = 0; y < ny_d; ++y ) {
+        for( unsigned int y = y_begin; y < y_end_d; ++y ) {
             Ey2D[x * ny_d + y] += -dt * Jy2D[x * ny_d + y] - dt_ov_dx * ( Bz2D[( x + 1 ) * ny_d + y] - Bz2D[x * ny_d + y] );
         }
     }
@@ -91,14 +107,14 @@ void MA_Solver2D_norm::operator()( ElectroMagn *fields )
     #pragma omp target
     #pragma omp teams distribute parallel for collapse( 2 )
 #endif
-    for( unsigned int x = 0; x < nx_p; ++x ) {
+    for( unsigned int x = x_begin; x < x_end_p; ++x ) {
 #ifdef SMILEI_ACCELERATOR_GPU_OACC
         #pragma acc loop worker
 #endif
 #if !defined( SMILEI_ACCELERATOR_GPU )
         #pragma omp simd
 #endif
-        for( unsigned int y = 0; y < ny_p; ++y ) {
+        for( unsigned int y = y_begin; y < y_end_p; ++y ) {
             Ez2D[x * ny_p + y] += -dt * Jz2D[x * ny_p + y] +
                                   dt_ov_dx * ( By2D[( x + 1 ) * ny_p + y] - By2D[x * ny_p + y] ) -
                                   dt_ov_dy * ( Bx2D[x * ny_d + y + 1] - Bx2D[x * ny_d + y] );
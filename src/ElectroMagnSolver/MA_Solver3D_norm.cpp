@@ -1,6 +1,7 @@
 
 #include "MA_Solver3D_norm.h"
 
+#include <algorithm>
 #include "ElectroMagn.h"
 #include "Field3D.h"
 
@@ -16,6 +17,13 @@ MA_Solver3D_norm::~MA_Solver3D_norm()
 }
 
 void MA_Solver3D_norm::operator()( ElectroMagn *fields )
+{
+    const unsigned int box_start[3] = { 0, 0, 0 };
+    const unsigned int box_end[3] = { fields->dimDual[0], fields->dimDual[1], fields->dimDual[2] };
+    updateBoxByTiles( fields, box_start, box_end );
+}
+
+void MA_Solver3D_norm::updateBox( ElectroMagn *fields, const unsigned int *box_start, const unsigned int *box_end )
 {
     double *const __restrict__ Ex3D       = fields->Ex_->data();
     double *const __restrict__ Ey3D       = fields->Ey_->data();
@@ -33,6 +41,17 @@ void MA_Solver3D_norm::operator()( ElectroMagn *fields )
     const unsigned int ny_d = fields->dimDual[1];
     const unsigned int nz_p = fields->dimPrim[2];
     const unsigned int nz_d = fields->dimDual[2];
+
+    // Loop bounds
+    const unsigned int x_begin = box_start[0];
+    const unsigned int x_end_d = std::min( nx_d, box_end[0] );
+    const unsigned int x_end_p = std::min( nx_p, box_end[0] );
+    const unsigned int y_begin = box_start[1];
+    const unsigned int y_end_d = std::min( ny_d, box_end[1] );
+    const unsigned int y_end_p = std::min( ny_p, box_end[1] );
+    const unsigned int z_begin = box_start[2];
+    const unsigned int z_end_d = std::min( nz_d, box_end[2] );
+    const unsigned int z_end_p = std::min( nz_p, box_end[2] );
     
     // Electric field Ex^(d,p,p)
 #if defined( SMILEI_ACCELERATOR_GPU_OACC )
@@ -49,15 +68,18 @@ void MA_Solver3D_norm::operator()( ElectroMagn *fields )
     #pragma omp target
     #pragma omp teams distribute parallel for collapse( 3 )
 #endif
-    for( unsigned int i=0 ; i<nx_d ; i++ ) {
+    for( unsigned int i=x_begin ; i<x_end_d ; i++ ) {
 #ifdef SMILEI_ACCELERATOR_GPU_OACC
         #pragma acc loop worker
 #endif
-        for( unsigned int j=0 ; j<ny_p ; j++ ) {
+        for( unsigned int j=y_begin ; j<y_end_p ; j++ ) {
 #ifdef SMILEI_ACCELERATOR_GPU_OACC
             #pragma acc loop vector
 #endif
-            for( unsigned int k=0 ; k<nz_p ; k++ ) {
+#if !defined( SMILEI_ACCELERATOR_GPU )
+            #pragma omp simd
+#endif
+            for( unsigned int k=z_begin ; k<z_end_p ; k++ ) {
                 Ex3D[ i*(ny_p*nz_p) + j*(nz_p) + k ] += -dt*Jx3D[ i*(ny_p*nz_p) + j*(nz_p) + k ]
                     +                 dt_ov_dy * ( Bz3D[ i*(ny_d*nz_p) + (j+1)*(nz_p) + k   ] - Bz3D[ i*(ny_d*nz_p) + j*(nz_p) + k ] )
                     -                 dt_ov_dz * ( By3D[ i*(ny_p*nz_d) +  j   *(nz_d) + k+1 ] - By3D[ i*(ny_p*nz_d) + j*(nz_d) + k ] );
@@ -73,15 +95,18 @@ void MA_Solver3D_norm::operator()( ElectroMagn *fields )
     #pragma omp target
     #pragma omp teams distribute parallel for collapse( 3 )
 #endif
-    for( unsigned int i=0 ; i<nx_p ; i++ ) {
+    for( unsigned int i=x_begin ; i<x_end_p ; i++ ) {
 #ifdef SMILEI_ACCELERATOR_GPU_OACC
         #pragma acc loop worker
 #endif
-        for( unsigned int j=0 ; j<ny_d ; j++ ) {
+        for( unsigned int j=y_begin ; j<y_end_d ; j++ ) {
 #ifdef SMILEI_ACCELERATOR_GPU_OACC
             #pragma acc loop vector
 #endif
-            for( unsigned int k=0 ; k<nz_p ; k++ ) {
+#if !defined( SMILEI_ACCELERATOR_GPU )
+            #pragma omp simd
+#endif
+            for( unsigned int k=z_begin ; k<z_end_p ; k++ ) {
                 Ey3D[ i*(ny_d*nz_p) + j*(nz_p) + k ] += -dt*Jy3D[ i*(ny_d*nz_p) + j*(nz_p) + k ]
                     -                  dt_ov_dx * ( Bz3D[ (i+1)*(ny_d*nz_p) + j*(nz_p) + k   ] - Bz3D[ i*(ny_d*nz_p) + j*(nz_p) + k ] )
                     +                  dt_ov_dz * ( Bx3D[  i   *(ny_d*nz_d) + j*(nz_d) + k+1 ] - Bx3D[ i*(ny_d*nz_d) + j*(nz_d) + k ] );
@@ -97,15 +122,18 @@ void MA_Solver3D_norm::operator()( ElectroMagn *fields )
     #pragma omp target
     #pragma omp teams distribute parallel for collapse( 3 )
 #endif
-    for( unsigned int i=0 ;  i<nx_p ; i++ ) {
+    for( unsigned int i=x_begin ; i<x_end_p ; i++ ) {
 #ifdef SMILEI_ACCELERATOR_GPU_OACC
     #pragma acc loop worker
 #endif
-        for( unsigned int j=0 ; j<ny_p ; j++ ) {
+        for( unsigned int j=y_begin ; j<y_end_p ; j++ ) {
 #ifdef SMILEI_ACCELERATOR_GPU_OACC
             #pragma acc loop vector
 #endif
-            for( unsigned int k=0 ; k<nz_d ; k++ ) {
+#if !defined( SMILEI_ACCELERATOR_GPU )
+            #pragma omp simd
+#endif
+            for( unsigned int k=z_begin ; k<z_end_d ; k++ ) {
                 Ez3D[ i*(ny_p*nz_d) + j*(nz_d) + k ] += -dt*Jz3D[ i*(ny_p*nz_d) + j*(nz_d) + k ]
                     +                  dt_ov_dx * ( By3D[ (i+1)*(ny_p*nz_d) +  j   *(nz_d) + k ] - By3D[ i*(ny_p*nz_d) + j*(nz_d) + k ] )
                     -                  dt_ov_dy * ( Bx3D[  i   *(ny_d*nz_d) + (j+1)*(nz_d) + k ] - Bx3D[ i*(ny_d*nz_d) + j*(nz_d) + k ] );
@@ -1,6 +1,7 @@
 
 #include "MF_Solver1D_Yee.h"
 
+#include <algorithm>
 #include "ElectroMagn.h"
 #include "Field1D.h"
 
@@ -15,9 +16,20 @@ MF_Solver1D_Yee::~MF_Solver1D_Yee()
 }
 
 void MF_Solver1D_Yee::operator()( ElectroMagn *fields )
+{
+    const unsigned int box_start[1] = { 0 };
+    const unsigned int box_end[1] = { fields->dimDual[0] };
+    updateBox( fields, box_start, box_end );
+}
+
+void MF_Solver1D_Yee::updateBox( ElectroMagn *fields, const unsigned int *box_start, const unsigned int *box_end )
 {
     // const unsigned int nx_p = fields->dimPrim[0];
     const unsigned int nx_d = fields->dimDual[0];
+
+    // Loop bounds
+    const unsigned int x_begin_1 = std::max( 1u, box_start[0] );
+    const unsigned int x_end_d_1 = std::min( nx_d - 1, box_end[0] );
     
     const double *const __restrict__ Ey1D = isEFilterApplied ? fields->filter_->Ey_[0]->data() :
                                                                fields->Ey_->data(); // [ix] : dual in y   primal in x,z
@@ -46,7 +58,7 @@ void MF_Solver1D_Yee::operator()( ElectroMagn *fields )
 #if !defined( SMILEI_ACCELERATOR_GPU )
     #pragma omp simd
 #endif
-    for( unsigned int ix=1 ; ix<nx_d-1 ; ix++ ) {
+    for( unsigned int ix=x_begin_1 ; ix<x_end_d_1 ; ix++ ) {
         By1D[ix] = By1D[ix] + dt_ov_dx * ( Ez1D[ix] - Ez1D[ix-1] );
         Bz1D[ix] = Bz1D[ix] - dt_ov_dx * ( Ey1D[ix] - Ey1D[ix-1] );
     }
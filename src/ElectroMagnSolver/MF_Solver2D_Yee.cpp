@@ -1,6 +1,7 @@
 
 #include "MF_Solver2D_Yee.h"
 
+#include <algorithm>
 #include "ElectroMagn.h"
 #include "Field2D.h"
 
@@ -16,6 +17,13 @@ MF_Solver2D_Yee::~MF_Solver2D_Yee()
 }
 
 void MF_Solver2D_Yee::operator()( ElectroMagn *fields )
+{
+    const unsigned int box_start[2] = { 0, 0 };
+    const unsigned int box_end[2] = { fields->dimDual[0], fields->dimDual[1] };
+    updateBoxByTiles( fields, box_start, box_end );
+}
+
+void MF_Solver2D_Yee::updateBox( ElectroMagn *fields, const unsigned int *box_start, const unsigned int *box_end )
 {
 
     // const unsigned int nx_p = fields->dimPrim[0];
@@ -23,6 +31,15 @@ void MF_Solver2D_Yee::operator()( ElectroMagn *fields )
     const unsigned int ny_p = fields->dimPrim[1];
     const unsigned int ny_d = fields->dimDual[1];
 
+    // Loop bounds
+    const unsigned int x_begin   = box_start[0];
+    const unsigned int x_begin_1 = std::max( 1u, box_start[0] );
+    const unsigned int x_end_d_1 = std::min( nx_d - 1, box_end[0] );
+    const unsigned int y_begin   = box_start[1];
+    const unsigned int y_begin_1 = std::max( 1u, box_start[1] );
+    const unsigned int y_end_d_1 = std::min( ny_d - 1, box_end[1] );
+    const unsigned int y_end_p   = std::min( ny_p, box_end[1] );
+
     const double *const __restrict__ Ex2D = isEFilterApplied ? fields->filter_->Ex_[0]->data() :
                                                                fields->Ex_->data(); // [x * ny_p + y] : dual in x   primal in y,z
     const double *const __restrict__ Ey2D = isEFilterApplied ? fields->filter_->Ey_[0]->data() :
@@ -47,14 +64,14 @@ void MF_Solver2D_Yee::operator()( ElectroMagn *fields )
     #pragma omp target
     #pragma omp teams distribute parallel for collapse( 2 )
 #endif
-    for( unsigned int x = 0; x < nx_d - 1; ++x ) {
+    for( unsigned int x = x_begin; x < x_end_d_1; ++x ) {
 #if !defined( SMILEI_ACCELERATOR_GPU )
         #pragma omp simd
 #endif
 #ifdef SMILEI_ACCELERATOR_GPU_OACC                                                                                                             
             #pragma acc loop vector                                                                                                    
 #endif  
-        for( unsigned int y = 1; y < ny_d - 1; ++y ) {
+        for( unsigned int y = y_begin_1; y < y_end_d_1; ++y ) {
             Bx2D[x * ny_d + y] -= dt_ov_dy * ( Ez2D[x * ny_p + y] - Ez2D[x * ny_p + y - 1] );
         }
     }
@@ -66,14 +83,14 @@ void MF_Solver2D_Yee::operator()( ElectroMagn *fields )
     #pragma omp target
     #pragma omp teams distribute parallel for collapse( 2 )
 #endif
-    for( unsigned int x = 1; x < nx_d - 1; ++x ) {
+    for( unsigned int x = x_begin_1; x < x_end_d_1; ++x ) {
 #if !defined( SMILEI_ACCELERATOR_GPU )
         #pragma omp simd
 #endif
 #ifdef SMILEI_ACCELERATOR_GPU_OACC                                                                                                             
             #pragma acc loop vector                                                                                                    
 #endif  
-        for( unsigned int y = 0; y < ny_p; ++y ) {
+        for( unsigned int y = y_begin; y < y_end_p; ++y ) {
             By2D[x * ny_p + y] += dt_ov_dx * ( Ez2D[x * ny_p + y] - Ez2D[( x - 1 ) * ny_p + y] );
         }
     }
@@ -86,14 +103,14 @@ void MF_Solver2D_Yee::operator()( ElectroMagn *fields )
     #pragma omp target
     #pragma omp teams distribute parallel for collapse( 2 )
 #endif
-    for( unsigned int x = 1; x < nx_d - 1; ++x ) {
+    for( unsigned int x = x_begin_1; x < x_end_d_1; ++x ) {
 #if !defined( SMILEI_ACCELERATOR_GPU )
         #pragma omp simd
 #endif
 #ifdef SMILEI_ACCELERATOR_GPU_OACC                                                                                                             
             #pragma acc loop vector                                                                                                    
 #endif  
-        for( unsigned int y = 1; y < ny_d - 1; ++y ) {
+        for( unsigned int y = y_begin_1; y < y_end_d_1; ++y ) {
             Bz2D[x * ny_d + y] += dt_ov_dy * ( Ex2D[x * ny_p + y] - Ex2D[x * ny_p + y - 1] ) -
                                   dt_ov_dx * ( Ey2D[x * ny_d + y] - Ey2D[( x - 1 ) * ny_d + y] );
         }
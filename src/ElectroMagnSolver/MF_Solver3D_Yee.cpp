@@ -1,6 +1,7 @@
 
 #include "MF_Solver3D_Yee.h"
 
+#include <algorithm>
 #include "ElectroMagn.h"
 #include "Field3D.h"
 
@@ -16,6 +17,13 @@ MF_Solver3D_Yee::~MF_Solver3D_Yee()
 }
 
 void MF_Solver3D_Yee::operator()( ElectroMagn *fields )
+{
+    const unsigned int box_start[3] = { 0, 0, 0 };
+    const unsigned int box_end[3] = { fields->dimDual[0], fields->dimDual[1], fields->dimDual[2] };
+    updateBoxByTiles( fields, box_start, box_end );
+}
+
+void MF_Solver3D_Yee::updateBox( ElectroMagn *fields, const unsigned int *box_start, const unsigned int *box_end )
 {
     // Static-cast of the fields
     double *const __restrict__ Bx3D       = fields->Bx_->data();
@@ -28,6 +36,20 @@ void MF_Solver3D_Yee::operator()( ElectroMagn *fields )
     const unsigned int ny_d = fields->dimDual[1];
     const unsigned int nz_p = fields->dimPrim[2];
     const unsigned int nz_d = fields->dimDual[2];
+
+    // Loop bounds
+    const unsigned int x_begin   = box_start[0];
+    const unsigned int x_begin_1 = std::max( 1u, box_start[0] );
+    const unsigned int x_end_d_1 = std::min( nx_d - 1, box_end[0] );
+    const unsigned int x_end_p   = std::min( nx_p, box_end[0] );
+    const unsigned int y_begin   = box_start[1];
+    const unsigned int y_begin_1 = std::max( 1u, box_start[1] );
+    const unsigned int y_end_d_1 = std::min( ny_d - 1, box_end[1] );
+    const unsigned int y_end_p   = std::min( ny_p, box_end[1] );
+    const unsigned int z_begin   = box_start[2];
+    const unsigned int z_begin_1 = std::max( 1u, box_start[2] );
+    const unsigned int z_end_d_1 = std::min( nz_d - 1, box_end[2] );
+    const unsigned int z_end_p   = std::min( nz_p, box_end[2] );
     //double *__restrict__ Ex3D ;
     const double * __restrict__ Ex3D = isEFilterApplied ? fields->filter_->Ex_[0]->data() : fields->Ex_->data();
     const double * __restrict__ Ey3D = isEFilterApplied ? fields->filter_->Ey_[0]->data() : fields->Ey_->data();
@@ -48,15 +70,18 @@ void MF_Solver3D_Yee::operator()( ElectroMagn *fields )
     #pragma omp target
     #pragma omp teams distribute parallel for collapse( 3 )
 #endif
-    for( unsigned int i=0 ; i<nx_p;  i++ ) {
+    for( unsigned int i=x_begin ; i<x_end_p ; i++ ) {
 #ifdef SMILEI_ACCELERATOR_GPU_OACC
         #pragma acc loop worker
 #endif
-        for( unsigned int j=1 ; j<ny_d-1 ; j++ ) {
+        for( unsigned int j=y_begin_1 ; j<y_end_d_1 ; j++ ) {
 #ifdef SMILEI_ACCELERATOR_GPU_OACC
             #pragma acc loop vector
 #endif
-            for( unsigned int k=1 ; k<nz_d-1 ; k++ ) {
+#if !defined( SMILEI_ACCELERATOR_GPU )
+            #pragma omp simd
+#endif
+            for( unsigned int k=z_begin_1 ; k<z_end_d_1 ; k++ ) {
                 Bx3D[ i*(ny_d*nz_d) + j*(nz_d) + k ] += -dt_ov_dy * ( Ez3D[ i*(ny_p*nz_d) + j*(nz_d) + k ] - Ez3D[ i*(ny_p*nz_d) + (j-1)*(nz_d) + k   ] )
                                                      +   dt_ov_dz * ( Ey3D[ i*(ny_d*nz_p) + j*(nz_p) + k ] - Ey3D[ i*(ny_d*nz_p) +  j   *(nz_p) + k-1 ] );
             }
@@ -71,15 +96,18 @@ void MF_Solver3D_Yee::operator()( ElectroMagn *fields )
     #pragma omp target
     #pragma omp teams distribute parallel for collapse( 3 )
 #endif
-    for( unsigned int i=1 ; i<nx_d-1 ; i++ ) {
+    for( unsigned int i=x_begin_1 ; i<x_end_d_1 ; i++ ) {
 #ifdef SMILEI_ACCELERATOR_GPU_OACC
         #pragma acc loop worker
 #endif
-        for( unsigned int j=0 ; j<ny_p ; j++ ) {
+        for( unsigned int j=y_begin ; j<y_end_p ; j++ ) {
 #ifdef SMILEI_ACCELERATOR_GPU_OACC
             #pragma acc loop vector
 #endif
-            for( unsigned int k=1 ; k<nz_d-1 ; k++ ) {
+#if !defined( SMILEI_ACCELERATOR_GPU )
+            #pragma omp simd
+#endif
+            for( unsigned int k=z_begin_1 ; k<z_end_d_1 ; k++ ) {
                 By3D[ i*(ny_p*nz_d) + j*(nz_d) + k ] += -dt_ov_dz * ( Ex3D[ i*(ny_p*nz_p) + j*(nz_p) + k ] - Ex3D[  i   *(ny_p*nz_p) + j*(nz_p) + k-1 ] )
                                                      +   dt_ov_dx * ( Ez3D[ i*(ny_p*nz_d) + j*(nz_d) + k ] - Ez3D[ (i-1)*(ny_p*nz_d) + j*(nz_d) + k   ] );
             }
@@ -94,15 +122,18 @@ void MF_Solver3D_Yee::operator()( ElectroMagn *fields )
     #pragma omp target
     #pragma omp teams distribute parallel for collapse( 3 )
 #endif
-    for( unsigned int i=1 ; i<nx_d-1 ; i++ ) {
+    for( unsigned int i=x_begin_1 ; i<x_end_d_1 ; i++ ) {
 #ifdef SMILEI_ACCELERATOR_GPU_OACC
         #pragma acc loop worker
 #endif
-        for( unsigned int j=1 ; j<ny_d-1 ; j++ ) {
+        for( unsigned int j=y_begin_1 ; j<y_end_d_1 ; j++ ) {
 #ifdef SMILEI_ACCELERATOR_GPU_OACC
             #pragma acc loop vector
 #endif
-            for( unsigned int k=0 ; k<nz_p ; k++ ) {
+#if !defined( SMILEI_ACCELERATOR_GPU )
+            #pragma omp simd
+#endif
+            for( unsigned int k=z_begin ; k<z_end_p ; k++ ) {
                 Bz3D[ i*(ny_d*nz_p) + j*(nz_p) + k ] += -dt_ov_dx * ( Ey3D[ i*(ny_d*nz_p) + j*(nz_p) + k ] - Ey3D[ (i-1)*(ny_d*nz_p) +  j   *(nz_p) + k ] )
                                                      +   dt_ov_dy * ( Ex3D[ i*(ny_p*nz_p) + j*(nz_p) + k ] - Ex3D[  i   *(ny_p*nz_p) + (j-1)*(nz_p) + k ] );
             }
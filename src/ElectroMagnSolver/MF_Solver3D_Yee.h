@@ -18,6 +18,10 @@ public:
     //! Overloading of () operator
     virtual void operator()( ElectroMagn *fields );
 
+    //! Update only the cells of a box
+    bool canUpdateBox() override { return true; };
+    void updateBox( ElectroMagn *fields, const unsigned int *box_start, const unsigned int *box_end ) override;
+
 protected:
     // Check if time filter is applied or not
     bool isEFilterApplied;
@@ -0,0 +1,31 @@
+#include "Solver.h"
+
+#include <algorithm>
+#include "ElectroMagn.h"
+
+void Solver::updateBoxByTiles( ElectroMagn *fields, const unsigned int *box_start, const unsigned int *box_end )
+{
+    unsigned int nDim = fields->dimDual.size();
+    if( tile_size_ == 0 || nDim < 2 ) {
+        updateBox( fields, box_start, box_end );
+        return;
+    }
+
+    // Tiles along all dimensions but the last one, which is left whole for the vectorized inner loops
+    std::vector<unsigned int> tile_start( box_start, box_start+nDim ), tile_end( box_end, box_end+nDim );
+    unsigned int ntiles[2] = { 1, 1 };
+    for( unsigned int iDim=0 ; iDim<nDim-1 ; iDim++ ) {
+        ntiles[iDim] = box_end[iDim] > box_start[iDim] ? ( box_end[iDim] - box_start[iDim] + tile_size_ - 1 ) / tile_size_ : 0;
+    }
+    for( unsigned int itile=0 ; itile<ntiles[0] ; itile++ ) {
+        tile_start[0] = box_start[0] + itile*tile_size_;
+        tile_end  [0] = std::min( tile_start[0] + tile_size_, box_end[0] );
+        for( unsigned int jtile=0 ; jtile<ntiles[1] ; jtile++ ) {
+            if( nDim == 3 ) {
+                tile_start[1] = box_start[1] + jtile*tile_size_;
+                tile_end  [1] = std::min( tile_start[1] + tile_size_, box_end[1] );
+            }
+            updateBox( fields, &tile_start[0], &tile_end[0] );
+        }
+    }
+}
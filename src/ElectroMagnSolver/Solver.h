@@ -14,7 +14,7 @@ class Solver
 
 public:
     //! Creator for Solver
-    Solver() {};
+    Solver() : tile_size_( 0 ) {};
     virtual ~Solver() {};
     
     virtual void coupling( Params &, ElectroMagn *, bool = false ) {};
@@ -24,12 +24,25 @@ public:
     //! Overloading of () operator
     virtual void operator()( ElectroMagn * ) = 0;
 
+    //! Whether the solver can update only a box of cells (see updateBox)
+    virtual bool canUpdateBox() { return false; };
+    //! Update only the cells whose indices, on the dual grid, are within [box_start, box_end) in each dimension.
+    //! Used to update the patch borders, then exchange them while the interior is updated.
+    //! The bounds are host arrays: implementations copy them to scalars before the accelerator loops.
+    virtual void updateBox( ElectroMagn *, const unsigned int *, const unsigned int * ) {ERROR("This solver cannot update a box of cells");};
+    //! Update a box of cells tile by tile (see tile_size_), so that all the components of a tile are updated while it is in cache
+    //! (no tiling on GPU, where the box is updated at once)
+    void updateBoxByTiles( ElectroMagn *fields, const unsigned int *box_start, const unsigned int *box_end );
+
     virtual void setDomainSizeAndCoefficients( int, int, std::vector<unsigned int>, int, int, int*, int*, Patch* ) {ERROR("Not using PML");};
     virtual void compute_E_from_D( ElectroMagn *, int, int, std::vector<unsigned int>, unsigned int, unsigned int ) {ERROR("Not using PML");};
     virtual void compute_H_from_B( ElectroMagn *, int, int, std::vector<unsigned int>, unsigned int, unsigned int ) {ERROR("Not using PML");};
     virtual void compute_A_from_G( LaserEnvelope *, int, int, std::vector<unsigned int>, unsigned int, unsigned int ) {ERROR("Not using PML");};
 
 protected:
+    //! Number of cells of a tile along each dimension but the last one (contiguous in memory), 0 for no tiling
+    //! (always 0 with `gpu_computing`)
+    unsigned int tile_size_;
 
 };//END class
 
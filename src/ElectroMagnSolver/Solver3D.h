@@ -13,6 +13,7 @@ public:
     //! Creator for Solver
     Solver3D( Params &params ) : Solver()
     {
+        tile_size_ = params.gpu_computing ? 0 : params.solver_tile_size;
         dt = params.timestep;
         dx = params.cell_length[0];
         dy = params.cell_length[1];
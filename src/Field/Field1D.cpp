@@ -4,6 +4,7 @@
 #include <vector>
 #include <cstring>
 
+#include "FieldMemoryPool.h"
 #include "Params.h"
 #include "SmileiMPI.h"
 #include "Patch.h"
@@ -78,7 +79,7 @@ Field1D::~Field1D()
         }
     }
     if( data_!=NULL ) {
-        delete [] data_;
+        FieldMemoryPool::release( data_, number_of_points_ );
     }
 }
 
@@ -95,7 +96,7 @@ void Field1D::allocateDims()
     
     isDual_.resize( dims_.size(), 0 );
     
-    data_ = new double[ dims_[0] ];
+    data_ = FieldMemoryPool::allocate( dims_[0] );
     //! \todo{change to memset (JD)}
     for( unsigned int i=0; i<dims_[0]; i++ ) {
         data_[i]=0.0;
@@ -107,7 +108,7 @@ void Field1D::allocateDims()
 
 void Field1D::deallocateDataAndSetTo( Field* f )
 {
-    delete [] data_;
+    FieldMemoryPool::release( data_, number_of_points_ );
     data_=NULL;
 
     data_ = f->data_;
@@ -147,7 +148,7 @@ void Field1D::allocateDims( unsigned int mainDim, bool isPrimal )
         dims_[j] += isDual_[j];
     }
     
-    data_ = new double[ dims_[0] ];
+    data_ = FieldMemoryPool::allocate( dims_[0] );
     //! \todo{change to memset (JD)}
     for( unsigned int i=0; i<dims_[0]; i++ ) {
         data_[i]=0.0;
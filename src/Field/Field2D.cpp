@@ -8,6 +8,7 @@
 #include <openacc.h>
 #endif
 
+#include "FieldMemoryPool.h"
 #include "Params.h"
 #include "Patch.h"
 #include "SmileiMPI.h"
@@ -95,7 +96,7 @@ Field2D::~Field2D()
     }
     if( data_!=NULL ) {
         #pragma acc exit data delete (data_[0:number_of_points_]) if (acc_deviceptr(data_) != NULL)
-        delete [] data_;
+        FieldMemoryPool::release( data_, number_of_points_ );
         delete [] data_2D;
     }
 }
@@ -110,12 +111,12 @@ void Field2D::allocateDims()
         ERROR( "Alloc error must be 2 : " << dims_.size() );
     }
     if( data_!=NULL ) {
-        delete [] data_;
+        FieldMemoryPool::release( data_, number_of_points_ );
     }
     
     isDual_.resize( dims_.size(), 0 );
     
-    data_ = new double[dims_[0]*dims_[1]];
+    data_ = FieldMemoryPool::allocate( dims_[0]*dims_[1] );
     //! \todo{check row major order!!! (JD)}
     
     data_2D = new double *[dims_[0]];
@@ -132,7 +133,7 @@ void Field2D::allocateDims()
 
 void Field2D::deallocateDataAndSetTo( Field* f )
 {
-    delete [] data_;
+    FieldMemoryPool::release( data_, number_of_points_ );
     data_ = NULL;
     delete [] data_2D;
     data_2D = NULL;
@@ -159,7 +160,7 @@ void Field2D::allocateDims( unsigned int mainDim, bool isPrimal )
         ERROR( "Alloc error must be 2 : " << dims_.size() );
     }
     if( data_ ) {
-        delete [] data_;
+        FieldMemoryPool::release( data_, number_of_points_ );
     }
     
     // isPrimal define if mainDim is Primal or Dual
@@ -176,7 +177,7 @@ void Field2D::allocateDims( unsigned int mainDim, bool isPrimal )
         dims_[j] += isDual_[j];
     }
     
-    data_ = new double[dims_[0]*dims_[1]];
+    data_ = FieldMemoryPool::allocate( dims_[0]*dims_[1] );
     //! \todo{check row major order!!! (JD)}
 
     data_2D = new double *[dims_[0]];
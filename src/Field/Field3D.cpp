@@ -8,6 +8,7 @@
 #include <openacc.h>
 #endif
 
+#include "FieldMemoryPool.h"
 #include "Params.h"
 #include "Patch.h"
 #include "SmileiMPI.h"
@@ -105,10 +106,8 @@ Field3D::~Field3D()
 #if defined(SMILEI_ACCELERATOR_GPU_OACC)
         #pragma acc exit data delete (data_[0:number_of_points_]) if (acc_deviceptr(data_) != NULL)
 #endif
-        delete [] data_;
-        for( unsigned int i=0; i<dims_[0]; i++ ) {
-            delete [] this->data_3D[i];
-        }
+        FieldMemoryPool::release( data_, number_of_points_ );
+        delete [] this->data_3D[0];
         delete [] this->data_3D;
     }
 }
@@ -123,16 +122,18 @@ void Field3D::allocateDims()
         ERROR( "Alloc error must be 3 : " << dims_.size() );
     }
     if( data_ ) {
-        delete [] data_;
+        FieldMemoryPool::release( data_, number_of_points_ );
     }
     
     isDual_.resize( dims_.size(), 0 );
     
-    data_ = new double[dims_[0]*dims_[1]*dims_[2]];
+    data_ = FieldMemoryPool::allocate( dims_[0]*dims_[1]*dims_[2] );
     //! \todo{check row major order!!!}
+    // All the rows in a single table of pointers
     data_3D= new double **[dims_[0]];
+    data_3D[0]= new double*[dims_[0]*dims_[1]];
     for( unsigned int i=0; i<dims_[0]; i++ ) {
-        data_3D[i]= new double*[dims_[1]];
+        data_3D[i]= data_3D[0] + i*dims_[1];
         for( unsigned int j=0; j<dims_[1]; j++ ) {
             data_3D[i][j] = data_ + i*dims_[1]*dims_[2] + j*dims_[2];
             for( unsigned int k=0; k<dims_[2]; k++ ) {
@@ -147,11 +148,9 @@ void Field3D::allocateDims()
 
 void Field3D::deallocateDataAndSetTo( Field* f )
 {
-    delete [] data_;
+    FieldMemoryPool::release( data_, number_of_points_ );
     data_ = NULL;
-    for( unsigned int i=0; i<dims_[0]; i++ ) {
-        delete [] data_3D[i];
-    }
+    delete [] data_3D[0];
     delete [] data_3D;
     data_3D = NULL;
 
@@ -180,7 +179,7 @@ void Field3D::allocateDims( unsigned int mainDim, bool isPrimal )
         ERROR( "Alloc error must be 3 : " << dims_.size() );
     }
     if( data_ ) {
-        delete [] data_;
+        FieldMemoryPool::release( data_, number_of_points_ );
     }
     
     // isPrimal define if mainDim is Primal or Dual
@@ -197,11 +196,13 @@ void Field3D::allocateDims( unsigned int mainDim, bool isPrimal )
         dims_[j] += isDual_[j];
     }
     
-    data_ = new double[dims_[0]*dims_[1]*dims_[2]];
+    data_ = FieldMemoryPool::allocate( dims_[0]*dims_[1]*dims_[2] );
     //! \todo{check row major order!!!}
-    data_3D= new double **[dims_[0]*dims_[1]];
+    // All the rows in a single table of pointers
+    data_3D= new double **[dims_[0]];
+    data_3D[0]= new double*[dims_[0]*dims_[1]];
     for( unsigned int i=0; i<dims_[0]; i++ ) {
-        data_3D[i]= new double*[dims_[1]];
+        data_3D[i]= data_3D[0] + i*dims_[1];
         for( unsigned int j=0; j<dims_[1]; j++ ) {
             this->data_3D[i][j] = data_ + i*dims_[1]*dims_[2] + j*dims_[2];
             for( unsigned int k=0; k<dims_[2]; k++ ) {
@@ -0,0 +1,67 @@
+#include "FieldMemoryPool.h"
+
+using namespace std;
+
+map<size_t, vector<double *> > FieldMemoryPool::arrays_;
+size_t FieldMemoryPool::size_ = 0;
+size_t FieldMemoryPool::capacity_ = 0;
+
+void FieldMemoryPool::setCapacity( size_t bytes )
+{
+    capacity_ = bytes / sizeof( double );
+}
+
+double *FieldMemoryPool::allocate( size_t n )
+{
+    double *data = NULL;
+    if( capacity_ > 0 ) {
+        #pragma omp critical (FieldMemoryPool)
+        {
+            map<size_t, vector<double *> >::iterator it = arrays_.find( n );
+            if( it != arrays_.end() && ! it->second.empty() ) {
+                data = it->second.back();
+                it->second.pop_back();
+                size_ -= n;
+            }
+        }
+    }
+    if( data == NULL ) {
+        data = new double[n];
+    }
+    return data;
+}
+
+void FieldMemoryPool::release( double *data, size_t n )
+{
+    if( data == NULL ) {
+        return;
+    }
+    bool kept = false;
+    if( capacity_ > 0 ) {
+        #pragma omp critical (FieldMemoryPool)
+        {
+            if( size_ + n <= capacity_ ) {
+                arrays_[n].push_back( data );
+                size_ += n;
+                kept = true;
+            }
+        }
+    }
+    if( ! kept ) {
+        delete [] data;
+    }
+}
+
+void FieldMemoryPool::clear()
+{
+    #pragma omp critical (FieldMemoryPool)
+    {
+        for( map<size_t, vector<double *> >::iterator it = arrays_.begin() ; it != arrays_.end() ; it++ ) {
+            for( unsigned int i=0 ; i<it->second.size() ; i++ ) {
+                delete [] it->second[i];
+            }
+        }
+        arrays_.clear();
+        size_ = 0;
+    }
+}
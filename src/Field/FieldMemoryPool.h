@@ -0,0 +1,51 @@
+#ifndef FIELDMEMORYPOOL_H
+#define FIELDMEMORYPOOL_H
+
+#include <complex>
+#include <cstddef>
+#include <map>
+#include <vector>
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class FieldMemoryPool
+//! Arrays of the fields released by the patches leaving the process (moving window, load balancing),
+//! kept to be reused by the fields of the patches created afterwards instead of being freed and allocated again.
+//! The arrays are sorted by size; the pool is disabled (arrays freed immediately) when its capacity is zero.
+//  --------------------------------------------------------------------------------------------------------------------
+class FieldMemoryPool
+{
+public:
+
+    //! Largest number of bytes kept in the pool
+    static void setCapacity( size_t bytes );
+
+    //! Array of n doubles, reused from the pool if possible. Not initialized.
+    static double *allocate( size_t n );
+    //! Gives back an array of n doubles obtained from allocate
+    static void release( double *data, size_t n );
+
+    //! Same for complex arrays, stored as arrays of 2*n doubles
+    static std::complex<double> *allocateComplex( size_t n )
+    {
+        return reinterpret_cast<std::complex<double> *>( allocate( 2*n ) );
+    }
+    static void releaseComplex( std::complex<double> *data, size_t n )
+    {
+        release( reinterpret_cast<double *>( data ), 2*n );
+    }
+
+    //! Frees all the arrays of the pool
+    static void clear();
+
+private:
+
+    //! Available arrays, by number of doubles
+    static std::map<size_t, std::vector<double *> > arrays_;
+    //! Number of doubles in the pool
+    static size_t size_;
+    //! Largest number of doubles in the pool
+    static size_t capacity_;
+
+};//END class FieldMemoryPool
+
+#endif
@@ -4,6 +4,7 @@
 #include <vector>
 #include <cstring>
 
+#include "FieldMemoryPool.h"
 #include "Params.h"
 #include "SmileiMPI.h"
 #include "Patch.h"
@@ -78,7 +79,7 @@ cField1D::~cField1D()
         }
     }
     if( cdata_!=NULL ) {
-        delete [] cdata_;
+        FieldMemoryPool::releaseComplex( cdata_, number_of_points_ );
     }
 }
 
@@ -95,7 +96,7 @@ void cField1D::allocateDims()
     
     isDual_.resize( dims_.size(), 0 );
     
-    cdata_ = new complex<double>[ dims_[0] ];
+    cdata_ = FieldMemoryPool::allocateComplex( dims_[0] );
     //! \todo{change to memset (JD)}
     for( unsigned int i=0; i<dims_[0]; i++ ) {
         cdata_[i]=0.0;
@@ -107,7 +108,7 @@ void cField1D::allocateDims()
 
 void cField1D::deallocateDataAndSetTo( Field* f )
 {
-    delete [] cdata_;
+    FieldMemoryPool::releaseComplex( cdata_, number_of_points_ );
     cdata_=NULL;
 
     cdata_ = (static_cast<cField *>(f))->cdata_;
@@ -148,7 +149,7 @@ void cField1D::allocateDims( unsigned int mainDim, bool isPrimal )
         dims_[j] += isDual_[j];
     }
     
-    cdata_ = new complex<double>[ dims_[0] ];
+    cdata_ = FieldMemoryPool::allocateComplex( dims_[0] );
     //! \todo{change to memset (JD)}
     for( unsigned int i=0; i<dims_[0]; i++ ) {
         cdata_[i]=0.0;
@@ -4,6 +4,7 @@
 #include <vector>
 #include <cstring>
 
+#include "FieldMemoryPool.h"
 #include "Params.h"
 #include "SmileiMPI.h"
 #include "Patch.h"
@@ -88,7 +89,7 @@ cField2D::~cField2D()
         }
     }
     if( cdata_!=NULL ) {
-        delete [] cdata_;
+        FieldMemoryPool::releaseComplex( cdata_, number_of_points_ );
         delete [] data_2D;
     }
 }
@@ -104,12 +105,12 @@ void cField2D::allocateDims()
         ERROR( "Alloc error must be 2 : " << dims_.size() );
     }
     if( cdata_!=NULL ) {
-        delete [] cdata_;
+        FieldMemoryPool::releaseComplex( cdata_, number_of_points_ );
     }
     
     isDual_.resize( dims_.size(), 0 );
     
-    cdata_ = new complex<double>[dims_[0]*dims_[1]];
+    cdata_ = FieldMemoryPool::allocateComplex( dims_[0]*dims_[1] );
     
     data_2D= new complex<double> *[dims_[0]];
     for( unsigned int i=0; i<dims_[0]; i++ ) {
@@ -125,7 +126,7 @@ void cField2D::allocateDims()
 
 void cField2D::deallocateDataAndSetTo( Field* f )
 {
-    delete [] cdata_;
+    FieldMemoryPool::releaseComplex( cdata_, number_of_points_ );
     cdata_ = NULL;
     delete [] data_2D;
     data_2D = NULL;
@@ -154,7 +155,7 @@ void cField2D::allocateDims( unsigned int mainDim, bool isPrimal )
         ERROR( "Alloc error must be 2 : " << dims_.size() );
     }
     if( cdata_ ) {
-        delete [] cdata_;
+        FieldMemoryPool::releaseComplex( cdata_, number_of_points_ );
     }
     
     // isPrimal define if mainDim is Primal or Dual
@@ -171,7 +172,7 @@ void cField2D::allocateDims( unsigned int mainDim, bool isPrimal )
         dims_[j] += isDual_[j];
     }
     
-    cdata_ = new complex<double>[dims_[0]*dims_[1]];
+    cdata_ = FieldMemoryPool::allocateComplex( dims_[0]*dims_[1] );
     //! \todo{check row major order!!! (JD)}
     
     data_2D= new complex<double> *[dims_[0]];
@@ -4,6 +4,8 @@
 #include <vector>
 #include <cstring>
 
+#include "FieldMemoryPool.h"
+
 using namespace std;
 
 
@@ -76,7 +78,7 @@ cField3D::~cField3D()
         }
     }
     if( cdata_!=NULL ) {
-        delete [] cdata_;
+        FieldMemoryPool::releaseComplex( cdata_, number_of_points_ );
         for( unsigned int i=0; i<dims_[0]; i++ ) {
             delete [] data_3D[i];
         }
@@ -95,12 +97,12 @@ void cField3D::allocateDims()
         ERROR( "Alloc error must be 3 : " << dims_.size() );
     }
     if( cdata_!=NULL ) {
-        delete [] cdata_;
+        FieldMemoryPool::releaseComplex( cdata_, number_of_points_ );
     }
     
     isDual_.resize( dims_.size(), 0 );
     
-    cdata_ = new complex<double>[dims_[0]*dims_[1]*dims_[2]];
+    cdata_ = FieldMemoryPool::allocateComplex( dims_[0]*dims_[1]*dims_[2] );
     
     data_3D= new complex<double> **[dims_[0]];
     for( unsigned int i=0; i<dims_[0]; i++ ) {
@@ -118,7 +120,7 @@ void cField3D::allocateDims()
 
 void cField3D::deallocateDataAndSetTo( Field* f )
 {
-    delete [] cdata_;
+    FieldMemoryPool::releaseComplex( cdata_, number_of_points_ );
     cdata_ = NULL;
     delete [] data_3D;
     data_3D = NULL;
@@ -147,7 +149,7 @@ void cField3D::allocateDims( unsigned int mainDim, bool isPrimal )
         ERROR( "Alloc error must be 3 : " << dims_.size() );
     }
     if( cdata_ ) {
-        delete [] cdata_;
+        FieldMemoryPool::releaseComplex( cdata_, number_of_points_ );
     }
     
     // isPrimal define if mainDim is Primal or Dual
@@ -164,7 +166,7 @@ void cField3D::allocateDims( unsigned int mainDim, bool isPrimal )
         dims_[j] += isDual_[j];
     }
     
-    cdata_ = new complex<double>[dims_[0]*dims_[1]*dims_[2]];
+    cdata_ = FieldMemoryPool::allocateComplex( dims_[0]*dims_[1]*dims_[2] );
     //! \todo{check row major order!!! (JD)}
     
     data_3D= new complex<double> **[dims_[0]];
@@ -15,6 +15,7 @@ Ionization::Ionization(Params &params, Species *species)
     nDim_field = params.nDim_field;
     nDim_particle = params.nDim_particle;
     ionized_species_invmass = 1. / species->mass_;
+    random_stream_ = Random::stream( Random::ionization_process, species->species_number_ );
 
     // Normalization constant from Smilei normalization to/from atomic units
     eV_to_au   = 1.0 / 27.2116;
@@ -45,6 +45,9 @@ protected:
     unsigned int nDim_field;
     unsigned int nDim_particle;
     double ionized_species_invmass;
+    
+    //! Stream of the counter-based random numbers of this species
+    uint32_t random_stream_;
 
 private:
 
@@ -0,0 +1,116 @@
+#include "IonizationRateTable.h"
+
+using namespace std;
+
+map<string, unique_ptr<IonizationRateTable> > IonizationRateTable::tables_;
+
+const IonizationRateTable *IonizationRateTable::get( string key, LogRate log_rate, vector<double> umax, double dt, double tolerance )
+{
+    IonizationRateTable *table;
+    #pragma omp critical
+    {
+        map<string, unique_ptr<IonizationRateTable> >::iterator it = tables_.find( key );
+        if( it != tables_.end() ) {
+            table = it->second.get();
+        } else {
+            table = new IonizationRateTable();
+            table->umax_ = umax;
+            if( ! table->build( log_rate, dt, tolerance ) ) {
+                delete table;
+                table = NULL;
+            }
+            // Failures are also kept, so that the tables are not built again in each patch
+            tables_[key].reset( table );
+        }
+    }
+    return table;
+}
+
+bool IonizationRateTable::build( LogRate &log_rate, double dt, double tolerance )
+{
+    // Rates below which the ionization probability during one timestep is negligible
+    const double log_rate_min = log( 1e-30 / dt );
+    // Range of u searched for the lowest relevant rate, and step of the search
+    const double search_range = log( 1e4 ), search_step = 0.01;
+    // Initial step of the tables
+    const double du0 = 0.1;
+    // Largest number of intervals for one charge state
+    const unsigned int max_intervals = 1 << 16;
+
+    unsigned int nZ = umax_.size();
+    umin_.resize( nZ );
+    inv_du_.resize( nZ );
+    offset_.resize( nZ );
+    number_of_intervals_.resize( nZ );
+    coefficients_.clear();
+
+    double f, df;
+    for( unsigned int Z = 0; Z < nZ; Z++ ) {
+
+        // Find the lowest u where the rate is relevant
+        umin_[Z] = umax_[Z];
+        for( double u = umax_[Z] - search_range; u < umax_[Z]; u += search_step ) {
+            log_rate( Z, u, f, df );
+            if( f > log_rate_min ) {
+                // Refine by bisection
+                double u1 = u - search_step, u2 = u;
+                for( unsigned int i = 0; i < 30; i++ ) {
+                    double um = 0.5*( u1 + u2 );
+                    log_rate( Z, um, f, df );
+                    ( f > log_rate_min ? u2 : u1 ) = um;
+                }
+                umin_[Z] = u1;
+                break;
+            }
+        }
+
+        offset_[Z] = coefficients_.size() / 4;
+        number_of_intervals_[Z] = 0;
+        inv_du_[Z] = 0.;
+        if( umin_[Z] >= umax_[Z] ) {
+            continue;
+        }
+
+        // Refine the table until the tolerance is reached
+        unsigned int n = ( unsigned int ) ceil( ( umax_[Z] - umin_[Z] ) / du0 );
+        vector<double> c;
+        while( true ) {
+            double du = ( umax_[Z] - umin_[Z] ) / n;
+            vector<double> values( n+1 ), derivatives( n+1 );
+            for( unsigned int i = 0; i <= n; i++ ) {
+                log_rate( Z, umin_[Z] + i*du, values[i], derivatives[i] );
+                derivatives[i] *= du;
+            }
+            // Cubic Hermite polynomials in t = ( u - u_i ) / du
+            c.resize( 4*n );
+            for( unsigned int i = 0; i < n; i++ ) {
+                c[4*i  ] = values[i];
+                c[4*i+1] = derivatives[i];
+                c[4*i+2] = 3.*( values[i+1] - values[i] ) - 2.*derivatives[i] - derivatives[i+1];
+                c[4*i+3] = 2.*( values[i] - values[i+1] ) + derivatives[i] + derivatives[i+1];
+            }
+            // Maximum relative error of the rates, inside the intervals
+            double error = 0.;
+            for( unsigned int i = 0; i < n; i++ ) {
+                for( double t = 0.25; t < 1.; t += 0.25 ) {
+                    log_rate( Z, umin_[Z] + ( i+t )*du, f, df );
+                    double p = c[4*i] + t*( c[4*i+1] + t*( c[4*i+2] + t*c[4*i+3] ) );
+                    error = max( error, abs( expm1( p - f ) ) );
+                }
+            }
+            if( error <= tolerance ) {
+                break;
+            }
+            if( 2*n > max_intervals ) {
+                return false;
+            }
+            n *= 2;
+        }
+
+        inv_du_[Z] = n / ( umax_[Z] - umin_[Z] );
+        number_of_intervals_[Z] = n;
+        coefficients_.insert( coefficients_.end(), c.begin(), c.end() );
+    }
+
+    return true;
+}
@@ -0,0 +1,72 @@
+#ifndef IONIZATIONRATETABLE_H
+#define IONIZATIONRATETABLE_H
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class IonizationRateTable
+//! Ionization rates of all the charge states of an atom, tabulated as functions of u = log(E).
+//! The log of each rate is interpolated by cubic Hermite polynomials on a uniform grid of u,
+//! refined until the relative error of the rates is below a given tolerance.
+//! The rates are zero below the table (the probability of ionization would be below 1e-30)
+//! and must be computed exactly above the table.
+//  --------------------------------------------------------------------------------------------------------------------
+class IonizationRateTable
+{
+public:
+
+    //! Log of the rate, and its derivative with respect to u, for a charge state Z and u = log(E)
+    typedef std::function<void( unsigned int Z, double u, double &log_rate, double &derivative )> LogRate;
+
+    // -------------------------------------------------------------------------
+    //! Tables shared by all the patches, built at the first request of a given key
+    //! @param key identifies the atom, the model and the parameters of the rates
+    //! @param umax for each charge state, the largest u of the table
+    //! @return NULL if the tolerance could not be reached
+    // -------------------------------------------------------------------------
+    static const IonizationRateTable *get( std::string key, LogRate log_rate, std::vector<double> umax, double dt, double tolerance );
+
+    //! Tabulated rate for the charge state Z and u = log(E), to be used only when u < umax_[Z]
+    inline double rate( int Z, double u ) const
+    {
+        double x = ( u - umin_[Z] ) * inv_du_[Z];
+        if( x < 0. || number_of_intervals_[Z] == 0 ) {
+            return 0.;
+        }
+        unsigned int i = std::min( ( unsigned int ) x, number_of_intervals_[Z] - 1 );
+        double t = x - ( double ) i;
+        const double *c = &coefficients_[4*( offset_[Z] + i )];
+        return std::exp( c[0] + t*( c[1] + t*( c[2] + t*c[3] ) ) );
+    }
+
+    //! Smallest u of each charge state
+    std::vector<double> umin_;
+    //! Largest u of each charge state
+    std::vector<double> umax_;
+
+private:
+
+    //! Builds the tables, returns false if the tolerance could not be reached
+    bool build( LogRate &log_rate, double dt, double tolerance );
+
+    //! Inverse of the step in u of each charge state
+    std::vector<double> inv_du_;
+    //! Index of the first interval of each charge state
+    std::vector<unsigned int> offset_;
+    //! Number of intervals of each charge state
+    std::vector<unsigned int> number_of_intervals_;
+    //! Coefficients of the polynomials, 4 per interval
+    std::vector<double> coefficients_;
+
+    //! All the tables already built, owned by the map so that they are deleted at exit
+    static std::map<std::string, std::unique_ptr<IonizationRateTable> > tables_;
+
+};//END class IonizationRateTable
+
+#endif
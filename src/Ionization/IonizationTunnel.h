@@ -3,9 +3,11 @@
 
 #include <cmath>
 #include <functional>
+#include <sstream>
 #include <vector>
 
 #include "Ionization.h"
+#include "IonizationRateTable.h"
 #include "IonizationTables.h"
 #include "Particles.h"
 #include "Species.h"
@@ -35,6 +37,15 @@ class IonizationTunnel : public Ionization
    private:
     inline double ionizationRate(const int Z, const double E);
 
+    //! Rate from the tables when available, from the exact formula otherwise
+    inline double tabulatedRate(const int Z, const double E);
+
+    //! Log of the tunnel rate and its derivative with respect to u = log(E), used to build the tables
+    inline void logTunnelRate(const unsigned int Z, const double u, double &log_rate, double &derivative);
+
+    //! Rate after barrier suppression, from the tunnel rate
+    inline double barrierSuppression(const int Z, const double E, const double tunnel_rate);
+
     static constexpr double one_third = 1. / 3.;
     unsigned int atomic_number_;
     std::vector<double> Potential, Azimuthal_quantum_number;
@@ -42,6 +53,17 @@ class IonizationTunnel : public Ionization
 
     // Tong&Lin
     std::vector<double> lambda_tunnel;
+
+    // KAG: ratio of the hydrogen ionization potential to that of the ion
+    std::vector<double> ratio_of_IPs_;
+
+    //! Tabulated rates, shared by all patches (NULL when the exact formula is used)
+    const IonizationRateTable *rate_table_;
+
+    //! Buffers of the field, of the first rate, of the probability of no ionization, and of the random number
+    std::vector<double> E_buffer_, rate_buffer_, P0_buffer_, ran_buffer_;
+    //! Buffer of the particles (relative to ipart_min) that ionize at least once
+    std::vector<unsigned int> ionizing_;
 };
 
 template <int Model>
@@ -77,6 +99,9 @@ IonizationTunnel<Model>::IonizationTunnel(Params &params, Species *species) : Io
                                                                        // Laser Phys. Lett. 17 025301 2020].
         lambda_tunnel.resize(atomic_number_);
     }
+    if (Model == 2) {
+        ratio_of_IPs_.resize(atomic_number_);
+    }
 
     for (unsigned int Z = 0; Z < atomic_number_; Z++) {
         DEBUG("Z : " << Z);
@@ -113,6 +138,31 @@ IonizationTunnel<Model>::IonizationTunnel(Params &params, Species *species) : Io
         if (Model == 1) {
             lambda_tunnel[Z] = ionization_tl_parameter * cst * cst / gamma_tunnel[Z];
         }
+        if (Model == 2) {
+            constexpr double IH = 13.598434005136;
+            ratio_of_IPs_[Z] = IH / IonizationTables::ionization_energy(atomic_number_, Z);
+        }
+    }
+
+    // Tables of the rates, up to the field where the barrier is fully suppressed (delta = 1)
+    rate_table_ = NULL;
+    if (species->ionization_tolerance_ > 0.) {
+        std::ostringstream key;
+        key.precision(17);
+        key << tunneling_model << " " << Model << " " << atomic_number_ << " " << species->ionization_tl_parameter_ << " "
+            << au_to_w0 << " " << dt << " " << species->ionization_tolerance_;
+        std::vector<double> umax(atomic_number_);
+        for (unsigned int Z = 0; Z < atomic_number_; Z++) {
+            umax[Z] = log(gamma_tunnel[Z]);
+        }
+        rate_table_ = IonizationRateTable::get(
+            key.str(),
+            [this](unsigned int Z, double u, double &f, double &df) { logTunnelRate(Z, u, f, df); },
+            umax, dt, species->ionization_tolerance_);
+        if (!rate_table_) {
+            WARNING("For species " << species->name_ << ": the ionization rates cannot be tabulated with the tolerance "
+                    << species->ionization_tolerance_ << ", the exact formula is used");
+        }
     }
 
     DEBUG("Finished Creating the Tunnel Ionizaton class");
@@ -135,31 +185,85 @@ inline void IonizationTunnel<Model>::operator()(Particles *particles, unsigned i
     double *Ey = &((*Epart)[1 * nparts]);
     double *Ez = &((*Epart)[2 * nparts]);
 
-    for (unsigned int ipart = ipart_min; ipart < ipart_max; ipart++) {
-        // Current charge state of the ion
-        Z = (unsigned int)(particles->charge(ipart));
+    if (ipart_max <= ipart_min) {
+        return;
+    }
+    const unsigned int n = ipart_max - ipart_min;
+    E_buffer_.resize(n);
+    rate_buffer_.resize(n);
+    P0_buffer_.resize(n);
+    ran_buffer_.resize(n);
+    double *const __restrict__ Eabs = E_buffer_.data();
+    double *const __restrict__ rate = rate_buffer_.data();
+    double *const __restrict__ P0 = P0_buffer_.data();
+    double *const __restrict__ ran = ran_buffer_.data();
+    const short *const __restrict__ charge = particles->getPtrCharge() + ipart_min;
+    const double *const __restrict__ Exi = Ex + ipart_min - ipart_ref;
+    const double *const __restrict__ Eyi = Ey + ipart_min - ipart_ref;
+    const double *const __restrict__ Ezi = Ez + ipart_min - ipart_ref;
+
+    // Absolute value of the electric field normalized in atomic units
+    #pragma omp simd
+    for (unsigned int i = 0; i < n; i++) {
+        Eabs[i] = EC_to_au * sqrt(Exi[i] * Exi[i] + Eyi[i] * Eyi[i] + Ezi[i] * Ezi[i]);
+    }
 
-        // If ion already fully ionized then skip
-        if (Z == atomic_number_) {
+    // Rate of the first ionization (particles already fully ionized, or in a too small field, are skipped later)
+    if (rate_table_) {
+        const IonizationRateTable &table = *rate_table_;
+        #pragma omp simd
+        for (unsigned int i = 0; i < n; i++) {
+            const int Zi = std::min((int)charge[i], (int)atomic_number_ - 1);
+            const double u = log(std::max(Eabs[i], 1e-10));
+            // Above the table, the rate is computed exactly in the next loop
+            rate[i] = u < table.umax_[Zi] ? table.rate(Zi, u) : -1.;
+        }
+    }
+    for (unsigned int i = 0; i < n; i++) {
+        Z = (unsigned int)charge[i];
+        if (Z == atomic_number_ || Eabs[i] < 1e-10) {
             continue;
         }
+        if (rate_table_) {
+            rate[i] = rate[i] < 0. ? ionizationRate(Z, Eabs[i]) : barrierSuppression(Z, Eabs[i], rate[i]);
+        } else {
+            rate[i] = ionizationRate(Z, Eabs[i]);
+        }
+    }
+
+    // Counter-based random numbers for all the particles
+    patch->rand_->uniforms( random_stream_, 0, ipart_min, n, ran );
 
-        // Absolute value of the electric field normalized in atomic units
-        E = EC_to_au * sqrt(*(Ex + ipart - ipart_ref) * *(Ex + ipart - ipart_ref) +
-                            *(Ey + ipart - ipart_ref) * *(Ey + ipart - ipart_ref) +
-                            *(Ez + ipart - ipart_ref) * *(Ez + ipart - ipart_ref));
-        if (E < 1e-10) {
+    // --------------------------------
+    // Start of the Monte-Carlo routine
+    // --------------------------------
+
+    // Particles that ionize at least once
+    ionizing_.clear();
+    for (unsigned int i = 0; i < n; i++) {
+        Z = (unsigned int)charge[i];
+        if (Z == atomic_number_ || Eabs[i] < 1e-10) {
             continue;
         }
+        P0[i] = exp(-rate[i] * dt);
+        if (Z + 1 == atomic_number_ ? ran[i] < 1.0 - P0[i] : P0[i] < ran[i]) {
+            ionizing_.push_back(i);
+        }
+    }
+
+    // Only the particles that ionize create electrons and ionization currents
+    for (unsigned int ii = 0; ii < ionizing_.size(); ii++) {
+        const unsigned int irel = ionizing_[ii];
+        const unsigned int ipart = ipart_min + irel;
 
-        // --------------------------------
-        // Start of the Monte-Carlo routine
-        // --------------------------------
+        // Current charge state of the ion
+        Z = (unsigned int)(particles->charge(ipart));
+        E = Eabs[irel];
 
         invE = 1. / E;
         factorJion = factorJion_0 * invE * invE;
-        ran_p = patch->rand_->uniform();
-        IonizRate_tunnel[Z] = ionizationRate(Z, E);
+        ran_p = ran[irel];
+        IonizRate_tunnel[Z] = rate[irel];
 
         // Total ionization potential (used to compute the ionization current)
         TotalIonizPot = 0.0;
@@ -171,10 +275,8 @@ inline void IonizationTunnel<Model>::operator()(Particles *particles, unsigned i
         if (Zp1 == atomic_number_) {
             // if ionization of the last electron: single ionization
             // -----------------------------------------------------
-            if (ran_p < 1.0 - exp(-IonizRate_tunnel[Z] * dt)) {
-                TotalIonizPot += Potential[Z];
-                k_times = 1;
-            }
+            TotalIonizPot += Potential[Z];
+            k_times = 1;
 
         } else {
             // else : multiple ionization can occur in one time-step
@@ -185,13 +287,13 @@ inline void IonizationTunnel<Model>::operator()(Particles *particles, unsigned i
             // initialization
             Mult = 1.0;
             Dnom_tunnel[0] = 1.0;
-            Pint_tunnel = exp(-IonizRate_tunnel[Z] * dt);  // cummulative prob.
+            Pint_tunnel = P0[irel];  // cummulative prob.
 
             // multiple ionization loop while Pint_tunnel < ran_p and still partial
             // ionization
             while ((Pint_tunnel < ran_p) and (k_times < atomic_number_ - Zp1)) {
                 newZ = Zp1 + k_times;
-                IonizRate_tunnel[newZ] = ionizationRate(newZ, E);
+                IonizRate_tunnel[newZ] = tabulatedRate(newZ, E);
                 D_sum = 0.0;
                 P_sum = 0.0;
                 Mult *= IonizRate_tunnel[Z + k_times];
@@ -230,27 +332,25 @@ inline void IonizationTunnel<Model>::operator()(Particles *particles, unsigned i
         // (variable weights are used)
         // -----------------------------
 
-        if (k_times != 0) {
-            new_electrons.createParticle();
-            int idNew = new_electrons.size() - 1;
-            for (unsigned int i = 0; i < new_electrons.dimension(); i++) {
-                new_electrons.position(i, idNew) = particles->position(i, ipart);
-            }
-            for (unsigned int i = 0; i < 3; i++) {
-                new_electrons.momentum(i, idNew) = particles->momentum(i, ipart) * ionized_species_invmass;
-            }
-            new_electrons.weight(idNew) = double(k_times) * particles->weight(ipart);
-            new_electrons.charge(idNew) = -1;
-
-            if (save_ion_charge_) {
-                ion_charge_.push_back(particles->charge(ipart));
-            }
+        new_electrons.createParticle();
+        int idNew = new_electrons.size() - 1;
+        for (unsigned int i = 0; i < new_electrons.dimension(); i++) {
+            new_electrons.position(i, idNew) = particles->position(i, ipart);
+        }
+        for (unsigned int i = 0; i < 3; i++) {
+            new_electrons.momentum(i, idNew) = particles->momentum(i, ipart) * ionized_species_invmass;
+        }
+        new_electrons.weight(idNew) = double(k_times) * particles->weight(ipart);
+        new_electrons.charge(idNew) = -1;
 
-            // Increase the charge of the particle
-            particles->charge(ipart) += k_times;
+        if (save_ion_charge_) {
+            ion_charge_.push_back(particles->charge(ipart));
         }
 
-    }  // Loop on particles
+        // Increase the charge of the particle
+        particles->charge(ipart) += k_times;
+
+    }  // Loop on ionizing particles
 }
 
 template <int Model>
@@ -260,6 +360,38 @@ inline double IonizationTunnel<Model>::ionizationRate(const int Z, const double
     return beta_tunnel[Z] * exp(-delta * one_third + alpha_tunnel[Z] * log(delta));
 }
 
+template <int Model>
+inline double IonizationTunnel<Model>::tabulatedRate(const int Z, const double E)
+{
+    if (rate_table_) {
+        const double u = log(E);
+        if (u < rate_table_->umax_[Z]) {
+            return barrierSuppression(Z, E, rate_table_->rate(Z, u));
+        }
+    }
+    return ionizationRate(Z, E);
+}
+
+template <int Model>
+inline void IonizationTunnel<Model>::logTunnelRate(const unsigned int Z, const double u, double &log_rate, double &derivative)
+{
+    const double delta = gamma_tunnel[Z] * exp(-u);
+    log_rate = log(beta_tunnel[Z]) - delta * one_third + alpha_tunnel[Z] * log(delta);
+    derivative = delta * one_third - alpha_tunnel[Z];
+    // TODO: C++17: Change into if constexpr
+    if (Model == 1) {
+        const double E = exp(u);
+        log_rate -= E * lambda_tunnel[Z];
+        derivative -= E * lambda_tunnel[Z];
+    }
+}
+
+template <int Model>
+inline double IonizationTunnel<Model>::barrierSuppression(const int, const double, const double tunnel_rate)
+{
+    return tunnel_rate;
+}
+
 // Tong&Ling: 1
 template <>
 inline double IonizationTunnel<1>::ionizationRate(const int Z, const double E)
@@ -270,15 +402,12 @@ inline double IonizationTunnel<1>::ionizationRate(const int Z, const double E)
 
 // BSI: 2
 template <>
-inline double IonizationTunnel<2>::ionizationRate(const int Z, const double E)
+inline double IonizationTunnel<2>::barrierSuppression(const int Z, const double E, const double Tunnel_rate)
 {
-    constexpr double IH = 13.598434005136;
-    double ratio_of_IPs = IH / IonizationTables::ionization_energy(atomic_number_, Z);
+    double ratio_of_IPs = ratio_of_IPs_[Z];
 
     double BSI_rate_quadratic = 2.4 * (E * E) * ratio_of_IPs * ratio_of_IPs * au_to_w0;
     double BSI_rate_linear = 0.8 * E * sqrt(ratio_of_IPs) * au_to_w0;
-    double delta = gamma_tunnel[Z] / E;
-    double Tunnel_rate = beta_tunnel[Z] * exp(-delta / 3.0 + alpha_tunnel[Z] * log(delta));
 
     if (BSI_rate_quadratic >= BSI_rate_linear) {
         return BSI_rate_linear;
@@ -289,4 +418,12 @@ inline double IonizationTunnel<2>::ionizationRate(const int Z, const double E)
     }
 }
 
+template <>
+inline double IonizationTunnel<2>::ionizationRate(const int Z, const double E)
+{
+    double delta = gamma_tunnel[Z] / E;
+    double Tunnel_rate = beta_tunnel[Z] * exp(-delta / 3.0 + alpha_tunnel[Z] * log(delta));
+    return barrierSuppression(Z, E, Tunnel_rate);
+}
+
 #endif
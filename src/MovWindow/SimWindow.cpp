@@ -666,37 +666,30 @@ void SimWindow::shift( VectorPatch &vecPatches, SmileiMPI *smpi, Params &params,
 
 void SimWindow::operate(Region& region,  VectorPatch&, SmileiMPI*, Params& params, double time_dual)
 {
-    region.patch_->exchangeField_movewin( region.patch_->EMfields->Ex_, params.patch_size_[0] );
-    region.patch_->exchangeField_movewin( region.patch_->EMfields->Ey_, params.patch_size_[0] );
-    region.patch_->exchangeField_movewin( region.patch_->EMfields->Ez_, params.patch_size_[0] );
+    // All the fields of the region are shifted together, in a single message
+    ElectroMagn *EMfields = region.patch_->EMfields;
+    vector<Field *> fields = { EMfields->Ex_, EMfields->Ey_, EMfields->Ez_ };
     
-    if (region.patch_->EMfields->Bx_->data_!= region.patch_->EMfields->Bx_m->data_) {
-        region.patch_->exchangeField_movewin( region.patch_->EMfields->Bx_, params.patch_size_[0] );
-        region.patch_->exchangeField_movewin( region.patch_->EMfields->By_, params.patch_size_[0] );
-        region.patch_->exchangeField_movewin( region.patch_->EMfields->Bz_, params.patch_size_[0] );
+    if (EMfields->Bx_->data_!= EMfields->Bx_m->data_) {
+        fields.insert( fields.end(), { EMfields->Bx_, EMfields->By_, EMfields->Bz_ } );
     }
     
-    region.patch_->exchangeField_movewin( region.patch_->EMfields->Bx_m, params.patch_size_[0] );
-    region.patch_->exchangeField_movewin( region.patch_->EMfields->By_m, params.patch_size_[0] );
-    region.patch_->exchangeField_movewin( region.patch_->EMfields->Bz_m, params.patch_size_[0] );
+    fields.insert( fields.end(), { EMfields->Bx_m, EMfields->By_m, EMfields->Bz_m } );
 
     if (params.is_spectral) {
-        region.patch_->exchangeField_movewin( region.patch_->EMfields->rho_, params.patch_size_[0] );
-        region.patch_->exchangeField_movewin( region.patch_->EMfields->rhoold_, params.patch_size_[0] );
+        fields.insert( fields.end(), { EMfields->rho_, EMfields->rhoold_ } );
     }
 
     for( unsigned int bcId=2; bcId<2*params.nDim_field; bcId++ ){
-        if( (dynamic_cast<ElectroMagnBC2D_PML *>( region.patch_->EMfields->emBoundCond[bcId] ) || dynamic_cast<ElectroMagnBC3D_PML *>( region.patch_->EMfields->emBoundCond[bcId] )) ){
-            if( dynamic_cast<ElectroMagnBC2D_PML *>( region.patch_->EMfields->emBoundCond[bcId] )){
-                ElectroMagnBC2D_PML *embc = static_cast<ElectroMagnBC2D_PML *>( region.patch_->EMfields->emBoundCond[bcId] );
-                exchangePML_movewin( region, embc, params.patch_size_[0] );
-            } else {
-                ElectroMagnBC3D_PML *embc = static_cast<ElectroMagnBC3D_PML *>( region.patch_->EMfields->emBoundCond[bcId] );
-                exchangePML_movewin( region, embc, params.patch_size_[0] );
-            }
+        if( dynamic_cast<ElectroMagnBC2D_PML *>( EMfields->emBoundCond[bcId] ) ){
+            addPMLFields_movewin( static_cast<ElectroMagnBC2D_PML *>( EMfields->emBoundCond[bcId] ), fields );
+        } else if( dynamic_cast<ElectroMagnBC3D_PML *>( EMfields->emBoundCond[bcId] ) ){
+            addPMLFields_movewin( static_cast<ElectroMagnBC3D_PML *>( EMfields->emBoundCond[bcId] ), fields );
         }
     }
 
+    region.patch_->exchangeFields_movewin( fields, params.patch_size_[0] );
+
     //DoubleGrids::syncFieldsOnRegion( vecPatches, region, params, smpi );
 
     region.patch_->EMfields->laserDisabled();
@@ -722,46 +715,37 @@ void SimWindow::operate(Region& region,  VectorPatch&, SmileiMPI*, Params& param
 {
     ElectroMagnAM * region_fields = static_cast<ElectroMagnAM *>( region.patch_->EMfields );
    
+    // All the fields of all the modes are shifted together, in a single message
+    vector<Field *> fields;
     for (unsigned int imode = 0; imode < nmodes; imode++){
-        region.patch_->exchangeField_movewin( region_fields->El_[imode], params.patch_size_[0] );
-        region.patch_->exchangeField_movewin( region_fields->Er_[imode], params.patch_size_[0] );
-        region.patch_->exchangeField_movewin( region_fields->Et_[imode], params.patch_size_[0] );
+        fields.insert( fields.end(), { region_fields->El_[imode], region_fields->Er_[imode], region_fields->Et_[imode] } );
         
         if (region_fields->Bl_[imode]->cdata_!= region_fields->Bl_m[imode]->cdata_) {
-            region.patch_->exchangeField_movewin( region_fields->Bl_[imode], params.patch_size_[0] );
-            region.patch_->exchangeField_movewin( region_fields->Br_[imode], params.patch_size_[0] );
-            region.patch_->exchangeField_movewin( region_fields->Bt_[imode], params.patch_size_[0] );
+            fields.insert( fields.end(), { region_fields->Bl_[imode], region_fields->Br_[imode], region_fields->Bt_[imode] } );
         }
 
-        region.patch_->exchangeField_movewin( region_fields->Bl_m[imode], params.patch_size_[0] );
-        region.patch_->exchangeField_movewin( region_fields->Br_m[imode], params.patch_size_[0] );
-        region.patch_->exchangeField_movewin( region_fields->Bt_m[imode], params.patch_size_[0] );
+        fields.insert( fields.end(), { region_fields->Bl_m[imode], region_fields->Br_m[imode], region_fields->Bt_m[imode] } );
 
         if (params.is_spectral) {
-            region.patch_->exchangeField_movewin( region_fields->rho_AM_[imode], params.patch_size_[0] );
-            region.patch_->exchangeField_movewin( region_fields->rho_old_AM_[imode], params.patch_size_[0] );
+            fields.insert( fields.end(), { region_fields->rho_AM_[imode], region_fields->rho_old_AM_[imode] } );
         }
 
         if( dynamic_cast<ElectroMagnBCAM_PML *>( region.patch_->EMfields->emBoundCond[3] )){
             ElectroMagnBCAM_PML *embc = static_cast<ElectroMagnBCAM_PML *>( region_fields->emBoundCond[3] );
             if (embc->Hl_[imode]) {
-                region.patch_->exchangeField_movewin( embc->Hl_[imode], params.patch_size_[0] );
-                region.patch_->exchangeField_movewin( embc->Hr_[imode], params.patch_size_[0] );
-                region.patch_->exchangeField_movewin( embc->Ht_[imode], params.patch_size_[0] );
-                region.patch_->exchangeField_movewin( embc->Bl_[imode], params.patch_size_[0] );
-                region.patch_->exchangeField_movewin( embc->Br_[imode], params.patch_size_[0] );
-                region.patch_->exchangeField_movewin( embc->Bt_[imode], params.patch_size_[0] );
-                region.patch_->exchangeField_movewin( embc->El_[imode], params.patch_size_[0] );
-                region.patch_->exchangeField_movewin( embc->Er_[imode], params.patch_size_[0] );
-                region.patch_->exchangeField_movewin( embc->Et_[imode], params.patch_size_[0] );
-                region.patch_->exchangeField_movewin( embc->Dl_[imode], params.patch_size_[0] );
-                region.patch_->exchangeField_movewin( embc->Dr_[imode], params.patch_size_[0] );
-                region.patch_->exchangeField_movewin( embc->Dt_[imode], params.patch_size_[0] );
+                fields.insert( fields.end(), {
+                    embc->Hl_[imode], embc->Hr_[imode], embc->Ht_[imode],
+                    embc->Bl_[imode], embc->Br_[imode], embc->Bt_[imode],
+                    embc->El_[imode], embc->Er_[imode], embc->Et_[imode],
+                    embc->Dl_[imode], embc->Dr_[imode], embc->Dt_[imode]
+                } );
             }
 
         }
     }
 
+    region.patch_->exchangeFields_movewin( fields, params.patch_size_[0] );
+
     //DoubleGrids::syncFieldsOnRegion( vecPatches, region, params, smpi );
 
     region_fields->laserDisabled();
@@ -781,20 +765,13 @@ void SimWindow::operate(Region& region,  VectorPatch&, SmileiMPI*, Params& param
 }
 
 template <typename Tpml>
-void  SimWindow::exchangePML_movewin( Region& region, Tpml embc, int clrw ) {
+void  SimWindow::addPMLFields_movewin( Tpml embc, vector<Field *> &fields ) {
                 if (embc->Hx_) {
-                    region.patch_->exchangeField_movewin( embc->Hx_, clrw );
-                    region.patch_->exchangeField_movewin( embc->Hy_, clrw );
-                    region.patch_->exchangeField_movewin( embc->Hz_, clrw );
-                    region.patch_->exchangeField_movewin( embc->Bx_, clrw );
-                    region.patch_->exchangeField_movewin( embc->By_, clrw );
-                    region.patch_->exchangeField_movewin( embc->Bz_, clrw );
-                    region.patch_->exchangeField_movewin( embc->Ex_, clrw );
-                    region.patch_->exchangeField_movewin( embc->Ey_, clrw );
-                    region.patch_->exchangeField_movewin( embc->Ez_, clrw );
-                    region.patch_->exchangeField_movewin( embc->Dx_, clrw );
-                    region.patch_->exchangeField_movewin( embc->Dy_, clrw );
-                    region.patch_->exchangeField_movewin( embc->Dz_, clrw );
+                    fields.insert( fields.end(), {
+                        embc->Hx_, embc->Hy_, embc->Hz_,
+                        embc->Bx_, embc->By_, embc->Bz_,
+                        embc->Ex_, embc->Ey_, embc->Ez_,
+                        embc->Dx_, embc->Dy_, embc->Dz_
+                    } );
                 }
 }
-
@@ -30,8 +30,9 @@ public:
     
     void operate( Region& region,  VectorPatch& vecPatches, SmileiMPI* smpi, Params& param, double time_dual );
     void operate( Region& region,  VectorPatch& vecPatches, SmileiMPI* smpi, Params& param, double time_dual, unsigned int nmodes );
+    //! Adds the fields of a PML to the fields shifted by operate
     template <typename Tpml>
-    void  exchangePML_movewin( Region& region, Tpml embc, int clrw );
+    void  addPMLFields_movewin( Tpml embc, std::vector<Field *> &fields );
 
     //! Tells whether there is a moving window or not
     inline bool isActive()
@@ -57,6 +57,7 @@ MultiphotonBreitWheeler::MultiphotonBreitWheeler( Params &params, Species *speci
 
     // Local random generator
     rand_ = rand;
+    random_stream_ = Random::stream( Random::multiphoton_process, species->species_number_ );
 
 }
 
@@ -329,6 +330,10 @@ void MultiphotonBreitWheeler::operator()( Particles &particles,
         if( ( photon_gamma[ipart] > 2. ) && ( photon_chi[ipart] > chiph_threshold_ ) ) {
             // Init local variables
             event_time = 0;
+#ifndef SMILEI_ACCELERATOR_GPU_OACC
+            // Number of random numbers drawn for this photon
+            uint32_t idraw = 0;
+#endif
 
             // New even
             // If tau[ipart] <= 0, this is a new process
@@ -338,7 +343,7 @@ void MultiphotonBreitWheeler::operator()( Particles &particles,
                     //tau[ipart] = -log( 1.-Rand::uniform() );
                     
 #ifndef SMILEI_ACCELERATOR_GPU_OACC
-                    tau[ipart] = -std::log( 1.-rand_->uniform() );
+                    tau[ipart] = rand_->exponential( random_stream_, idraw++, ipart );
 #else
                     
                     seed_curand_1 = (int) (ipart+1)*(initial_seed_1+1); //Seed for linear generator
@@ -392,7 +397,7 @@ void MultiphotonBreitWheeler::operator()( Particles &particles,
 
                     // Draw random number in [0,1[
 #ifndef SMILEI_ACCELERATOR_GPU_OACC
-                    const double random_number = rand_->uniform();
+                    const double random_number = rand_->uniform( random_stream_, idraw++, ipart );
 #else
                     seed_curand_2 = (int) (ipart + 1)*(initial_seed_2 + 1); //Seed for linear generator
                     //seed_curand_2 = std::fmod(a * seed_curand_2 + c, m); //Linear generator
@@ -164,6 +164,9 @@ private:
 
     //! Local random generator
     Random * rand_;
+    
+    //! Stream of the counter-based random numbers of this species
+    uint32_t random_stream_;
 
     // _________________________________________
     // Factors
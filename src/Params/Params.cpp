@@ -223,6 +223,9 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
         Rand::gen = std::mt19937( random_seed );
     }
 
+    // Whether python profiles are compiled into elementary operations
+    PyTools::extract( "compile_profiles", compile_profiles, "Main" );
+
     // communication pattern initialized as partial B exchange
     full_B_exchange = false;
     // communication pattern initialized as partial A, Phi exchange for envelope simulations
@@ -548,6 +551,13 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
     PyTools::extract( "solve_relativistic_poisson", solve_relativistic_poisson, "Main"   );
     PyTools::extract( "relativistic_poisson_max_iteration", relativistic_poisson_max_iteration, "Main"   );
     PyTools::extract( "relativistic_poisson_max_error", relativistic_poisson_max_error, "Main"   );
+    PyTools::extract( "poisson_solver", poisson_solver, "Main"   );
+    if( poisson_solver != "CG" && poisson_solver != "PCG" ) {
+        ERROR_NAMELIST( "Main.poisson_solver must be \"CG\" or \"PCG\"", LINK_NAMELIST + std::string("#main-variables") );
+    }
+    if( poisson_solver == "PCG" && geometry == "AMcylindrical" ) {
+        ERROR_NAMELIST( "Main.poisson_solver = \"PCG\" is not available in AMcylindrical geometry", LINK_NAMELIST + std::string("#main-variables") );
+    }
 
     // Use BTIS3 interpolation method to reduce the effects of numerical Cherenkov radiation
     // This method is detailed in P.-L. Bourgeois and X. Davoine (2023) https://doi.org/10.1017/S0022377823000223
@@ -562,6 +572,7 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
     }
     
     // Current filter properties
+    currentFilter_single_exchange = false;
     int nCurrentFilter = PyTools::nComponents( "CurrentFilter" );
     for( int ifilt = 0; ifilt < nCurrentFilter; ifilt++ ) {
         PyTools::extract( "model", currentFilter_model, "CurrentFilter", ifilt );
@@ -589,6 +600,8 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
         } else if( currentFilter_passes.size() != nDim_field ) {
             ERROR_NAMELIST( "passes in block 'CurrentFilter' must be the same size as the number of field dimensions",  LINK_NAMELIST + std::string("#current-filtering") );
         }
+
+        PyTools::extract( "single_exchange", currentFilter_single_exchange, "CurrentFilter", ifilt );
     }
 
     // Field filter properties
@@ -731,7 +744,17 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
         PyTools::extract( "cell_load", cell_load, "LoadBalancing"   );
         PyTools::extract( "frozen_particle_load", frozen_particle_load, "LoadBalancing"   );
         PyTools::extract( "initial_balance", initial_balance, "LoadBalancing"   );
+        PyTools::extract( "mode", load_balancing_mode, "LoadBalancing"   );
+        if( load_balancing_mode != "particles" && load_balancing_mode != "measured" ) {
+            ERROR_NAMELIST( "LoadBalancing mode must be `particles` or `measured`", LINK_NAMELIST + std::string("#load-balancing") );
+        }
+        PyTools::extract( "smoothing", load_balancing_smoothing, "LoadBalancing"   );
+        if( load_balancing_smoothing <= 0. || load_balancing_smoothing > 1. ) {
+            ERROR_NAMELIST( "LoadBalancing smoothing must be in ]0, 1]", LINK_NAMELIST + std::string("#load-balancing") );
+        }
     } else {
+        load_balancing_mode = "particles";
+        load_balancing_smoothing = 1.;
         load_balancing_time_selection = new TimeSelection();
     }
 
@@ -744,6 +767,12 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
         ERROR_NAMELIST( "Dynamic load balancing requires to use at least 2 patches per MPI process.",  LINK_NAMELIST + std::string("#main-variables") );
     }
 
+    // Per-patch performance counters of the performances diagnostic
+    patch_timers = false;
+    if( PyTools::nComponents( "DiagPerformances" )>0 ) {
+        PyTools::extract( "patch_timers", patch_timers, "DiagPerformances" );
+    }
+
     mi.resize( 3, 0 );
     while( ( number_of_patches[0] >> mi[0] ) >1 ) {
         mi[0]++ ;
@@ -769,6 +798,7 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
     vectorization_mode = "off";
     has_adaptive_vectorization = false;
     adaptive_vecto_time_selection = nullptr;
+    adaptive_calibration = false;
 
     if( PyTools::nComponents( "Vectorization" )>0 ) {
         // Extraction of the vectorization mode
@@ -820,6 +850,13 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
             ERROR_NAMELIST( "In block `Vectorization`, parameter `initial_mode` must be `off` or `on`",  LINK_NAMELIST + std::string("#vectorization") );
         }
 
+        // Calibration of the particle computation time on this node
+        PyTools::extract( "calibration", adaptive_calibration, "Vectorization"   );
+        PyTools::extract( "calibration_file", adaptive_calibration_file, "Vectorization"   );
+        if( adaptive_calibration && adaptive_calibration_file.empty() ) {
+            ERROR_NAMELIST( "In block `Vectorization`, parameter `calibration_file` must not be empty",  LINK_NAMELIST + std::string("#vectorization") );
+        }
+
         // get parameter "every" which describes a timestep selection
         if( ! adaptive_vecto_time_selection ) {
             adaptive_vecto_time_selection = new TimeSelection(
@@ -867,6 +904,67 @@ Params::Params( SmileiMPI *smpi, std::vector<std::string> namelistsFiles ) :
 
     }
 
+    // Particle dynamics split in tasks per bin
+    PyTools::extract( "dynamics_tasks", dynamics_tasks, "Main" );
+    if( dynamics_tasks ) {
+        if( geometry!="1Dcartesian" && geometry!="2Dcartesian" && geometry!="3Dcartesian" ) {
+            ERROR_NAMELIST( "`dynamics_tasks` is only available in cartesian geometries", LINK_NAMELIST + std::string("#main-variables") );
+        }
+        if( is_spectral || Laser_Envelope_model || gpu_computing ) {
+            ERROR_NAMELIST( "`dynamics_tasks` is not compatible with spectral solvers, envelope models or GPU computing", LINK_NAMELIST + std::string("#main-variables") );
+        }
+        if( interpolation_order != 2 && interpolation_order != 4 ) {
+            ERROR_NAMELIST( "`dynamics_tasks` requires `interpolation_order` 2 or 4", LINK_NAMELIST + std::string("#main-variables") );
+        }
+        if( cell_sorting_ ) {
+            ERROR_NAMELIST( "`dynamics_tasks` is not compatible with vectorization, cell sorting or collisions", LINK_NAMELIST + std::string("#main-variables") );
+        }
+    }
+
+    // Particles exchanged in a single pass, directly towards their final patch
+    PyTools::extract( "single_pass_particle_exchange", single_pass_particle_exchange, "Main" );
+    if( single_pass_particle_exchange && ( geometry == "AMcylindrical" || gpu_computing ) ) {
+        ERROR_NAMELIST( "`single_pass_particle_exchange` is only available in cartesian geometries, and not on GPU", LINK_NAMELIST + std::string("#main-variables") );
+    }
+
+    // Field exchanges aggregated per MPI neighbor
+    PyTools::extract( "aggregate_exchanges", aggregate_exchanges, "Main" );
+    if( aggregate_exchanges && gpu_computing ) {
+        ERROR_NAMELIST( "`aggregate_exchanges` is not compatible with GPU computing", LINK_NAMELIST + std::string("#main-variables") );
+    }
+
+    // Tiles of the Yee solvers
+    PyTools::extract( "solver_tile_size", solver_tile_size, "Main" );
+    if( solver_tile_size > 0 && gpu_computing ) {
+        ERROR_NAMELIST( "`solver_tile_size` is not compatible with GPU computing", LINK_NAMELIST + std::string("#main-variables") );
+    }
+
+    // Memory of the fields kept to be reused by new patches
+    PyTools::extract( "field_memory_pool", field_memory_pool, "Main" );
+    if( field_memory_pool < 0. ) {
+        ERROR_NAMELIST( "`field_memory_pool` must be positive", LINK_NAMELIST + std::string("#main-variables") );
+    }
+    if( field_memory_pool > 0. && gpu_computing ) {
+        ERROR_NAMELIST( "`field_memory_pool` is not compatible with GPU computing", LINK_NAMELIST + std::string("#main-variables") );
+    }
+
+    // Chunks of cells in the dynamics of vectorized species
+    PyTools::extract( "dynamics_chunk_size", dynamics_chunk_size, "Main" );
+    if( dynamics_chunk_size > 0 && gpu_computing ) {
+        ERROR_NAMELIST( "`dynamics_chunk_size` is not compatible with GPU computing", LINK_NAMELIST + std::string("#main-variables") );
+    }
+
+    // Exchange of B overlapped with the Faraday solver inside the patches
+    PyTools::extract( "overlap_field_exchange", overlap_field_exchange, "Main" );
+    if( overlap_field_exchange ) {
+        if( geometry!="1Dcartesian" && geometry!="2Dcartesian" && geometry!="3Dcartesian" ) {
+            ERROR_NAMELIST( "`overlap_field_exchange` is only available in cartesian geometries", LINK_NAMELIST + std::string("#main-variables") );
+        }
+        if( maxwell_sol != "Yee" || gpu_computing ) {
+            ERROR_NAMELIST( "`overlap_field_exchange` requires the Yee solver and is not compatible with GPU computing", LINK_NAMELIST + std::string("#main-variables") );
+        }
+    }
+
     // Read the "print_every" parameter
     print_every = ( int )( simulation_time/timestep )/10;
     PyTools::extractOrNone( "print_every", print_every, "Main" );
@@ -1206,6 +1304,11 @@ void Params::compute()
         } else {
             oversize[i] = interpolation_order + ( exchange_particles_each-1 );
         }
+        // The ghost cells must remain exact after all the filter passes, until the single exchange
+        if( currentFilter_single_exchange ) {
+            unsigned int filter_half_width = currentFilter_model == "customFIR" ? (currentFilter_kernelFIR.size()-1)/2 : 1;
+            oversize[i] = std::max( oversize[i], currentFilter_passes[i] * filter_half_width );
+        }
         global_size_[i] = patch_size_[i];
         patch_size_[i] /= number_of_patches[i];
         if( global_size_[i]%number_of_patches[i] !=0 ) {
@@ -1267,6 +1370,11 @@ void Params::compute()
         }
     }
 
+    // The bins are the units of work shared between threads by dynamics_tasks
+    if( dynamics_tasks && cluster_width_ == ( int )( patch_size_[0] ) ) {
+        WARNING( "`dynamics_tasks` with a single particle bin per patch: reduce `cluster_width` to share patches between threads" );
+    }
+
 
     // Verify that cluster_width_ divides patch_size_[0] or patch_size_[n] in GPU mode
 #if defined( SMILEI_ACCELERATOR_GPU )
@@ -1431,6 +1539,9 @@ void Params::print_init()
                 std::string strpass = (currentFilter_passes[idim] > 1 ? "passes" : "pass");
                 MESSAGE( 1, currentFilter_model << " current filtering: " << currentFilter_passes[idim] << " " << strpass << " along dimension " << idim );
             }
+            if( currentFilter_single_exchange ) {
+                MESSAGE( 1, "Currents exchanged once after all the passes" );
+            }
         }
     }
     if( Friedman_filter ) {
@@ -1448,6 +1559,9 @@ void Params::print_init()
         MESSAGE( 1, "Happens: " << load_balancing_time_selection->info() );
         MESSAGE( 1, "Cell load coefficient = " << cell_load );
         MESSAGE( 1, "Frozen particle load coefficient = " << frozen_particle_load );
+        if( load_balancing_mode == "measured" ) {
+            MESSAGE( 1, "Patch loads measured from wall times (smoothing = " << load_balancing_smoothing << ")" );
+        }
     }
 
     TITLE( "Vectorization: " );
@@ -161,6 +161,8 @@ public:
     unsigned int poisson_max_iteration;
     //! Maxium poisson error tolerated
     double poisson_max_error;
+    //! Poisson solver: "CG" (conjugate gradient) or "PCG" (block-Jacobi preconditioned, one reduction per iteration)
+    std::string poisson_solver;
 
     //"Relativistic" Poisson solver
     //! Do we solve "relativistic poisson problem" for relativistic species
@@ -182,6 +184,8 @@ public:
     std::vector<unsigned int> currentFilter_passes;
     std::string currentFilter_model;
     std::vector<double> currentFilter_kernelFIR;
+    //! Whether all the passes of the current filter are applied before a single exchange (the ghost cells are widened accordingly)
+    bool currentFilter_single_exchange;
 
     //! is Friedman filter applied [Greenwood et al., J. Comp. Phys. 201, 665 (2004)]
     bool Friedman_filter;
@@ -285,6 +289,12 @@ public:
     double cell_load;
     //! Load coefficient applied to a frozen particle (default = 0.1)
     double frozen_particle_load;
+    //! Load estimate used by the balancing: "particles" (particle counts) or "measured" (patch wall times)
+    std::string load_balancing_mode;
+    //! Weight of the latest measurement in the exponential smoothing of the measured patch loads
+    double load_balancing_smoothing;
+    //! Per-patch and per-species performance counters, requested by DiagPerformances (patch_timers)
+    bool patch_timers;
     //! Return if number of patch = number of MPI process, to tune IO //ism
     bool one_patch_per_MPI;
     //! Compute an initially balanced patch distribution right from the start
@@ -294,6 +304,10 @@ public:
     std::string vectorization_mode;
     //! Initial state of the patches in adaptive mode
     std::string adaptive_default_mode;
+    //! Measure the cost of the scalar and vectorized operators at startup, in adaptive mode
+    bool adaptive_calibration;
+    //! File caching the measured costs, per CPU model and build
+    std::string adaptive_calibration_file;
 
     //! Tells whether there is a moving window
     bool hasWindow;
@@ -351,6 +365,9 @@ public:
     //! Random seed
     unsigned int random_seed;
     
+    //! Whether python profiles are compiled into elementary operations evaluated without python
+    bool compile_profiles;
+    
     //! True if python is needed during the PIC loop
     bool keep_python_running_;
     
@@ -379,6 +396,27 @@ public:
     //! flag that tells if cell_sorting is activated
     bool cell_sorting_;
 
+    //! flag that tells if the particle dynamics is scheduled as tasks per bin
+    bool dynamics_tasks;
+
+    //! flag that tells if the particles are exchanged in a single pass, directly towards their final patch
+    bool single_pass_particle_exchange;
+
+    //! flag that tells if the field exchanges between MPI processes are aggregated in one message per neighbor process
+    bool aggregate_exchanges;
+
+    //! flag that tells if the exchange of B starts once the patch borders are updated, before the patch interiors
+    bool overlap_field_exchange;
+
+    //! number of cells of the tiles of the Yee solvers along each dimension but the last one (0 for no tiling)
+    unsigned int solver_tile_size;
+
+    //! memory (in MB per MPI process) of the fields of deleted patches kept to be reused by new patches
+    double field_memory_pool;
+
+    //! number of particles of the chunks of cells in the dynamics of vectorized species (0 for the whole patch)
+    unsigned int dynamics_chunk_size;
+
     //! returns true if the dimension and the interpolation order of the
     //! simulation is supported for the binning.
     //!
@@ -1,5 +1,9 @@
 #include "PartCompTime.h"
 
+bool PartCompTime::calibrated_ = false;
+float PartCompTime::vecto_coefficients_[PartCompTime::n_vecto_coefficients];
+float PartCompTime::scalar_coefficients_[PartCompTime::n_scalar_coefficients];
+
 PartCompTime::PartCompTime( )
 {
 };
@@ -15,3 +19,18 @@ void PartCompTime::operator()(  const std::vector<int> &,
                                 float &,
                                 float &  )
 {};
+
+// -----------------------------------------------------------------------------
+//! Replace the built-in fits of all the operators by the ones measured
+//! on this node
+// -----------------------------------------------------------------------------
+void PartCompTime::setCalibration( const std::vector<double> &vecto, const std::vector<double> &scalar )
+{
+    for( unsigned int i = 0; i < n_vecto_coefficients; i++ ) {
+        vecto_coefficients_[i] = vecto[i];
+    }
+    for( unsigned int i = 0; i < n_scalar_coefficients; i++ ) {
+        scalar_coefficients_[i] = scalar[i];
+    }
+    calibrated_ = true;
+}
@@ -43,6 +43,43 @@ public:
     // -------------------------------------------------------------------------
     inline float __attribute__((always_inline)) getParticleComputationTimeScalar( const float log_particle_number );
     
+    // -------------------------------------------------------------------------
+    //! Replace the built-in fits of all the operators by the ones measured
+    //! on this node
+    //! @param vecto coefficients of the vectorized fit (polynomial of degree 4)
+    //! @param scalar coefficients of the scalar fit (polynomial of degree 1)
+    // -------------------------------------------------------------------------
+    static void setCalibration( const std::vector<double> &vecto, const std::vector<double> &scalar );
+    
+    //! Number of coefficients of the vectorized and scalar fits
+    static const unsigned int n_vecto_coefficients = 5;
+    static const unsigned int n_scalar_coefficients = 2;
+    
+protected:
+    
+    //! Whether the measured fits replace the built-in ones
+    static bool calibrated_;
+    
+    //! Coefficients of the measured fits, in increasing powers of log( particle_number )
+    static float vecto_coefficients_[n_vecto_coefficients];
+    static float scalar_coefficients_[n_scalar_coefficients];
+    
+    //! Measured normalized time of the vectorized operators
+    inline float __attribute__((always_inline)) calibratedTimeVecto( const float log_particle_number )
+    {
+        float r = vecto_coefficients_[n_vecto_coefficients-1];
+        for( int i = n_vecto_coefficients-2; i >= 0; i-- ) {
+            r = r * log_particle_number + vecto_coefficients_[i];
+        }
+        return r;
+    };
+    
+    //! Measured normalized time of the scalar operators
+    inline float __attribute__((always_inline)) calibratedTimeScalar( const float log_particle_number )
+    {
+        return scalar_coefficients_[0] + scalar_coefficients_[1] * log_particle_number;
+    };
+    
 private:
 
 };//END class PartCompTime
@@ -43,6 +43,11 @@ void PartCompTime2D2Order::operator()(  const std::vector<int> &count,
 
 float PartCompTime2D2Order::getParticleComputationTimeVecto( const float log_particle_number ) {
     
+    // Fit measured on this node (Vectorization.calibration)
+    if( calibrated_ ) {
+        return calibratedTimeVecto( log_particle_number );
+    }
+    
     float r = 0;
     float x;
     
@@ -99,6 +104,11 @@ float PartCompTime2D2Order::getParticleComputationTimeVecto( const float log_par
 
 float PartCompTime2D2Order::getParticleComputationTimeScalar( const float log_particle_number ) {
     
+    // Fit measured on this node (Vectorization.calibration)
+    if( calibrated_ ) {
+        return calibratedTimeScalar( log_particle_number );
+    }
+    
     float r = 0;
     
     // Cascade lake 6248 (Ex: Jean Zay)
@@ -46,6 +46,11 @@ void PartCompTimeAM2Order::operator()(  const std::vector<int> &count,
 
 float PartCompTimeAM2Order::getParticleComputationTimeVecto( const float log_particle_number ) {
     
+    // Fit measured on this node (Vectorization.calibration)
+    if( calibrated_ ) {
+        return calibratedTimeVecto( log_particle_number );
+    }
+    
     float r = 0;
     float x;
     
@@ -120,6 +125,11 @@ float PartCompTimeAM2Order::getParticleComputationTimeVecto( const float log_par
 
 float PartCompTimeAM2Order::getParticleComputationTimeScalar( const float log_particle_number ) {
     
+    // Fit measured on this node (Vectorization.calibration)
+    if( calibrated_ ) {
+        return calibratedTimeScalar( log_particle_number );
+    }
+    
     float r = 0;
     
     // Cascade lake 6248 (Ex: Jean Zay)
@@ -0,0 +1,346 @@
+#include "PartCompTimeCalibration.h"
+
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include "PartCompTime.h"
+#include "Params.h"
+#include "SmileiMPI.h"
+#include "VectorPatch.h"
+#include "Species.h"
+#include "Pusher.h"
+#include "InterpolatorFactory.h"
+#include "ProjectorFactory.h"
+#include "Random.h"
+#include "Tools.h"
+
+using namespace std;
+
+// -----------------------------------------------------------------------------
+//! Read the fits from the cache file, or measure them on the master process,
+//! and give them to all the processes
+// -----------------------------------------------------------------------------
+void PartCompTimeCalibration::calibrate( Params &params, SmileiMPI *smpi, VectorPatch &vecPatches )
+{
+    if( ! params.has_adaptive_vectorization || ! params.adaptive_calibration ) {
+        return;
+    }
+    if( params.geometry == "AMcylindrical" || params.Laser_Envelope_model ) {
+        WARNING( "The calibration of the adaptive vectorization is only available in cartesian geometries without envelope: built-in fits are used" );
+        return;
+    }
+
+    const unsigned int nv = PartCompTime::n_vecto_coefficients;
+    const unsigned int ns = PartCompTime::n_scalar_coefficients;
+    vector<double> coefficients( nv + ns, 0. );
+    // 0: no fit available, 1: read from the cache file, 2: measured
+    int status = 0;
+
+    if( smpi->isMaster() ) {
+        const string k = key( params );
+
+        // Look for this CPU and build in the cache file
+        ifstream cache( params.adaptive_calibration_file.c_str() );
+        string line;
+        while( status == 0 && getline( cache, line ) ) {
+            size_t tab = line.find( '\t' );
+            if( tab == string::npos || line.substr( 0, tab ) != k ) {
+                continue;
+            }
+            istringstream values( line.substr( tab+1 ) );
+            unsigned int i = 0;
+            while( i < coefficients.size() && values >> coefficients[i] ) {
+                i++;
+            }
+            if( i == coefficients.size() ) {
+                status = 1;
+            }
+        }
+        cache.close();
+
+        if( status == 0 ) {
+            // Pusher of the first massive species of the first patch
+            Patch *patch = vecPatches( 0 );
+            Species *spec = NULL;
+            unsigned int ispec = 0;
+            for( ; ispec < patch->vecSpecies.size(); ispec++ ) {
+                if( patch->vecSpecies[ispec]->mass_ > 0 && ! patch->vecSpecies[ispec]->Push_ponderomotive_position ) {
+                    spec = patch->vecSpecies[ispec];
+                    break;
+                }
+            }
+
+            if( spec ) {
+                // Sweep of the number of particles per cell, up to the maximum of the fits
+                const unsigned int ppcs[] = { 1, 2, 3, 4, 6, 8, 12, 16, 24, 32, 48, 64, 96, 128, 192, 256 };
+                const unsigned int nppc = sizeof( ppcs ) / sizeof( ppcs[0] );
+                vector<double> log_ppc( nppc ), vecto_time( nppc ), scalar_time( nppc );
+                for( unsigned int i = 0; i < nppc; i++ ) {
+                    log_ppc[i] = log( ( double ) ppcs[i] );
+                    vecto_time[i] = measure( params, smpi, patch, spec, ispec, ppcs[i], true );
+                    scalar_time[i] = measure( params, smpi, patch, spec, ispec, ppcs[i], false );
+                }
+                vector<double> vecto = fit( log_ppc, vecto_time, nv );
+                vector<double> scalar = fit( log_ppc, scalar_time, ns );
+
+                // Normalize like the built-in fits, to the scalar time with 1 particle per cell
+                const double norm = scalar[0];
+                for( unsigned int i = 0; i < nv; i++ ) {
+                    vecto[i] /= norm;
+                }
+                for( unsigned int i = 0; i < ns; i++ ) {
+                    scalar[i] /= norm;
+                }
+                copy( vecto.begin(), vecto.end(), coefficients.begin() );
+                copy( scalar.begin(), scalar.end(), coefficients.begin() + nv );
+                status = 2;
+
+                // Store the fits for the next runs
+                ofstream out( params.adaptive_calibration_file.c_str(), ios::app );
+                out << k << '\t' << setprecision( 9 );
+                for( unsigned int i = 0; i < coefficients.size(); i++ ) {
+                    out << ( i>0 ? " " : "" ) << coefficients[i];
+                }
+                out << endl;
+                if( ! out ) {
+                    WARNING( "Could not store the calibration of the adaptive vectorization in " << params.adaptive_calibration_file );
+                }
+            }
+        }
+    }
+
+    MPI_Bcast( &status, 1, MPI_INT, 0, smpi->world() );
+    if( status == 0 ) {
+        WARNING( "No massive species to calibrate the adaptive vectorization: built-in fits are used" );
+        return;
+    }
+    MPI_Bcast( &coefficients[0], coefficients.size(), MPI_DOUBLE, 0, smpi->world() );
+
+    PartCompTime::setCalibration(
+        vector<double>( coefficients.begin(), coefficients.begin() + nv ),
+        vector<double>( coefficients.begin() + nv, coefficients.end() )
+    );
+
+    if( status == 1 ) {
+        MESSAGE( 1, "Adaptive vectorization: operator costs read from " << params.adaptive_calibration_file );
+    } else {
+        MESSAGE( 1, "Adaptive vectorization: operator costs measured and stored in " << params.adaptive_calibration_file );
+    }
+}
+
+// -----------------------------------------------------------------------------
+//! Key of the cache file entries: CPU model, build, geometry and order
+// -----------------------------------------------------------------------------
+string PartCompTimeCalibration::key( Params &params )
+{
+    ostringstream k;
+    k << cpuModel() << " | Smilei " << __VERSION;
+#ifdef __VERSION__
+    k << " | " << __VERSION__;
+#endif
+    k << " | " << params.geometry << " order " << params.interpolation_order;
+    return k.str();
+}
+
+// -----------------------------------------------------------------------------
+//! Name of the CPU model, from /proc/cpuinfo
+// -----------------------------------------------------------------------------
+string PartCompTimeCalibration::cpuModel()
+{
+    ifstream cpuinfo( "/proc/cpuinfo" );
+    string line, model, implementer, part;
+    while( getline( cpuinfo, line ) ) {
+        size_t colon = line.find( ':' );
+        if( colon == string::npos ) {
+            continue;
+        }
+        string name = line.substr( 0, line.find_last_not_of( " \t", colon-1 ) + 1 );
+        size_t start = line.find_first_not_of( " \t", colon+1 );
+        string value = start == string::npos ? "" : line.substr( start );
+        if( name == "model name" && model.empty() ) {
+            model = value;
+        } else if( name == "CPU implementer" && implementer.empty() ) {
+            implementer = value;
+        } else if( name == "CPU part" && part.empty() ) {
+            part = value;
+        }
+    }
+    // ARM processors do not give a model name
+    if( model.empty() && ! implementer.empty() ) {
+        model = "ARM implementer " + implementer + " part " + part;
+    }
+    return model.empty() ? "unknown CPU" : model;
+}
+
+// -----------------------------------------------------------------------------
+//! Time per particle of the operators for a uniform number of particles per cell.
+//! The particles have a null weight so that the currents of the patch are not modified.
+// -----------------------------------------------------------------------------
+double PartCompTimeCalibration::measure( Params &params, SmileiMPI *smpi, Patch *patch, Species *spec,
+                                         unsigned int ispec, unsigned int ppc, bool vectorized )
+{
+    const unsigned int ndim = params.nDim_field;
+    const int ithread = 0;
+
+    // Cells of the sorting (dual cells), filled except on the border of the patch
+    unsigned int length[3] = { 1, 1, 1 };
+    unsigned int ncell = 1;
+    for( unsigned int idim = 0; idim < ndim; idim++ ) {
+        length[idim] = params.patch_size_[idim] + 1;
+        ncell *= length[idim];
+    }
+    // Limit the memory used with large patches
+    const unsigned int max_cells = max( 1u, ( 1u << 19 ) / ppc );
+
+    vector<unsigned int> cells;
+    for( unsigned int icell = 0; icell < ncell && cells.size() < max_cells; icell++ ) {
+        bool border = false;
+        unsigned int rem = icell;
+        for( int idim = ndim-1; idim >= 0; idim-- ) {
+            unsigned int i = rem % length[idim];
+            rem /= length[idim];
+            border = border || i == 0 || i == length[idim]-1;
+        }
+        if( ! border ) {
+            cells.push_back( icell );
+        }
+    }
+    const unsigned int npart = cells.size() * ppc;
+
+    // Own random generator: the patch generator is left untouched, so that the simulation does not depend
+    // on whether the costs were measured or read from the cache
+    Random rand( ppc );
+
+    Particles particles;
+    particles.initialize( npart, *spec->particles );
+    particles.resizeCellKeys( npart );
+    particles.first_index.assign( ncell, 0 );
+    particles.last_index.assign( ncell, 0 );
+    unsigned int ipart = 0;
+    for( unsigned int icell = 0, ifilled = 0; icell < ncell; icell++ ) {
+        particles.first_index[icell] = ipart;
+        if( ifilled < cells.size() && cells[ifilled] == icell ) {
+            unsigned int index[3];
+            unsigned int rem = icell;
+            for( int idim = ndim-1; idim >= 0; idim-- ) {
+                index[idim] = rem % length[idim];
+                rem /= length[idim];
+            }
+            for( unsigned int i = 0; i < ppc; i++, ipart++ ) {
+                for( unsigned int idim = 0; idim < ndim; idim++ ) {
+                    particles.position( idim, ipart ) = patch->getDomainLocalMin( idim )
+                        + ( index[idim] + rand.uniform() - 0.5 ) * params.cell_length[idim];
+                }
+                for( unsigned int idim = 0; idim < 3; idim++ ) {
+                    particles.momentum( idim, ipart ) = 0.;
+                }
+                particles.weight( ipart ) = 0.;
+                particles.charge( ipart ) = 1;
+                particles.cell_keys[ipart] = icell;
+            }
+            ifilled++;
+        }
+        particles.last_index[icell] = ipart;
+    }
+    Particles initial_particles;
+    initial_particles.initialize( 0, particles );
+    particles.copyParticles( 0, npart, initial_particles, 0 );
+
+    smpi->resizeBuffers( ithread, ndim, npart );
+    Interpolator *Interp = InterpolatorFactory::create( params, patch, vectorized );
+    Projector *Proj = ProjectorFactory::create( params, patch, vectorized );
+    ElectroMagn *EMfields = patch->EMfields;
+
+    // Same sequence of operators as in the dynamics
+    double elapsed = 0.;
+    unsigned int nrepeat = 0;
+    for( unsigned int irepeat = 0; irepeat < 3 || elapsed < 0.02; irepeat++ ) {
+        double timer = MPI_Wtime();
+        if( vectorized ) {
+            for( unsigned int icell = 0; icell < ncell; icell++ ) {
+                Interp->fieldsWrapper( EMfields, particles, smpi, &( particles.first_index[icell] ),
+                                       &( particles.last_index[icell] ), ithread, icell, 0 );
+            }
+            ( *spec->Push )( particles, smpi, 0, npart, ithread, 0 );
+            for( unsigned int icell = 0; icell < ncell; icell++ ) {
+                Proj->currentsAndDensityWrapper( EMfields, particles, smpi, particles.first_index[icell],
+                                                 particles.last_index[icell], ithread, false, params.is_spectral,
+                                                 ispec, icell, 0 );
+            }
+        } else {
+            Interp->fieldsWrapper( EMfields, particles, smpi, &( particles.first_index[0] ),
+                                   &( particles.last_index.back() ), ithread, 0 );
+            ( *spec->Push )( particles, smpi, 0, npart, ithread, 0 );
+            Proj->currentsAndDensityWrapper( EMfields, particles, smpi, particles.first_index[0],
+                                             particles.last_index.back(), ithread, false, params.is_spectral,
+                                             ispec );
+        }
+        timer = MPI_Wtime() - timer;
+
+        // The first pass warms up the caches
+        if( irepeat > 0 ) {
+            elapsed += timer;
+            nrepeat++;
+        }
+
+        // Put the particles back in their cells
+        initial_particles.overwriteParticle( 0, particles, 0, npart );
+    }
+
+    delete Interp;
+    delete Proj;
+
+    return elapsed / ( ( double ) nrepeat * npart );
+}
+
+// -----------------------------------------------------------------------------
+//! Least-square fit of y by a polynomial of x with n coefficients
+// -----------------------------------------------------------------------------
+vector<double> PartCompTimeCalibration::fit( const vector<double> &x, const vector<double> &y, unsigned int n )
+{
+    // Normal equations A c = b
+    vector<double> A( n*n, 0. ), b( n, 0. ), c( n, 0. );
+    for( unsigned int k = 0; k < x.size(); k++ ) {
+        vector<double> xp( 2*n-1, 1. );
+        for( unsigned int i = 1; i < 2*n-1; i++ ) {
+            xp[i] = xp[i-1] * x[k];
+        }
+        for( unsigned int i = 0; i < n; i++ ) {
+            for( unsigned int j = 0; j < n; j++ ) {
+                A[i*n+j] += xp[i+j];
+            }
+            b[i] += xp[i] * y[k];
+        }
+    }
+
+    // Gaussian elimination with partial pivoting
+    for( unsigned int i = 0; i < n; i++ ) {
+        unsigned int pivot = i;
+        for( unsigned int j = i+1; j < n; j++ ) {
+            if( abs( A[j*n+i] ) > abs( A[pivot*n+i] ) ) {
+                pivot = j;
+            }
+        }
+        for( unsigned int j = 0; j < n; j++ ) {
+            swap( A[i*n+j], A[pivot*n+j] );
+        }
+        swap( b[i], b[pivot] );
+        for( unsigned int j = i+1; j < n; j++ ) {
+            double f = A[j*n+i] / A[i*n+i];
+            for( unsigned int l = i; l < n; l++ ) {
+                A[j*n+l] -= f * A[i*n+l];
+            }
+            b[j] -= f * b[i];
+        }
+    }
+    for( int i = n-1; i >= 0; i-- ) {
+        double s = b[i];
+        for( unsigned int j = i+1; j < n; j++ ) {
+            s -= A[i*n+j] * c[j];
+        }
+        c[i] = s / A[i*n+i];
+    }
+    return c;
+}
@@ -0,0 +1,52 @@
+#ifndef PARTCOMPTIMECALIBRATION_H
+#define PARTCOMPTIMECALIBRATION_H
+
+#include <string>
+#include <vector>
+
+class Params;
+class SmileiMPI;
+class VectorPatch;
+class Patch;
+class Species;
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class PartCompTimeCalibration
+//! Measurement, at startup, of the time spent by the scalar and vectorized operators
+//! (interpolation, push, projection) as a function of the number of particles per cell.
+//! The fitted costs replace the built-in fits of the PartCompTime operators, and are
+//! cached in a file so that the next runs on the same CPU model with the same build
+//! do not measure them again.
+//  --------------------------------------------------------------------------------------------------------------------
+class PartCompTimeCalibration
+{
+public:
+
+    // -------------------------------------------------------------------------
+    //! Read the fits from the cache file, or measure them on the master process,
+    //! and give them to all the processes
+    // -------------------------------------------------------------------------
+    static void calibrate( Params &params, SmileiMPI *smpi, VectorPatch &vecPatches );
+
+private:
+
+    //! Key of the cache file entries: CPU model, build, geometry and order
+    static std::string key( Params &params );
+
+    //! Name of the CPU model, from /proc/cpuinfo
+    static std::string cpuModel();
+
+    // -------------------------------------------------------------------------
+    //! Time per particle of the operators for a uniform number of particles per cell
+    //! @param ppc number of particles per cell
+    //! @param vectorized whether the vectorized operators are measured
+    // -------------------------------------------------------------------------
+    static double measure( Params &params, SmileiMPI *smpi, Patch *patch, Species *spec,
+                           unsigned int ispec, unsigned int ppc, bool vectorized );
+
+    //! Least-square fit of y by a polynomial of x with n coefficients
+    static std::vector<double> fit( const std::vector<double> &x, const std::vector<double> &y, unsigned int n );
+
+};//END class PartCompTimeCalibration
+
+#endif
@@ -91,6 +91,10 @@ public:
         
         // Shortcut pointer to the associated species
         Species * species = species_vector[this_particle_injector->species_number_];
+        if( species->subcycling_ > 1 ) {
+            ERROR_NAMELIST( "For ParticleInjector '" << injector_name << "', species '" << species_name << "' cannot be subcycled",
+            LINK_NAMELIST + std::string("#particle-injector") );
+        }
 
         // Read the position initialization
         PyTools::extract( "position_initialization", this_particle_injector->position_initialization_, "ParticleInjector", injector_index );
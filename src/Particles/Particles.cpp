@@ -458,6 +458,62 @@ void Particles::copyParticles( vector<size_t> indices, Particles &dest_parts, in
     }
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+//! Insert the particles of src, sorted per bin, at the beginning of each bin of dest
+//! Each existing particle is moved at most once, from the last bin to the first one
+// ---------------------------------------------------------------------------------------------------------------------
+template<typename T>
+static void insertInBins( vector<T> &dest, vector<T> &src, vector<int> &first_index, vector<int> &bin_offset, vector<int> &bin_count )
+{
+    const size_t old_size = dest.size();
+    dest.resize( old_size + src.size() );
+    for( int ibin = (int) first_index.size()-1 ; ibin >= 0 ; ibin-- ) {
+        // Old content of the bin, including the space up to the next bin
+        size_t start = first_index[ibin];
+        size_t end   = ( ibin == (int) first_index.size()-1 ) ? old_size : first_index[ibin+1];
+        size_t shift = bin_offset[ibin] + bin_count[ibin];
+        if( shift > 0 ) {
+            move_backward( dest.begin() + start, dest.begin() + end, dest.begin() + end + shift );
+        }
+        // New particles take the front of the bin
+        copy( src.begin() + bin_offset[ibin], src.begin() + bin_offset[ibin] + bin_count[ibin], dest.begin() + start + bin_offset[ibin] );
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Insert the particles of the current array at the beginning of each bin of dest_parts
+//! The current array must be sorted per bin, with bin_count[ibin] particles for the bin ibin
+//! Equivalent to one copyParticles per bin, but the arrays of dest_parts are shifted only once
+//! cell keys not affected
+// ---------------------------------------------------------------------------------------------------------------------
+void Particles::copyParticlesToBins( vector<int> &bin_count, Particles &dest_parts )
+{
+    const unsigned int nbin = dest_parts.first_index.size();
+
+    // Number of new particles located before each bin
+    vector<int> bin_offset( nbin, 0 );
+    for( unsigned int ibin = 1 ; ibin < nbin ; ibin++ ) {
+        bin_offset[ibin] = bin_offset[ibin-1] + bin_count[ibin-1];
+    }
+
+    for( unsigned int iprop=0 ; iprop<double_prop_.size() ; iprop++ ) {
+        insertInBins( *dest_parts.double_prop_[iprop], *double_prop_[iprop], dest_parts.first_index, bin_offset, bin_count );
+    }
+
+    for( unsigned int iprop=0 ; iprop<short_prop_.size() ; iprop++ ) {
+        insertInBins( *dest_parts.short_prop_[iprop], *short_prop_[iprop], dest_parts.first_index, bin_offset, bin_count );
+    }
+
+    for( unsigned int iprop=0 ; iprop<uint64_prop_.size() ; iprop++ ) {
+        insertInBins( *dest_parts.uint64_prop_[iprop], *uint64_prop_[iprop], dest_parts.first_index, bin_offset, bin_count );
+    }
+
+    for( unsigned int ibin = 0 ; ibin < nbin ; ibin++ ) {
+        dest_parts.first_index[ibin] += bin_offset[ibin];
+        dest_parts.last_index[ibin]  += bin_offset[ibin] + bin_count[ibin];
+    }
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 //! Make a new particle at the position of another
 //! cell keys not affected
@@ -881,6 +937,69 @@ void Particles::overwriteParticle( unsigned int part1, Particles &dest_parts, un
     }
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+//! Copy each particle i < n at the position dest[i] of dest_parts (skipped when dest[i] < 0), property by property
+//! Warning: do not update first_index and last_index
+// ---------------------------------------------------------------------------------------------------------------------
+void Particles::scatterParticles( const int *dest, unsigned int n, Particles &dest_parts )
+{
+    for( unsigned int iprop=0 ; iprop<double_prop_.size() ; iprop++ ) {
+        const double *const __restrict__ in = double_prop_[iprop]->data();
+        double *const __restrict__ out = dest_parts.double_prop_[iprop]->data();
+        for( unsigned int i=0; i<n; i++ ) {
+            if( dest[i] >= 0 ) {
+                out[dest[i]] = in[i];
+            }
+        }
+    }
+
+    for( unsigned int iprop=0 ; iprop<short_prop_.size() ; iprop++ ) {
+        const short *const __restrict__ in = short_prop_[iprop]->data();
+        short *const __restrict__ out = dest_parts.short_prop_[iprop]->data();
+        for( unsigned int i=0; i<n; i++ ) {
+            if( dest[i] >= 0 ) {
+                out[dest[i]] = in[i];
+            }
+        }
+    }
+
+    for( unsigned int iprop=0 ; iprop<uint64_prop_.size() ; iprop++ ) {
+        const uint64_t *const __restrict__ in = uint64_prop_[iprop]->data();
+        uint64_t *const __restrict__ out = dest_parts.uint64_prop_[iprop]->data();
+        for( unsigned int i=0; i<n; i++ ) {
+            if( dest[i] >= 0 ) {
+                out[dest[i]] = in[i];
+            }
+        }
+    }
+
+    for( unsigned int i=0; i<n; i++ ) {
+        if( dest[i] >= 0 ) {
+            dest_parts.cell_keys[dest[i]] = cell_keys[i];
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+//! Exchange all the properties and the cell keys with another Particles having the same properties
+// ---------------------------------------------------------------------------------------------------------------------
+void Particles::swapProperties( Particles &other )
+{
+    for( unsigned int iprop=0 ; iprop<double_prop_.size() ; iprop++ ) {
+        double_prop_[iprop]->swap( *other.double_prop_[iprop] );
+    }
+
+    for( unsigned int iprop=0 ; iprop<short_prop_.size() ; iprop++ ) {
+        short_prop_[iprop]->swap( *other.short_prop_[iprop] );
+    }
+
+    for( unsigned int iprop=0 ; iprop<uint64_prop_.size() ; iprop++ ) {
+        uint64_prop_[iprop]->swap( *other.uint64_prop_[iprop] );
+    }
+
+    cell_keys.swap( other.cell_keys );
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Move particle part1->part1+N into part2->part2+N memory location of dest vector, erasing part2->part2+N.
 // ---------------------------------------------------------------------------------------------------------------------
@@ -145,6 +145,9 @@ public:
     void copyParticles( unsigned int iPart, unsigned int nPart, Particles &dest_parts, int dest_id );
     //! Transfer particles indexed by array indices to dest_id in dest_parts
     void copyParticles( std::vector<size_t> indices, Particles &dest_parts, int dest_id );
+    //! Insert, at the beginning of each bin of dest_parts, the particles of the current array
+    //! already sorted per bin (bin_count[ibin] particles for bin ibin) - first_index and last_index updated
+    void copyParticlesToBins( std::vector<int> &bin_count, Particles &dest_parts );
 
     //! Make a new particle at the position of another
     void makeParticleAt( Particles &source_particles, unsigned int ipart, double w, short q=0., double px=0., double py=0., double pz=0. );
@@ -190,6 +193,13 @@ public:
     //! Warning: do not update first_index and last_index
     void overwriteParticle( unsigned int part1, Particles &dest_parts, unsigned int part2 );
 
+    //! Copy each particle i < n, with its cell key, at the position dest[i] of dest_parts (skipped when dest[i] < 0).
+    //! The copy is made property by property. Warning: do not update first_index and last_index
+    void scatterParticles( const int *dest, unsigned int n, Particles &dest_parts );
+
+    //! Exchange all the properties and the cell keys with another Particles having the same properties
+    void swapProperties( Particles &other );
+
     //! Create new particle
     void createParticle();
 
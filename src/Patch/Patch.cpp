@@ -33,6 +33,7 @@
 #include "DiagnosticFactory.h"
 #include "BinaryProcessesFactory.h"
 #include "PatchAM.h"
+#include "cField.h"
 
 
 using namespace std;
@@ -127,9 +128,13 @@ void Patch::initStep1( Params &params )
     
     // Initialize the random number generator
     rand_ = new Random( params.random_seed + hindex );
+    rand_->setKey( params.random_seed, hindex );
 
     // Obtain the cell_volume
     cell_volume = params.cell_volume;
+
+    measured_load_ = 0.;
+    smoothed_load_ = -1.;
 }
 
 
@@ -554,6 +559,279 @@ void Patch::copyExchParticlesToBuffers( int ispec, Params &params )
 } // copyExchParticlesToBuffers(... iDim)
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Single-pass exchange: Hilbert index and MPI rank of the patches at all displacements (diagonals included),
+// computed again only when the patches moved (moving window or load balancing)
+// ---------------------------------------------------------------------------------------------------------------------
+void Patch::updateDirectionNeighbors( Params &params, SmileiMPI *smpi, VectorPatch *vecPatch )
+{
+    if( direction_neighbor_.size() > 0 && direction_neighbor_iteration_ == vecPatch->lastIterationPatchesMoved ) {
+        return;
+    }
+    
+    int ndim = params.nDim_field;
+    unsigned int ndirections = 1;
+    for( int iDim = 0; iDim < ndim; iDim++ ) {
+        ndirections *= 3;
+    }
+    direction_neighbor_.assign( ndirections, MPI_PROC_NULL );
+    MPI_direction_neighbor_.assign( ndirections, MPI_PROC_NULL );
+    
+    DomainDecomposition *domain_decomposition = vecPatch->domain_decomposition_;
+    std::vector<int> xcall( ndim );
+    for( unsigned int idirection = 0; idirection < ndirections; idirection++ ) {
+        bool exists = true;
+        unsigned int c = idirection;
+        for( int iDim = 0; iDim < ndim; iDim++, c /= 3 ) {
+            int ndomain = domain_decomposition->ndomain_[iDim];
+            xcall[iDim] = ( int )Pcoordinates[iDim] + ( int )( c%3 ) - 1;
+            if( params.EM_BCs[iDim][0]=="periodic" ) {
+                xcall[iDim] = ( xcall[iDim] + ndomain ) % ndomain;
+            } else if( xcall[iDim] < 0 || xcall[iDim] >= ndomain ) {
+                exists = false;
+            }
+        }
+        if( exists ) {
+            direction_neighbor_[idirection] = domain_decomposition->getDomainId( xcall );
+            MPI_direction_neighbor_[idirection] = smpi->hrank( direction_neighbor_[idirection] );
+        }
+    }
+    direction_neighbor_iteration_ = vecPatch->lastIterationPatchesMoved;
+    
+} // updateDirectionNeighbors
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Single-pass exchange: copy particles to be exchanged to buffers sorted by final destination:
+// face neighbors in partSend, diagonal neighbors in partSendCorners.
+// Periodic shifts are applied here, so that the destination only has to read or receive these buffers.
+// ---------------------------------------------------------------------------------------------------------------------
+void Patch::copyExchParticlesPerDirection( SmileiMPI *smpi, int ispec, Params &params, VectorPatch *vecPatch )
+{
+    SpeciesMPIbuffers &buffer = vecSpecies[ispec]->MPI_buffer_;
+    int ndim = params.nDim_field;
+    
+    updateDirectionNeighbors( params, smpi, vecPatch );
+    
+    copyExchParticlesToBuffers( ispec, params );
+    for( size_t icorner = 0; icorner < buffer.partSendCorners.size(); icorner++ ) {
+        if( buffer.partSendCorners[icorner] ) {
+            buffer.partSendCorners[icorner]->clear();
+        }
+    }
+    
+    vector<double> x_max( ndim );
+    for( int iDim = 0; iDim < ndim; iDim++ ) {
+        x_max[iDim] = params.cell_length[iDim]*( params.global_size_[iDim] );
+    }
+    
+    vector<vector<size_t>> indices_corner( buffer.partSendCorners.size() );
+    int offset[3];
+    
+    for( int iDim = 0; iDim < ndim; iDim++ ) {
+        for( int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++ ) {
+            
+            Particles &partSend = *buffer.partSend[iDim][iNeighbor];
+            if( partSend.size() == 0 ) {
+                continue;
+            }
+            
+            // Particles leaving through iDim first: look for the other dimensions crossed
+            vector<size_t> indices_all_corners;
+            for( size_t iPart = 0; iPart < partSend.size(); iPart++ ) {
+                bool corner = false;
+                for( int otherDim = 0; otherDim < ndim; otherDim++ ) {
+                    offset[otherDim] = 0;
+                    if( otherDim == iDim ) {
+                        offset[otherDim] = 2*iNeighbor-1;
+                    } else if( otherDim > iDim ) {
+                        if( partSend.position( otherDim, iPart ) < min_local_[otherDim] ) {
+                            offset[otherDim] = -1;
+                        } else if( partSend.position( otherDim, iPart ) >= max_local_[otherDim] ) {
+                            offset[otherDim] = 1;
+                        }
+                        corner = corner || offset[otherDim] != 0;
+                    }
+                    // Enabled periodicity
+                    if( offset[otherDim] != 0 && smpi->periods_[otherDim]==1 ) {
+                        if( partSend.position( otherDim, iPart ) < 0. ) {
+                            partSend.position( otherDim, iPart ) += x_max[otherDim];
+                        } else if( partSend.position( otherDim, iPart ) >= x_max[otherDim] ) {
+                            partSend.position( otherDim, iPart ) -= x_max[otherDim];
+                        }
+                    }
+                }
+                if( corner ) {
+                    indices_corner[SpeciesMPIbuffers::cornerIndex( offset, ndim )].push_back( iPart );
+                    indices_all_corners.push_back( iPart );
+                }
+            }
+            
+            if( indices_all_corners.size() == 0 ) {
+                continue;
+            }
+            
+            // Move corner particles to the buffer of their diagonal neighbor (lost if there is no such neighbor)
+            for( size_t icorner = 0; icorner < indices_corner.size(); icorner++ ) {
+                if( indices_corner[icorner].size() == 0 ) {
+                    continue;
+                }
+                if( direction_neighbor_[icorner] != MPI_PROC_NULL ) {
+                    Particles &partSendCorner = *buffer.partSendCorners[icorner];
+                    partSend.copyParticles( indices_corner[icorner], partSendCorner, partSendCorner.size() );
+                }
+                indices_corner[icorner].clear();
+            }
+            partSend.eraseParticles( indices_all_corners );
+        }
+    }
+    
+} // copyExchParticlesPerDirection
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Single-pass exchange: send the number of particles leaving towards each patch of another process,
+// and receive the number of particles arriving from each of them.
+// The tag is made of the local index of the sending patch, of the displacement and of the species, unique in the
+// dedicated communicator (SyncVectorPatch::singlePassExchange keeps it below MPI_TAG_UB). The particles follow
+// with the same tag: MPI keeps the order of the two messages.
+// ---------------------------------------------------------------------------------------------------------------------
+void Patch::exchNbrOfParticlesPerDirection( SmileiMPI *smpi, int ispec, Params &params, VectorPatch *vecPatch )
+{
+    SpeciesMPIbuffers &buffer = vecSpecies[ispec]->MPI_buffer_;
+    unsigned int ndirections = direction_neighbor_.size();
+    
+    for( unsigned int idirection = 0; idirection < ndirections; idirection++ ) {
+        
+        // Send number of particles to the patch at +displacement
+        if( is_a_MPI_direction_neighbor( idirection ) ) {
+            buffer.partSendSizePerDirection[idirection] = buffer.sendPacket( idirection, params.nDim_field )->size();
+            int local_hindex = hindex - vecPatch->refHindex_;
+            int tag = ( local_hindex * ndirections + idirection ) * vecSpecies.size() + ispec;
+            MPI_Isend( &buffer.partSendSizePerDirection[idirection], 1, MPI_INT, MPI_direction_neighbor_[idirection], tag, vecPatch->particle_exchange_comm_, &buffer.srequestPerDirection[idirection] );
+        }
+        
+        // Receive number of particles from the patch at -displacement
+        unsigned int iopposite = ndirections - 1 - idirection;
+        if( is_a_MPI_direction_neighbor( iopposite ) ) {
+            int local_hindex = direction_neighbor_[iopposite] - smpi->patch_refHindexes[ MPI_direction_neighbor_[iopposite] ];
+            int tag = ( local_hindex * ndirections + idirection ) * vecSpecies.size() + ispec;
+            MPI_Irecv( &buffer.partRecvSizePerDirection[idirection], 1, MPI_INT, MPI_direction_neighbor_[iopposite], tag, vecPatch->particle_exchange_comm_, &buffer.rrequestPerDirection[idirection] );
+        }
+    }
+    
+} // exchNbrOfParticlesPerDirection
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Single-pass exchange: wait for the numbers of particles, then send and receive the particles
+// exchanged with the patches of other processes
+// ---------------------------------------------------------------------------------------------------------------------
+void Patch::exchParticlesPerDirection( SmileiMPI *smpi, int ispec, Params &params, VectorPatch *vecPatch )
+{
+    SpeciesMPIbuffers &buffer = vecSpecies[ispec]->MPI_buffer_;
+    unsigned int ndirections = direction_neighbor_.size();
+    
+    EventTracing::Scope trace( EventTracing::mpi_wait, has_an_MPI_neighbor() );
+    
+    for( unsigned int idirection = 0; idirection < ndirections; idirection++ ) {
+        
+        // Send
+        if( is_a_MPI_direction_neighbor( idirection ) ) {
+            MPI_Status sstat;
+            MPI_Wait( &buffer.srequestPerDirection[idirection], &sstat );
+            if( buffer.partSendSizePerDirection[idirection] != 0 ) {
+                Particles *partSend = buffer.sendPacket( idirection, params.nDim_field );
+                int local_hindex = hindex - vecPatch->refHindex_;
+                int tag = ( local_hindex * ndirections + idirection ) * vecSpecies.size() + ispec;
+                buffer.typePartSendPerDirection[idirection] = smpi->createMPIparticles( partSend );
+                MPI_Isend( &partSend->position( 0, 0 ), 1, buffer.typePartSendPerDirection[idirection], MPI_direction_neighbor_[idirection], tag, vecPatch->particle_exchange_comm_, &buffer.srequestPerDirection[idirection] );
+            }
+        }
+        
+        // Receive
+        unsigned int iopposite = ndirections - 1 - idirection;
+        if( is_a_MPI_direction_neighbor( iopposite ) ) {
+            MPI_Status rstat;
+            MPI_Wait( &buffer.rrequestPerDirection[idirection], &rstat );
+            if( buffer.partRecvSizePerDirection[idirection] != 0 ) {
+                Particles *partRecv = buffer.recvPacket( idirection, params.nDim_field );
+                partRecv->initialize( buffer.partRecvSizePerDirection[idirection], *vecSpecies[ispec]->particles );
+                int local_hindex = direction_neighbor_[iopposite] - smpi->patch_refHindexes[ MPI_direction_neighbor_[iopposite] ];
+                int tag = ( local_hindex * ndirections + idirection ) * vecSpecies.size() + ispec;
+                buffer.typePartRecvPerDirection[idirection] = smpi->createMPIparticles( partRecv );
+                MPI_Irecv( &partRecv->position( 0, 0 ), 1, buffer.typePartRecvPerDirection[idirection], MPI_direction_neighbor_[iopposite], tag, vecPatch->particle_exchange_comm_, &buffer.rrequestPerDirection[idirection] );
+            }
+        }
+    }
+    
+} // exchParticlesPerDirection
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Single-pass exchange: gather the particles sent to this patch in the receive buffers of the last crossed dimension,
+// as the dimension-by-dimension exchange would do:
+//   - by its face neighbors of this process (swapped directly) or of other processes (received directly in partRecv),
+//   - then by its diagonal neighbors of this process (copied) or of other processes (copied from partRecvCorners).
+// Each buffer of the neighbors is read by this patch only.
+// ---------------------------------------------------------------------------------------------------------------------
+void Patch::importExchParticlesPerDirection( int ispec, Params &params, VectorPatch *vecPatch )
+{
+    SpeciesMPIbuffers &buffer = vecSpecies[ispec]->MPI_buffer_;
+    unsigned int ndim = params.nDim_field;
+    unsigned int ndirections = direction_neighbor_.size();
+    
+    // Wait for the exchanges with other processes
+    {
+        EventTracing::Scope trace( EventTracing::mpi_wait, has_an_MPI_neighbor() );
+        for( unsigned int idirection = 0; idirection < ndirections; idirection++ ) {
+            MPI_Status sstat, rstat;
+            if( is_a_MPI_direction_neighbor( idirection ) && buffer.partSendSizePerDirection[idirection] != 0 ) {
+                MPI_Wait( &buffer.srequestPerDirection[idirection], &sstat );
+                MPI_Type_free( &buffer.typePartSendPerDirection[idirection] );
+            }
+            if( is_a_MPI_direction_neighbor( ndirections - 1 - idirection ) && buffer.partRecvSizePerDirection[idirection] != 0 ) {
+                MPI_Wait( &buffer.rrequestPerDirection[idirection], &rstat );
+                MPI_Type_free( &buffer.typePartRecvPerDirection[idirection] );
+            }
+        }
+    }
+    
+    // Faces first, as the swaps replace the receive buffers; then diagonals, appended to them
+    for( int pass = 0; pass < 2; pass++ ) {
+        bool faces = ( pass == 0 );
+        for( unsigned int idirection = 0; idirection < ndirections; idirection++ ) {
+            unsigned int iopposite = ndirections - 1 - idirection;
+            unsigned int lastDim, side;
+            unsigned int ncrossed = SpeciesMPIbuffers::lastCrossedDimension( idirection, ndim, lastDim, side );
+            if( ncrossed == 0 || ( ncrossed == 1 ) != faces || direction_neighbor_[iopposite] == MPI_PROC_NULL ) {
+                continue;
+            }
+            
+            if( is_a_MPI_direction_neighbor( iopposite ) ) {
+                if( ncrossed > 1 && buffer.partRecvSizePerDirection[idirection] != 0 ) {
+                    Particles &partRecvCorner = *buffer.partRecvCorners[idirection];
+                    Particles &partRecv = *buffer.partRecv[lastDim][side];
+                    partRecvCorner.copyParticles( 0, partRecvCorner.size(), partRecv, partRecv.size() );
+                }
+            } else {
+                SpeciesMPIbuffers &source_buffer = ( *vecPatch )( direction_neighbor_[iopposite] - vecPatch->refHindex_ )->vecSpecies[ispec]->MPI_buffer_;
+                if( ncrossed == 1 ) {
+                    swap( buffer.partRecv[lastDim][side], source_buffer.partSend[lastDim][1-side] );
+                } else {
+                    Particles &partSendCorner = *source_buffer.partSendCorners[idirection];
+                    if( partSendCorner.size() > 0 ) {
+                        Particles &partRecv = *buffer.partRecv[lastDim][side];
+                        partSendCorner.copyParticles( 0, partSendCorner.size(), partRecv, partRecv.size() );
+                    }
+                }
+            }
+        }
+    }
+    
+} // importExchParticlesPerDirection
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Exchange number of particles to exchange to establish or not a communication
 // ---------------------------------------------------------------------------------------------------------------------
@@ -599,6 +877,7 @@ void Patch::exchNbrOfParticles( SmileiMPI *smpi, int ispec, Params &, int iDim,
 // ---------------------------------------------------------------------------------------------------------------------
 void Patch::endNbrOfParticles( int ispec, int iDim )
 {
+    EventTracing::Scope trace( EventTracing::mpi_wait, is_a_MPI_neighbor( iDim, 0 ) || is_a_MPI_neighbor( iDim, 1 ) );
     SpeciesMPIbuffers &buffer = vecSpecies[ispec]->MPI_buffer_;
     
     for( int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++ ) {
@@ -702,6 +981,7 @@ void Patch::exchParticles( SmileiMPI *smpi, int ispec, Params &, int iDim, Vecto
 // ---------------------------------------------------------------------------------------------------------------------
 void Patch::waitExchParticles( int ispec, int iDim )
 {
+    EventTracing::Scope trace( EventTracing::mpi_wait, is_a_MPI_neighbor( iDim, 0 ) || is_a_MPI_neighbor( iDim, 1 ) );
     SpeciesMPIbuffers &buffer = vecSpecies[ispec]->MPI_buffer_;
     
     for( int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++ ) {
@@ -808,12 +1088,20 @@ void Patch::importAndSortParticles( int ispec, Params &params )
     double timer;
     timer = MPI_Wtime();
 #endif
+    const double start = params.patch_timers ? MPI_Wtime() : 0.;
 
+    // Particles received during a subcycle are inserted after the delayed push (see VectorPatch::catchUpSubcycledPush)
+    vecSpecies[ispec]->holdSubcycleNewcomers();
     vecSpecies[ispec]->sortParticles( params );
 
 #ifdef  __DETAILED_TIMERS
     this->patch_timers_[13] += MPI_Wtime() - timer;
 #endif
+    if( params.patch_timers ) {
+        std::vector<double> &counters = vecSpecies[ispec]->performance_counters_;
+        counters.resize( Species::n_performance_counters_, 0. );
+        counters[1] += MPI_Wtime() - start;
+    }
 
 } // sortParticles(...)
 
@@ -832,6 +1120,12 @@ void Patch::cleanParticlesOverhead( Params &params )
                 buffer.partSend[idim][iNeighbor]->shrinkToFit( );
             }
         }
+        for( size_t icorner = 0; icorner < buffer.partSendCorners.size(); icorner++ ) {
+            if( buffer.partSendCorners[icorner] ) {
+                buffer.partSendCorners[icorner]->clear();
+                buffer.partSendCorners[icorner]->shrinkToFit( );
+            }
+        }
         
         vecSpecies[ispec]->particles->shrinkToFit(  );
     }
@@ -994,6 +1288,7 @@ void Patch::initExchangeComplex( Field *field, int iDim, SmileiMPI *smpi )
 // ---------------------------------------------------------------------------------------------------------------------
 void Patch::finalizeExchange( Field *field, int iDim )
 {
+    EventTracing::Scope trace( EventTracing::mpi_wait, is_a_MPI_neighbor( iDim, 0 ) || is_a_MPI_neighbor( iDim, 1 ) );
     MPI_Status sstat    [nDim_fields_][2];
     MPI_Status rstat    [nDim_fields_][2];
     for( int iNeighbor=0 ; iNeighbor<nbNeighbors_ ; iNeighbor++ ) {
@@ -1008,6 +1303,70 @@ void Patch::finalizeExchange( Field *field, int iDim )
 } // END finalizeExchange( Field* field, int iDim )
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Moving window of the region: shift all the fields by clrw cells along x
+// The clrw columns leaving each field are sent to the xmin neighbor, and the clrw columns entering each field received
+// from the xmax neighbor, all the fields together in a single message
+// ---------------------------------------------------------------------------------------------------------------------
+void Patch::exchangeFields_movewin( std::vector<Field *> &fields, int clrw )
+{
+    // Raw data of the fields (complex fields are seen as arrays of doubles) and number of doubles in one column
+    std::vector<double *> data( fields.size() );
+    std::vector<unsigned int> column( fields.size() );
+    unsigned int message_size = 0;
+    for( unsigned int ifield=0 ; ifield<fields.size() ; ifield++ ) {
+        Field *field = fields[ifield];
+        if( cField *cfield = dynamic_cast<cField *>( field ) ) {
+            data[ifield] = reinterpret_cast<double *>( cfield->cdata_ );
+            column[ifield] = 2*( field->number_of_points_ / field->dims_[0] );
+        } else {
+            data[ifield] = field->data_;
+            column[ifield] = field->number_of_points_ / field->dims_[0];
+        }
+        message_size += clrw*column[ifield];
+    }
+
+    const bool send = MPI_neighbor_[0][0]!=MPI_PROC_NULL;
+    const bool recv = MPI_neighbor_[0][1]!=MPI_PROC_NULL;
+    std::vector<double> send_buffer( send ? message_size : 0 ), recv_buffer( recv ? message_size : 0 );
+    MPI_Request requests[2];
+    int nrequests = 0;
+
+    if( recv ) {
+        MPI_Irecv( &recv_buffer[0], message_size, MPI_DOUBLE, MPI_neighbor_[0][1], 0, MPI_COMM_WORLD, &requests[nrequests++] );
+    }
+    if( send ) {
+        unsigned int offset = 0;
+        for( unsigned int ifield=0 ; ifield<fields.size() ; ifield++ ) {
+            unsigned int ix = 2*oversize[0] + 1 + fields[ifield]->isDual_[0];
+            memcpy( &send_buffer[offset], data[ifield] + ix*column[ifield], clrw*column[ifield]*sizeof( double ) );
+            offset += clrw*column[ifield];
+        }
+        MPI_Isend( &send_buffer[0], message_size, MPI_DOUBLE, MPI_neighbor_[0][0], 0, MPI_COMM_WORLD, &requests[nrequests++] );
+    }
+
+    // Once the columns are packed, the fields are shifted in memory while the message is in transit
+    for( unsigned int ifield=0 ; ifield<fields.size() ; ifield++ ) {
+        fields[ifield]->shift_x( clrw );
+    }
+
+    {
+        EventTracing::Scope trace( EventTracing::mpi_wait, nrequests > 0 );
+        MPI_Waitall( nrequests, requests, MPI_STATUSES_IGNORE );
+    }
+
+    if( recv ) {
+        unsigned int offset = 0;
+        for( unsigned int ifield=0 ; ifield<fields.size() ; ifield++ ) {
+            unsigned int ix = fields[ifield]->dims_[0] - clrw;
+            memcpy( data[ifield] + ix*column[ifield], &recv_buffer[offset], clrw*column[ifield]*sizeof( double ) );
+            offset += clrw*column[ifield];
+        }
+    }
+
+} // END exchangeFields_movewin
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Initialize current patch sum Fields communications through MPI in direction iDim
 // Intra-MPI process communications managed by memcpy in SyncVectorPatch::sum()
@@ -1084,6 +1443,7 @@ void Patch::initSumField( Field *field, int iDim, SmileiMPI *smpi, bool devPtr )
 // ---------------------------------------------------------------------------------------------------------------------
 void Patch::finalizeSumField( Field *field, int iDim )
 {
+    EventTracing::Scope trace( EventTracing::mpi_wait, is_a_MPI_neighbor( iDim, 0 ) || is_a_MPI_neighbor( iDim, 1 ) );
     MPI_Status sstat    [nDim_fields_][2];
     MPI_Status rstat    [nDim_fields_][2];
 
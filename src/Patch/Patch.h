@@ -41,6 +41,7 @@ class Patch
     friend class SimWindow;
     friend class SyncVectorPatch;
     friend class AsyncMPIbuffers;
+    friend class AggregatedExchange;
 public:
     //! Constructor for Patch
     Patch( Params &params, SmileiMPI *smpi, DomainDecomposition *domain_decomposition, unsigned int ipatch );
@@ -154,6 +155,14 @@ public:
 #endif
     }
 
+    // Measured load (LoadBalancing mode "measured")
+    // -----------------------
+
+    //! Wall time spent in the particle operators of this patch since the last load balancing
+    double measured_load_;
+    //! Exponentially smoothed load per timestep (negative until the first measurement)
+    double smoothed_load_;
+
     // Random number generator.
     Random * rand_;
     
@@ -165,6 +174,15 @@ public:
     void cleanMPIBuffers( int ispec, Params &params );
     //! manage Idx of particles per direction,
     void copyExchParticlesToBuffers( int ispec, Params &params );
+    //! Single-pass exchange: sort leaving particles per final direction (including diagonals), with periodicity
+    void copyExchParticlesPerDirection( SmileiMPI *smpi, int ispec, Params &params, VectorPatch *vecPatch );
+    //! Single-pass exchange: init comm / nbr of particles with the patches of other processes
+    void exchNbrOfParticlesPerDirection( SmileiMPI *smpi, int ispec, Params &params, VectorPatch *vecPatch );
+    //! Single-pass exchange: finalize comm / nbr of particles, init exch / particles with the patches of other processes
+    void exchParticlesPerDirection( SmileiMPI *smpi, int ispec, Params &params, VectorPatch *vecPatch );
+    //! Single-pass exchange: take the particles left in the buffers of the surrounding patches of this process,
+    //! and those received from other processes
+    void importExchParticlesPerDirection( int ispec, Params &params, VectorPatch *vecPatch );
     //! init comm  nbr of particles
     void exchNbrOfParticles( SmileiMPI *smpi, int ispec, Params &params, int iDim, VectorPatch *vecPatch );
     //! finalize comm / nbr of particles, init exch / particles
@@ -219,7 +237,9 @@ public:
     //! finalize comm / exchange fields
     virtual void finalizeExchange( Field *field, int iDim );
     
-    virtual void exchangeField_movewin ( Field* field, int clrw ) = 0;
+    //! Moving window: shift all the fields by clrw cells along x and exchange the columns leaving and entering them with
+    //! the x neighbors, in a single message for all the fields
+    void exchangeFields_movewin( std::vector<Field *> &fields, int clrw );
     
     // Create MPI_Datatype to exchange fields
     virtual void createType2( Params &params ) = 0;
@@ -307,6 +327,12 @@ public:
         return( ( neighbor_[iDim][iNeighbor]!=MPI_PROC_NULL ) && ( MPI_neighbor_[iDim][iNeighbor]!=MPI_me_ ) );
     }
     
+    //! Test whether the patch at the displacement `idirection` (see SpeciesMPIbuffers::cornerIndex) belongs to another process
+    inline bool is_a_MPI_direction_neighbor( unsigned int idirection )
+    {
+        return( ( direction_neighbor_[idirection]!=MPI_PROC_NULL ) && ( MPI_direction_neighbor_[idirection]!=MPI_me_ ) );
+    }
+    
     inline bool has_an_MPI_neighbor()
     {
         for( unsigned int iDim=0 ; iDim<MPI_neighbor_.size() ; iDim++ ) {
@@ -458,6 +484,14 @@ protected:
     //! MPI rank of neighbors patch
     std::vector< std::vector<int> > MPI_neighbor_, tmp_MPI_neighbor_;
     
+    //! Hilbert index and MPI rank of the patches at all displacements, indexed by SpeciesMPIbuffers::cornerIndex
+    //! (diagonals included, MPI_PROC_NULL if none), used by the single-pass exchange of particles
+    std::vector<int> direction_neighbor_, MPI_direction_neighbor_;
+    //! Value of VectorPatch::lastIterationPatchesMoved when direction_neighbor_ was computed
+    unsigned int direction_neighbor_iteration_;
+    //! Compute direction_neighbor_ if the patches moved since the last call
+    void updateDirectionNeighbors( Params &params, SmileiMPI *smpi, VectorPatch *vecPatch );
+    
     //! "Real" min limit of local sub-subdomain (ghost data not concerned)
     //!     - "0." on rank 0
     std::vector<double> min_local_;
@@ -39,8 +39,6 @@ public:
     //   - fields communication specified per geometry (pure virtual)
     // --------------------------------------------------------------
     
-    void exchangeField_movewin( Field* field, int clrw ) override final;
-    
     // Create MPI_Datatype to exchange fields
     void createType2( Params &params ) override final;
     void cleanType() override final;
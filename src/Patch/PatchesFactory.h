@@ -58,6 +58,12 @@ public:
     
         vecPatches.diag_flag = ( params.restart? false : true );
         vecPatches.lastIterationPatchesMoved = itime;
+        if( params.aggregate_exchanges ) {
+            MPI_Comm_dup( MPI_COMM_WORLD, &vecPatches.aggregated_exchange_comm_ );
+        }
+        if( smpi->getSize() > 1 && params.single_pass_particle_exchange ) {
+            MPI_Comm_dup( MPI_COMM_WORLD, &vecPatches.particle_exchange_comm_ );
+        }
         
         // Compute npatches (1 is std MPI behavior)
         unsigned int npatches, firstpatch;
@@ -1,6 +1,7 @@
 
 #include "SyncVectorPatch.h"
 
+#include <algorithm>
 #include <vector>
 #ifdef SMILEI_ACCELERATOR_GPU_OACC
     #include <openacc.h>
@@ -8,10 +9,21 @@
 #include "Params.h"
 #include "SmileiMPI.h"
 #include "VectorPatch.h"
+#include "AggregatedExchange.h"
 #include "gpu.h"
 
 using namespace std;
 
+// Aggregated exchange of a group of real fields, NULL if the faces are exchanged one by one
+// (the group is registered even if empty in this process, so that all processes give it the same tag)
+static AggregatedExchange *aggregatedExchange( std::vector<Field *> &fields, VectorPatch &vecPatches, std::string key )
+{
+    if( fields.size() > 0 && dynamic_cast<cField *>( fields[0] ) ) {
+        return NULL;
+    }
+    return vecPatches.aggregatedExchange( key );
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 // ---------------------------------------------------------------------------------------------------------------------
 // ----------------------------------------------       PARTICLES         ----------------------------------------------
@@ -24,8 +36,47 @@ template void SyncVectorPatch::exchangeAlongAllDirections<complex<double>,cField
 template void SyncVectorPatch::exchangeAlongAllDirectionsNoOMP<double,Field>( std::vector<Field *> fields, VectorPatch &vecPatches, SmileiMPI *smpi );
 template void SyncVectorPatch::exchangeAlongAllDirectionsNoOMP<complex<double>,cField>( std::vector<Field *> fields, VectorPatch &vecPatches, SmileiMPI *smpi );
 
+// With Main.single_pass_particle_exchange, particles are exchanged in a single pass, each patch reaching directly
+// the final destination of its particles (diagonals included): the buffers of the patches of the same process are
+// read directly, and one message per displacement is exchanged with the patches of other processes. This skips
+// the dimension-by-dimension steps and their barriers. With _NO_MPI_TM, MPI may only be called by one thread,
+// so a single process is required. The tags of the messages (see Patch::exchNbrOfParticlesPerDirection) must not
+// exceed MPI_TAG_UB with the current number of patches per process: patch_count is the same in all processes,
+// so they all take the same path.
+bool SyncVectorPatch::singlePassExchange( VectorPatch &vecPatches, Params &params, SmileiMPI *smpi )
+{
+    if( ! params.single_pass_particle_exchange ) {
+        return false;
+    }
+    if( smpi->getSize() > 1 ) {
+#ifdef _NO_MPI_TM
+        SMILEI_UNUSED( vecPatches );
+        return false;
+#else
+        long long int ntags = *max_element( smpi->patch_count.begin(), smpi->patch_count.end() );
+        for( unsigned int iDim=0 ; iDim<params.nDim_field ; iDim++ ) {
+            ntags *= 3;
+        }
+        ntags *= vecPatches( 0 )->vecSpecies.size();
+        if( ntags - 1 > smpi->getTagUB() ) {
+            return false;
+        }
+#endif
+    }
+    return true;
+}
+
 void SyncVectorPatch::initExchParticles( VectorPatch &vecPatches, int ispec, Params &params, SmileiMPI *smpi )
 {
+    if( singlePassExchange( vecPatches, params, smpi ) ) {
+        #pragma omp for schedule(runtime)
+        for( unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++ ) {
+            vecPatches( ipatch )->copyExchParticlesPerDirection( smpi, ispec, params, &vecPatches );
+            vecPatches( ipatch )->exchNbrOfParticlesPerDirection( smpi, ispec, params, &vecPatches );
+        }
+        return;
+    }
+    
     #pragma omp for schedule(runtime)
     for( unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++ ) {
         vecPatches( ipatch )->copyExchParticlesToBuffers( ispec, params );
@@ -43,6 +94,21 @@ void SyncVectorPatch::initExchParticles( VectorPatch &vecPatches, int ispec, Par
 // ---------------------------------------------------------------------------------------------------------------------
 void SyncVectorPatch::finalizeExchParticlesAndSort( VectorPatch &vecPatches, int ispec, Params &params, SmileiMPI *smpi )
 {
+    if( singlePassExchange( vecPatches, params, smpi ) ) {
+        if( smpi->getSize() > 1 ) {
+            #pragma omp for schedule(runtime)
+            for( unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++ ) {
+                vecPatches( ipatch )->exchParticlesPerDirection( smpi, ispec, params, &vecPatches );
+            }
+        }
+        #pragma omp for schedule(runtime)
+        for( unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++ ) {
+            vecPatches( ipatch )->importExchParticlesPerDirection( ispec, params, &vecPatches );
+            vecPatches( ipatch )->importAndSortParticles( ispec, params );
+        }
+        return;
+    }
+    
     // finish exchange along dimension 0 only
     SyncVectorPatch::finalizeExchParticlesAlongDimension( vecPatches, ispec, 0, params, smpi );
     
@@ -218,6 +284,15 @@ void SyncVectorPatch::sumAllComponents( std::vector<Field *> &fields, VectorPatc
 
     int nDim = vecPatches( 0 )->EMfields->Jx_->dims_.size();
 
+    AggregatedExchange *aggregated[3] = { NULL, NULL, NULL };
+    aggregated[0] = aggregatedExchange( vecPatches.densitiesMPIx, vecPatches, "densities_0" );
+    if( nDim>1 ) {
+        aggregated[1] = aggregatedExchange( vecPatches.densitiesMPIy, vecPatches, "densities_1" );
+        if( nDim>2 ) {
+            aggregated[2] = aggregatedExchange( vecPatches.densitiesMPIz, vecPatches, "densities_2" );
+        }
+    }
+
     // -----------------
     // Sum per direction :
 
@@ -252,9 +327,14 @@ void SyncVectorPatch::sumAllComponents( std::vector<Field *> &fields, VectorPatc
 // #endif
             }
         }
-        vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIx[ifield             ], 0, smpi, true ); // Jx
-        vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIx[ifield+  nPatchMPIx], 0, smpi, true ); // Jy
-        vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIx[ifield+2*nPatchMPIx], 0, smpi, true ); // Jz
+        if( !aggregated[0] ) {
+            vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIx[ifield             ], 0, smpi, true ); // Jx
+            vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIx[ifield+  nPatchMPIx], 0, smpi, true ); // Jy
+            vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIx[ifield+2*nPatchMPIx], 0, smpi, true ); // Jz
+        }
+    }
+    if( aggregated[0] ) {
+        aggregated[0]->start( vecPatches.densitiesMPIx, vecPatches.MPIxIdx, vecPatches, 0, 1 );
     }
 
     // iDim = 0, local
@@ -315,6 +395,9 @@ void SyncVectorPatch::sumAllComponents( std::vector<Field *> &fields, VectorPatc
     }
 
     // iDim = 0, finalize (waitall)
+    if( aggregated[0] ) {
+        aggregated[0]->finalize();
+    }
 #ifndef _NO_MPI_TM
     #pragma omp for schedule(static)
 #else
@@ -322,9 +405,11 @@ void SyncVectorPatch::sumAllComponents( std::vector<Field *> &fields, VectorPatc
 #endif
     for( unsigned int ifield=0 ; ifield<nPatchMPIx ; ifield++ ) {
         unsigned int ipatch = vecPatches.MPIxIdx[ifield];
-        vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIx[ifield             ], 0 ); // Jx
-        vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIx[ifield+nPatchMPIx  ], 0 ); // Jy
-        vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIx[ifield+2*nPatchMPIx], 0 ); // Jz
+        if( !aggregated[0] ) {
+            vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIx[ifield             ], 0 ); // Jx
+            vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIx[ifield+nPatchMPIx  ], 0 ); // Jy
+            vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIx[ifield+2*nPatchMPIx], 0 ); // Jz
+        }
         for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
             if ( vecPatches( ipatch )->is_a_MPI_neighbor( 0, ( iNeighbor+1 )%2 ) ) {
 // #ifdef SMILEI_ACCELERATOR_GPU_OACC
@@ -385,9 +470,14 @@ void SyncVectorPatch::sumAllComponents( std::vector<Field *> &fields, VectorPatc
 // #endif
                 }
             }
-            vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIy[ifield             ], 1, smpi, true ); // Jx
-            vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIy[ifield+nPatchMPIy  ], 1, smpi, true ); // Jy
-            vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIy[ifield+2*nPatchMPIy], 1, smpi, true ); // Jz
+            if( !aggregated[1] ) {
+                vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIy[ifield             ], 1, smpi, true ); // Jx
+                vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIy[ifield+nPatchMPIy  ], 1, smpi, true ); // Jy
+                vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIy[ifield+2*nPatchMPIy], 1, smpi, true ); // Jz
+            }
+        }
+        if( aggregated[1] ) {
+            aggregated[1]->start( vecPatches.densitiesMPIy, vecPatches.MPIyIdx, vecPatches, 1, 2 );
         }
 
         // iDim = 1,
@@ -453,6 +543,9 @@ void SyncVectorPatch::sumAllComponents( std::vector<Field *> &fields, VectorPatc
         }
 
         // iDim = 1, finalize (waitall)
+        if( aggregated[1] ) {
+            aggregated[1]->finalize();
+        }
 #ifndef _NO_MPI_TM
         #pragma omp for schedule(static)
 #else
@@ -460,9 +553,11 @@ void SyncVectorPatch::sumAllComponents( std::vector<Field *> &fields, VectorPatc
 #endif
         for( unsigned int ifield=0 ; ifield<nPatchMPIy ; ifield=ifield+1 ) {
             unsigned int ipatch = vecPatches.MPIyIdx[ifield];
-            vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIy[ifield             ], 1 ); // Jx
-            vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIy[ifield+nPatchMPIy  ], 1 ); // Jy
-            vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIy[ifield+2*nPatchMPIy], 1 ); // Jz
+            if( !aggregated[1] ) {
+                vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIy[ifield             ], 1 ); // Jx
+                vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIy[ifield+nPatchMPIy  ], 1 ); // Jy
+                vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIy[ifield+2*nPatchMPIy], 1 ); // Jz
+            }
             for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
                 if ( vecPatches( ipatch )->is_a_MPI_neighbor( 1, ( iNeighbor+1 )%2 ) ) {
 // #ifdef SMILEI_ACCELERATOR_GPU_OACC
@@ -521,9 +616,14 @@ void SyncVectorPatch::sumAllComponents( std::vector<Field *> &fields, VectorPatc
 // #endif
                     }
                 }
-                vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIz[ifield             ], 2, smpi, true ); // Jx
-                vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIz[ifield+nPatchMPIz  ], 2, smpi, true ); // Jy
-                vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIz[ifield+2*nPatchMPIz], 2, smpi, true ); // Jz
+                if( !aggregated[2] ) {
+                    vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIz[ifield             ], 2, smpi, true ); // Jx
+                    vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIz[ifield+nPatchMPIz  ], 2, smpi, true ); // Jy
+                    vecPatches( ipatch )->initSumField( vecPatches.densitiesMPIz[ifield+2*nPatchMPIz], 2, smpi, true ); // Jz
+                }
+            }
+            if( aggregated[2] ) {
+                aggregated[2]->start( vecPatches.densitiesMPIz, vecPatches.MPIzIdx, vecPatches, 2, 3 );
             }
 
             // iDim = 2 local
@@ -587,6 +687,9 @@ void SyncVectorPatch::sumAllComponents( std::vector<Field *> &fields, VectorPatc
             }
 
             // iDim = 2, complete non local sync through MPIfinalize (waitall)
+            if( aggregated[2] ) {
+                aggregated[2]->finalize();
+            }
 #ifndef _NO_MPI_TM
             #pragma omp for schedule(static)
 #else
@@ -594,9 +697,11 @@ void SyncVectorPatch::sumAllComponents( std::vector<Field *> &fields, VectorPatc
 #endif
             for( unsigned int ifield=0 ; ifield<nPatchMPIz ; ifield=ifield+1 ) {
                 unsigned int ipatch = vecPatches.MPIzIdx[ifield];
-                vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIz[ifield             ], 2 ); // Jx
-                vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIz[ifield+nPatchMPIz  ], 2 ); // Jy
-                vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIz[ifield+2*nPatchMPIz], 2 ); // Jz
+                if( !aggregated[2] ) {
+                    vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIz[ifield             ], 2 ); // Jx
+                    vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIz[ifield+nPatchMPIz  ], 2 ); // Jy
+                    vecPatches( ipatch )->finalizeSumField( vecPatches.densitiesMPIz[ifield+2*nPatchMPIz], 2 ); // Jz
+                }
                 for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
                     if ( vecPatches( ipatch )->is_a_MPI_neighbor( 2, ( iNeighbor+1 )%2 ) ) {
 // #ifdef SMILEI_ACCELERATOR_GPU_OACC
@@ -989,6 +1094,8 @@ void SyncVectorPatch::exchangeAlongAllDirections( std::vector<Field *> fields, V
     oversize[1] = vecPatches( 0 )->EMfields->oversize[1];
     oversize[2] = vecPatches( 0 )->EMfields->oversize[2];
 
+    AggregatedExchange *aggregated = aggregatedExchange( fields, vecPatches, fields[0]->name );
+
     for( unsigned int iDim=0 ; iDim<fields[0]->dims_.size() ; iDim++ ) {
 #ifndef _NO_MPI_TM
         #pragma omp for schedule(static)
@@ -1002,6 +1109,8 @@ void SyncVectorPatch::exchangeAlongAllDirections( std::vector<Field *> fields, V
                     fields[ipatch]->extract_fields_exch( iDim, iNeighbor, oversize[iDim] );
                 }
             }
+            if ( aggregated )
+                continue;
             if ( !dynamic_cast<cField*>( fields[ipatch] ) )
                 vecPatches( ipatch )->initExchange       ( fields[ipatch], iDim, smpi );
             else
@@ -1009,6 +1118,11 @@ void SyncVectorPatch::exchangeAlongAllDirections( std::vector<Field *> fields, V
         }
     } // End for iDim
 
+    if( aggregated ) {
+        std::vector<int> one_field_per_patch;
+        aggregated->start( fields, one_field_per_patch, vecPatches, 0, fields[0]->dims_.size() );
+    }
+
     unsigned int nx_, ny_( 1 ), nz_( 1 ), h0, size[3], gsp[3];
     T *pt1, *pt2;
     F *field1, *field2;
@@ -1087,6 +1201,11 @@ void SyncVectorPatch::finalizeExchangeAlongAllDirections( std::vector<Field *> f
     oversize[1] = vecPatches( 0 )->EMfields->oversize[1];
     oversize[2] = vecPatches( 0 )->EMfields->oversize[2];
 
+    AggregatedExchange *aggregated = aggregatedExchange( fields, vecPatches, fields[0]->name );
+    if( aggregated ) {
+        aggregated->finalize();
+    }
+
     for( unsigned int iDim=0 ; iDim<fields[0]->dims_.size() ; iDim++ ) {
 #ifndef _NO_MPI_TM
         #pragma omp for schedule(static)
@@ -1094,7 +1213,9 @@ void SyncVectorPatch::finalizeExchangeAlongAllDirections( std::vector<Field *> f
         #pragma omp single
 #endif
         for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
-            vecPatches( ipatch )->finalizeExchange( fields[ipatch], iDim );
+            if( !aggregated ) {
+                vecPatches( ipatch )->finalizeExchange( fields[ipatch], iDim );
+            }
 
             for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
                 if ( vecPatches( ipatch )->is_a_MPI_neighbor( iDim, ( iNeighbor+1 )%2 ) ) {
@@ -1257,6 +1378,12 @@ void SyncVectorPatch::exchangeSynchronizedPerDirection( std::vector<Field *> fie
         }
     }
 
+    AggregatedExchange *aggregated[3] = { NULL, NULL, NULL };
+    for( unsigned int iDim=0 ; iDim<fields[0]->dims_.size() ; iDim++ ) {
+        aggregated[iDim] = aggregatedExchange( fields, vecPatches, fields[0]->name + "_synchronized_" + std::to_string( iDim ) );
+    }
+    std::vector<int> one_field_per_patch;
+
     if( fields[0]->dims_.size()>2 ) {
 
         // Dimension 2
@@ -1272,11 +1399,17 @@ void SyncVectorPatch::exchangeSynchronizedPerDirection( std::vector<Field *> fie
                     fields[ipatch]->extract_fields_exch( 2, iNeighbor, oversize[2] );
                 }
             }
+            if ( aggregated[2] )
+                continue;
             if ( !dynamic_cast<cField*>( fields[ipatch] ) )
                 vecPatches( ipatch )->initExchange( fields[ipatch], 2, smpi );
             else
                 vecPatches( ipatch )->initExchangeComplex( fields[ipatch], 2, smpi );
         }
+        if( aggregated[2] ) {
+            aggregated[2]->start( fields, one_field_per_patch, vecPatches, 2, 3 );
+            aggregated[2]->finalize();
+        }
         
 
 #ifndef _NO_MPI_TM
@@ -1285,7 +1418,9 @@ void SyncVectorPatch::exchangeSynchronizedPerDirection( std::vector<Field *> fie
         #pragma omp single
 #endif
         for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
-            vecPatches( ipatch )->finalizeExchange( fields[ipatch], 2 );
+            if( !aggregated[2] ) {
+                vecPatches( ipatch )->finalizeExchange( fields[ipatch], 2 );
+            }
 
             for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
                 if ( vecPatches( ipatch )->is_a_MPI_neighbor( 2, ( iNeighbor+1 )%2 ) ) {
@@ -1333,11 +1468,17 @@ void SyncVectorPatch::exchangeSynchronizedPerDirection( std::vector<Field *> fie
                 fields[ipatch]->extract_fields_exch( 1, iNeighbor, oversize[1] );
             }
         }
+        if ( aggregated[1] )
+            continue;
         if ( !dynamic_cast<cField*>( fields[ipatch] ) )
             vecPatches( ipatch )->initExchange( fields[ipatch], 1, smpi );
         else
             vecPatches( ipatch )->initExchangeComplex( fields[ipatch], 1, smpi );
     }
+    if( aggregated[1] ) {
+        aggregated[1]->start( fields, one_field_per_patch, vecPatches, 1, 2 );
+        aggregated[1]->finalize();
+    }
 
 #ifndef _NO_MPI_TM
     #pragma omp for schedule(static)
@@ -1345,7 +1486,9 @@ void SyncVectorPatch::exchangeSynchronizedPerDirection( std::vector<Field *> fie
     #pragma omp single
 #endif
     for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
-        vecPatches( ipatch )->finalizeExchange( fields[ipatch], 1 );
+        if( !aggregated[1] ) {
+            vecPatches( ipatch )->finalizeExchange( fields[ipatch], 1 );
+        }
 
         for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
             if ( vecPatches( ipatch )->is_a_MPI_neighbor( 1, ( iNeighbor+1 )%2 ) ) {
@@ -1389,11 +1532,17 @@ void SyncVectorPatch::exchangeSynchronizedPerDirection( std::vector<Field *> fie
                 fields[ipatch]->extract_fields_exch( 0, iNeighbor, oversize[0] );
             }
         }
+        if ( aggregated[0] )
+            continue;
         if ( !dynamic_cast<cField*>( fields[ipatch] ) )
             vecPatches( ipatch )->initExchange( fields[ipatch], 0, smpi );
         else
             vecPatches( ipatch )->initExchangeComplex( fields[ipatch], 0, smpi );
     }
+    if( aggregated[0] ) {
+        aggregated[0]->start( fields, one_field_per_patch, vecPatches, 0, 1 );
+        aggregated[0]->finalize();
+    }
 
 #ifndef _NO_MPI_TM
     #pragma omp for schedule(static)
@@ -1401,7 +1550,9 @@ void SyncVectorPatch::exchangeSynchronizedPerDirection( std::vector<Field *> fie
     #pragma omp single
 #endif
     for( unsigned int ipatch=0 ; ipatch<fields.size() ; ipatch++ ) {
-        vecPatches( ipatch )->finalizeExchange( fields[ipatch], 0 );
+        if( !aggregated[0] ) {
+            vecPatches( ipatch )->finalizeExchange( fields[ipatch], 0 );
+        }
 
         for (int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++) {
             if ( vecPatches( ipatch )->is_a_MPI_neighbor( 0, ( iNeighbor+1 )%2 ) ) {
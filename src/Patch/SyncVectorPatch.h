@@ -21,6 +21,8 @@ public :
     static void finalizeExchParticlesAndSort( VectorPatch &vecPatches, int ispec, Params &params, SmileiMPI *smpi );
     static void initExchParticlesAlongDimension( VectorPatch &vecPatches, int ispec, int iDim, Params &params, SmileiMPI *smpi );
     static void finalizeExchParticlesAlongDimension( VectorPatch &vecPatches, int ispec, int iDim, Params &params, SmileiMPI *smpi );
+    //! True if particles are exchanged in a single pass, directly towards their final destination
+    static bool singlePassExchange( VectorPatch &vecPatches, Params &params, SmileiMPI *smpi );
 
     //! Densities synchronization
     static void sumRhoJ( Params &params, VectorPatch &vecPatches, SmileiMPI *smpi );
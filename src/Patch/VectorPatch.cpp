@@ -30,6 +30,7 @@
 #include "EnvelopeBCAM_PML.h"
 
 #include "SyncVectorPatch.h"
+#include "AggregatedExchange.h"
 #include "Timers.h"
 #include "gpu.h"
 #include "interface.h"
@@ -39,12 +40,18 @@ using namespace std;
 VectorPatch::VectorPatch()
 {
     domain_decomposition_ = NULL ;
+    aggregated_exchange_comm_ = MPI_COMM_NULL;
+    particle_exchange_comm_ = MPI_COMM_NULL;
+    binnings_timer_ = NULL;
 }
 
 
 VectorPatch::VectorPatch( Params &params )
 {
     domain_decomposition_ = DomainDecompositionFactory::create( params );
+    aggregated_exchange_comm_ = MPI_COMM_NULL;
+    particle_exchange_comm_ = MPI_COMM_NULL;
+    binnings_timer_ = NULL;
 }
 
 
@@ -95,6 +102,36 @@ void VectorPatch::close( SmileiMPI *smpiData )
     }
 
     patches_.clear();
+
+    for( map<string, AggregatedExchange *>::iterator it = aggregated_exchanges_.begin() ; it != aggregated_exchanges_.end() ; it++ ) {
+        delete it->second;
+    }
+    aggregated_exchanges_.clear();
+    if( aggregated_exchange_comm_ != MPI_COMM_NULL ) {
+        MPI_Comm_free( &aggregated_exchange_comm_ );
+    }
+    if( particle_exchange_comm_ != MPI_COMM_NULL ) {
+        MPI_Comm_free( &particle_exchange_comm_ );
+    }
+}
+
+AggregatedExchange *VectorPatch::aggregatedExchange( string key )
+{
+    if( aggregated_exchange_comm_ == MPI_COMM_NULL ) {
+        return NULL;
+    }
+    AggregatedExchange *exchange;
+    #pragma omp critical
+    {
+        map<string, AggregatedExchange *>::iterator it = aggregated_exchanges_.find( key );
+        if( it != aggregated_exchanges_.end() ) {
+            exchange = it->second;
+        } else {
+            exchange = new AggregatedExchange( aggregated_exchange_comm_, aggregated_exchanges_.size() );
+            aggregated_exchanges_[key] = exchange;
+        }
+    }
+    return exchange;
 }
 
 void VectorPatch::createDiags( Params &params, SmileiMPI *smpi, OpenPMDparams &openPMD, RadiationTables * radiation_tables_ )
@@ -207,6 +244,13 @@ void VectorPatch::createDiags( Params &params, SmileiMPI *smpi, OpenPMDparams &o
     for( unsigned int idiag = 0 ;  idiag < localDiags.size() ; idiag++ ) {
         diag_timers_.push_back( new Timer( localDiags[idiag]->filename ) );
     }
+    for( unsigned int idiag = 0 ;  idiag < globalDiags.size() ; idiag++ ) {
+        if( dynamic_cast<DiagnosticParticleBinningBase*>( globalDiags[idiag] ) ) {
+            binnings_timer_ = new Timer( "particle binnings" );
+            diag_timers_.push_back( binnings_timer_ );
+            break;
+        }
+    }
 
     for( unsigned int idiag = 0 ;  idiag < diag_timers_.size() ; idiag++ ) {
         diag_timers_[idiag]->init( smpi );
@@ -329,36 +373,29 @@ void VectorPatch::dynamics( Params &params,
                             MultiphotonBreitWheelerTables &MultiphotonBreitWheelerTables,
                             double time_dual, Timers &timers, int itime )
 {
+    EventTracing::Scope trace( EventTracing::dynamics );
 
     #pragma omp single
     {
         diag_flag = ( needsRhoJsNow( itime ) || params.is_spectral );
+        // Counter of the stochastic operators
+        for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+            ( *this )( ipatch )->rand_->setIteration( itime );
+        }
     }
 
     timers.particles.restart();
     ostringstream t;
 
-#ifdef _PARTEVENTTRACING
-    bool diag_PartEventTracing {false};
-    if( !params.Laser_Envelope_model ) {
-        diag_PartEventTracing = smpi->diagPartEventTracing( time_dual, params.timestep);
-        if (diag_PartEventTracing) smpi->reference_time_ = MPI_Wtime();
+    if( params.dynamics_tasks ) {
+        dynamicsWithTasks( params, smpi, simWindow, RadiationTables,
+                           MultiphotonBreitWheelerTables,
+                           time_dual, timers, itime );
+    } else {
+        dynamicsWithoutTasks( params, smpi, simWindow, RadiationTables,
+                              MultiphotonBreitWheelerTables,
+                              time_dual, timers, itime );
     }
-#endif
-
-    dynamicsWithoutTasks( params, smpi, simWindow, RadiationTables,
-                          MultiphotonBreitWheelerTables,
-                          time_dual, timers, itime );
-
-#ifdef _PARTEVENTTRACING
-    if (!params.Laser_Envelope_model){
-        #pragma omp single
-        {
-        int iteration = int((time_dual-0.5*params.timestep)/params.timestep);
-        if(diag_PartEventTracing) writeParticleEventTracingOutput(params, smpi, iteration);
-        } // end single
-    } // end if Laser envelope model
-#  endif
 
     timers.particles.update( params.printNow( itime ) );
 #ifdef __DETAILED_TIMERS
@@ -429,12 +466,39 @@ void VectorPatch::initExchParticles( Params &params, SmileiMPI *smpi, SimWindow
     timers.syncPart.update( params.printNow( itime ) );
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Dynamics of one species in one patch, with vectorized, adaptive scalar or scalar operators
+// ---------------------------------------------------------------------------------------------------------------------
+static void speciesDynamics( Species *spec, unsigned int ispec, double time_dual, ElectroMagn *EMfields,
+                             Params &params, bool diag_flag, PartWalls *partwalls, Patch *patch, SmileiMPI *smpi,
+                             RadiationTables &RadiationTables,
+                             MultiphotonBreitWheelerTables &MultiphotonBreitWheelerTables )
+{
+    // Dynamics with vectorized operators
+    if( spec->vectorized_operators ) {
+        spec->dynamics( time_dual, ispec, EMfields, params, diag_flag, partwalls, patch, smpi,
+                        RadiationTables, MultiphotonBreitWheelerTables );
+    }
+    // Dynamics with scalar operators
+    else if( params.vectorization_mode == "adaptive" ) {
+        spec->scalarDynamics( time_dual, ispec, EMfields, params, diag_flag, partwalls, patch, smpi,
+                              RadiationTables, MultiphotonBreitWheelerTables );
+    } else {
+        spec->Species::dynamics( time_dual, ispec, EMfields, params, diag_flag, partwalls, patch, smpi,
+                                 RadiationTables, MultiphotonBreitWheelerTables );
+    }
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 //! For all patches, exchange particles and sort them.
 // ---------------------------------------------------------------------------------------------------------------------
 void VectorPatch::finalizeExchParticlesAndSort( Params &params, SmileiMPI *smpi, SimWindow *simWindow,
+        RadiationTables &RadiationTables,
+        MultiphotonBreitWheelerTables &MultiphotonBreitWheelerTables,
         double time_dual, Timers &timers, int itime )
 {
+    EventTracing::Scope trace( EventTracing::particle_exchange_and_sort );
+
     timers.syncPart.restart();
 
 
@@ -444,6 +508,9 @@ void VectorPatch::finalizeExchParticlesAndSort( Params &params, SmileiMPI *smpi,
     for( unsigned int ispec=0 ; ispec<( *this )( 0 )->vecSpecies.size(); ispec++ ) {
         if( ( *this )( 0 )->vecSpecies[ispec]->hasMoved( time_dual, simWindow ) ) {
             SyncVectorPatch::finalizeExchParticlesAndSort( ( *this ), ispec, params, smpi ); // Included sortParticles
+            if( species( 0, ispec )->subcycling_ > 1 ) {
+                catchUpSubcycledPush( params, smpi, ispec, RadiationTables, MultiphotonBreitWheelerTables, time_dual );
+            }
         }
 
     }
@@ -466,6 +533,61 @@ void VectorPatch::finalizeExchParticlesAndSort( Params &params, SmileiMPI *smpi,
 } // END finalizeExchParticlesAndSort
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+//! Subcycled species which received particles during a subcycle: the delayed push catches up with the fields
+//! averaged over the subcycle (its currents are added to those of the next timestep). The particles it moved are
+//! exchanged and sorted as after a regular push, then the particles received are inserted. The particles sent
+//! to patches still delayed make them catch up in turn, until no patch holds received particles.
+// ---------------------------------------------------------------------------------------------------------------------
+void VectorPatch::catchUpSubcycledPush( Params &params, SmileiMPI *smpi, unsigned int ispec,
+        RadiationTables &RadiationTables,
+        MultiphotonBreitWheelerTables &MultiphotonBreitWheelerTables,
+        double time_dual )
+{
+    while( true ) {
+        #pragma omp single
+        subcycle_catch_up_ = 0;
+        
+        #pragma omp for schedule(runtime)
+        for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+            Species *spec = species( ipatch, ispec );
+            if( spec->subcycle_steps_ > 0 && spec->subcycle_newcomers_ && spec->subcycle_newcomers_->size() > 0 ) {
+                spec->beginSubcycledPush( params, emfields( ipatch ) );
+                spec->swapSubcycleCurrents( emfields( ipatch ) );
+                speciesDynamics( spec, ispec, time_dual, emfields( ipatch ), params, false, partwalls( ipatch ),
+                                 ( *this )( ipatch ), smpi, RadiationTables, MultiphotonBreitWheelerTables );
+                spec->swapSubcycleCurrents( emfields( ipatch ) );
+                spec->endSubcycledPush( params, emfields( ipatch ) );
+                #pragma omp atomic write
+                subcycle_catch_up_ = 1;
+            }
+        }
+        
+        #pragma omp master
+        {
+            MPI_Allreduce( MPI_IN_PLACE, &subcycle_catch_up_, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD );
+        }
+        #pragma omp barrier
+        const bool caught_up = subcycle_catch_up_ > 0;
+        #pragma omp barrier
+        if( ! caught_up ) {
+            break;
+        }
+        
+        // Particles moved by the catch-up: exchange and sort (received particles are still kept apart)
+        SyncVectorPatch::initExchParticles( *this, ispec, params, smpi );
+        SyncVectorPatch::finalizeExchParticlesAndSort( *this, ispec, params, smpi );
+        
+        #pragma omp for schedule(runtime)
+        for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+            Species *spec = species( ipatch, ispec );
+            if( spec->subcycle_steps_ == 0 && spec->subcycle_newcomers_ && spec->subcycle_newcomers_->size() > 0 ) {
+                spec->importSubcycleNewcomers( params, ( *this )( ipatch ), localDiags, time_dual );
+            }
+        }
+    }
+}
+
 //! Perform the particles merging on all patches
 void VectorPatch::mergeParticles(Params &params, double time_dual,Timers &timers, int itime )
 {
@@ -818,6 +940,8 @@ void VectorPatch::resetRhoJ(bool old/*=false*/)
 // ---------------------------------------------------------------------------------------------------------------------
 void VectorPatch::sumDensities( Params &params, double time_dual, Timers &timers, int itime, SimWindow *simWindow, SmileiMPI *smpi )
 {
+    EventTracing::Scope trace( EventTracing::sum_densities );
+
     bool some_particles_are_moving = false;
     unsigned int n_species( ( *this )( 0 )->vecSpecies.size() );
     for( unsigned int ispec=0 ; ispec < n_species ; ispec++ ) {
@@ -959,28 +1083,65 @@ void VectorPatch::sumSusceptibility( Params &params, double time_dual, Timers &t
 
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Splits the cells of a patch (dual indices) in boxes along the borders, which contain all the cells sent to or
+// received from the neighbor patches, followed by the interior box (possibly empty)
+// ---------------------------------------------------------------------------------------------------------------------
+static void borderAndInteriorBoxes( ElectroMagn *EMfields, vector<vector<unsigned int> > &box_start, vector<vector<unsigned int> > &box_end )
+{
+    unsigned int nDim = EMfields->dimDual.size();
+    vector<unsigned int> start( nDim, 0 ), end = EMfields->dimDual;
+    box_start.clear();
+    box_end.clear();
+    for( unsigned int iDim=0 ; iDim<nDim ; iDim++ ) {
+        // Cells exchanged along this dimension, and the cells they depend on
+        unsigned int width = 2*EMfields->oversize[iDim] + 2;
+        unsigned int low  = min( start[iDim] + width, end[iDim] );
+        unsigned int high = max( end[iDim] - min( width, end[iDim] ), low );
+        box_start.push_back( start );
+        box_end  .push_back( end );
+        box_end  .back()[iDim] = low;
+        box_start.push_back( start );
+        box_end  .push_back( end );
+        box_start.back()[iDim] = high;
+        start[iDim] = low;
+        end  [iDim] = high;
+    }
+    box_start.push_back( start );
+    box_end  .push_back( end );
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 // For all patch, update E and B (Ampere, Faraday, boundary conditions, exchange B and center B)
 // ---------------------------------------------------------------------------------------------------------------------
 void VectorPatch::solveMaxwell( Params &params, SimWindow *simWindow, int itime, double time_dual, Timers &timers, SmileiMPI *smpi )
 {
+    EventTracing::Scope trace( EventTracing::maxwell );
+
     timers.maxwell.restart();
 
     // Current filter in intermediate space
     if (params.currentFilter_passes.size() > 0){
-        for( unsigned int ipassfilter=0 ; ipassfilter<*std::max_element(std::begin(params.currentFilter_passes), std::end(params.currentFilter_passes)) ; ipassfilter++ ) {
+        unsigned int npasses = *std::max_element(std::begin(params.currentFilter_passes), std::end(params.currentFilter_passes));
+        // With single_exchange, the ghost cells are wide enough for all the passes:
+        // they are applied to each patch one after the other, while its currents are in cache
+        unsigned int npasses_per_exchange = params.currentFilter_single_exchange ? npasses : 1;
+        for( unsigned int ipassfilter=0 ; ipassfilter<npasses ; ipassfilter+=npasses_per_exchange ) {
             #pragma omp for schedule(static)
             for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
-                // Current spatial filtering
-                if (params.currentFilter_model=="binomial"){
-                    ( *this )( ipatch )->EMfields->binomialCurrentFilter(ipassfilter, params.currentFilter_passes);
-                }
-                if (params.currentFilter_model=="customFIR"){
-                    ( *this )( ipatch )->EMfields->customFIRCurrentFilter(ipassfilter, params.currentFilter_passes, params.currentFilter_kernelFIR);
+                for( unsigned int ipass=ipassfilter ; ipass<ipassfilter+npasses_per_exchange ; ipass++ ) {
+                    // Current spatial filtering
+                    if (params.currentFilter_model=="binomial"){
+                        ( *this )( ipatch )->EMfields->binomialCurrentFilter(ipass, params.currentFilter_passes);
+                    }
+                    if (params.currentFilter_model=="customFIR"){
+                        ( *this )( ipatch )->EMfields->customFIRCurrentFilter(ipass, params.currentFilter_passes, params.currentFilter_kernelFIR);
+                    }
                 }
             }
+            // After several passes, the ghost cells at the corners are only exact if the directions are exchanged one after the other
             if (params.geometry != "AMcylindrical"){
-                if (params.currentFilter_model=="customFIR"){
+                if (params.currentFilter_model=="customFIR" || npasses_per_exchange > 1){
                     SyncVectorPatch::exchangeSynchronizedPerDirection<double,Field>( listJx_, *this, smpi );
                     SyncVectorPatch::exchangeSynchronizedPerDirection<double,Field>( listJy_, *this, smpi );
                     SyncVectorPatch::exchangeSynchronizedPerDirection<double,Field>( listJz_, *this, smpi );
@@ -992,6 +1153,12 @@ void VectorPatch::solveMaxwell( Params &params, SimWindow *simWindow, int itime,
                     SyncVectorPatch::exchangeAlongAllDirections<double,Field>( listJz_, *this, smpi );
                     SyncVectorPatch::finalizeExchangeAlongAllDirections( listJz_, *this );
                 }
+            } else if( npasses_per_exchange > 1 ) {
+                for (unsigned int imode=0 ; imode < params.nmodes; imode++) {
+                    SyncVectorPatch::exchangeSynchronizedPerDirection<complex<double>,cField>( listJl_[imode], *this, smpi );
+                    SyncVectorPatch::exchangeSynchronizedPerDirection<complex<double>,cField>( listJr_[imode], *this, smpi );
+                    SyncVectorPatch::exchangeSynchronizedPerDirection<complex<double>,cField>( listJt_[imode], *this, smpi );
+                }
             } else {
                 for (unsigned int imode=0 ; imode < params.nmodes; imode++) {
                     SyncVectorPatch::exchangeAlongAllDirections<complex<double>,cField>( listJl_[imode], *this, smpi );
@@ -1017,26 +1184,54 @@ void VectorPatch::solveMaxwell( Params &params, SimWindow *simWindow, int itime,
         ( *( *this )( ipatch )->EMfields->MaxwellAmpereSolver_ )( ( *this )( ipatch )->EMfields );
     }
 
-    #pragma omp for schedule(static)
-    for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
-        // Computes Bx_, By_, Bz_ at time n+1 on interior points.
-        ( *( *this )( ipatch )->EMfields->MaxwellFaradaySolver_ )( ( *this )( ipatch )->EMfields );
-    }
-    //Synchronize B fields between patches.
-    timers.maxwell.update( params.printNow( itime ) );
-
+    if( params.overlap_field_exchange ) {
+        vector<vector<unsigned int> > box_start, box_end;
+        // Computes Bx_, By_, Bz_ at time n+1 near the borders, where the cells to be exchanged are
+        #pragma omp for schedule(static) private(box_start,box_end)
+        for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+            ElectroMagn *EMfields = ( *this )( ipatch )->EMfields;
+            borderAndInteriorBoxes( EMfields, box_start, box_end );
+            for( unsigned int ibox=0 ; ibox+1<box_start.size() ; ibox++ ) {
+                EMfields->MaxwellFaradaySolver_->updateBox( EMfields, &box_start[ibox][0], &box_end[ibox][0] );
+            }
+        }
+        timers.maxwell.update( params.printNow( itime ) );
 
-    timers.syncField.restart();
-    if( params.geometry != "AMcylindrical" ) {
-        if( params.is_spectral ) SyncVectorPatch::exchangeE( params, ( *this ), smpi );
+        //Synchronize B fields between patches while the interiors are computed
+        timers.syncField.restart();
         SyncVectorPatch::exchangeB( params, ( *this ), smpi );
+        timers.syncField.update( params.printNow( itime ) );
+
+        timers.maxwell.restart();
+        #pragma omp for schedule(static) private(box_start,box_end)
+        for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+            ElectroMagn *EMfields = ( *this )( ipatch )->EMfields;
+            borderAndInteriorBoxes( EMfields, box_start, box_end );
+            EMfields->MaxwellFaradaySolver_->updateBoxByTiles( EMfields, &box_start.back()[0], &box_end.back()[0] );
+        }
+        timers.maxwell.update( params.printNow( itime ) );
     } else {
-        for( unsigned int imode = 0 ; imode < static_cast<ElectroMagnAM *>( patches_[0]->EMfields )->El_.size() ; imode++ ) {
-            if( params.is_spectral ) SyncVectorPatch::exchangeE( params, ( *this ), imode, smpi );
-            SyncVectorPatch::exchangeB( params, ( *this ), imode, smpi );
+        #pragma omp for schedule(static)
+        for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+            // Computes Bx_, By_, Bz_ at time n+1 on interior points.
+            ( *( *this )( ipatch )->EMfields->MaxwellFaradaySolver_ )( ( *this )( ipatch )->EMfields );
+        }
+        //Synchronize B fields between patches.
+        timers.maxwell.update( params.printNow( itime ) );
+
+
+        timers.syncField.restart();
+        if( params.geometry != "AMcylindrical" ) {
+            if( params.is_spectral ) SyncVectorPatch::exchangeE( params, ( *this ), smpi );
+            SyncVectorPatch::exchangeB( params, ( *this ), smpi );
+        } else {
+            for( unsigned int imode = 0 ; imode < static_cast<ElectroMagnAM *>( patches_[0]->EMfields )->El_.size() ; imode++ ) {
+                if( params.is_spectral ) SyncVectorPatch::exchangeE( params, ( *this ), imode, smpi );
+                SyncVectorPatch::exchangeB( params, ( *this ), imode, smpi );
+            }
         }
+        timers.syncField.update( params.printNow( itime ) );
     }
-    timers.syncField.update( params.printNow( itime ) );
 
 
     if ( (params.multiple_decomposition) && ( itime!=0 ) && ( time_dual > params.time_fields_frozen ) ) { // multiple_decomposition = true -> is_spectral = true
@@ -1227,6 +1422,9 @@ void VectorPatch::initAllDiags( Params &params, SmileiMPI *smpi )
 
 void VectorPatch::closeAllDiags( SmileiMPI *smpi )
 {
+    // Asynchronous outputs must be complete before the files are closed
+    DiagnosticWriter::instance().waitAll();
+
     // MPI master closes all global diags
     if( smpi->isMaster() )
         for( unsigned int idiag = 0 ; idiag < globalDiags.size() ; idiag++ ) {
@@ -1253,6 +1451,8 @@ void VectorPatch::closeAllDiags( SmileiMPI *smpi )
 // ---------------------------------------------------------------------------------------------------------------------
 void VectorPatch::runAllDiags( Params &/*params*/, SmileiMPI *smpi, unsigned int itime, Timers &timers, SimWindow *simWindow )
 {
+    EventTracing::Scope trace( EventTracing::diagnostics );
+
 #if defined( SMILEI_ACCELERATOR_GPU )
     bool data_on_cpu_updated = false;
 #endif
@@ -1416,13 +1616,20 @@ void VectorPatch::runAllDiags( Params &/*params*/, SmileiMPI *smpi, unsigned int
     #pragma omp barrier
 
     // Global diags: scalars + binnings
+    // The binnings due now are only collected here, and run together below
+    vector<unsigned int> binning_indices;
+    vector<DiagnosticParticleBinningBase *> binnings;
     for( unsigned int idiag = 0 ; idiag < globalDiags.size() ; idiag++ ) {
         diag_timers_[idiag]->restart();
 
         #pragma omp single
         globalDiags[idiag]->theTimeIsNow_ = globalDiags[idiag]->prepare( itime );
 
-        if( globalDiags[idiag]->theTimeIsNow_ ) {
+        DiagnosticParticleBinningBase* binning = dynamic_cast<DiagnosticParticleBinningBase*>( globalDiags[idiag] );
+        if( binning && binning->theTimeIsNow_ ) {
+            binning_indices.push_back( idiag );
+            binnings.push_back( binning );
+        } else if( globalDiags[idiag]->theTimeIsNow_ ) {
             // All patches run
             SMILEI_PY_SAVE_MASTER_THREAD
             #pragma omp for schedule(runtime)
@@ -1441,6 +1648,45 @@ void VectorPatch::runAllDiags( Params &/*params*/, SmileiMPI *smpi, unsigned int
         diag_timers_[idiag]->update();
     }
 
+    // Binnings: a single pass on the patches for all of them, so that the particles
+    // of each patch are read while in cache, and the axes common to several diags are computed once.
+    // The time of this pass is accounted to a timer shared by all binnings.
+    if( binnings.size() > 0 ) {
+        binnings_timer_->restart();
+
+        #pragma omp single
+        for( unsigned int ibin = 0 ; ibin < binnings.size() ; ibin++ ) {
+            binnings[ibin]->initThreadData();
+        }
+        set<string> shared_axes = DiagnosticParticleBinningBase::sharedAxisKeys( binnings );
+
+        SMILEI_PY_SAVE_MASTER_THREAD
+        #pragma omp for schedule(runtime)
+        for( unsigned int ipatch=0 ; ipatch<size() ; ipatch++ ) {
+            HistogramAxisCache cache( shared_axes );
+            for( unsigned int ibin = 0 ; ibin < binnings.size() ; ibin++ ) {
+                binnings[ibin]->run( ( *this )( ipatch ), itime, simWindow, &cache );
+            }
+        }
+        SMILEI_PY_RESTORE_MASTER_THREAD
+
+        binnings_timer_->update();
+
+        for( unsigned int ibin = 0 ; ibin < binnings.size() ; ibin++ ) {
+            unsigned int idiag = binning_indices[ibin];
+            diag_timers_[idiag]->restart();
+            // Sum the arrays of all threads
+            binnings[ibin]->reduceThreadData();
+            // MPI procs gather the data and compute
+            #pragma omp single
+            smpi->computeGlobalDiags( globalDiags[idiag], itime );
+            // MPI master writes
+            #pragma omp single
+            globalDiags[idiag]->write( itime, smpi );
+            diag_timers_[idiag]->update();
+        }
+    }
+
     // Local diags : fields, probes, tracks
     for( unsigned int idiag = 0 ; idiag < localDiags.size() ; idiag++ ) {
         diag_timers_[globalDiags.size()+idiag]->restart();
@@ -1463,6 +1709,11 @@ void VectorPatch::runAllDiags( Params &/*params*/, SmileiMPI *smpi, unsigned int
         localDiags[idiag]->theTimeIsNow_ = localDiags[idiag]->prepare( itime );
         // All MPI run their stuff and write out
         if( localDiags[idiag]->theTimeIsNow_ ) {
+            // Collective HDF5 calls outside of the writer thread require that it is idle
+            if( ! localDiags[idiag]->asynchronous_ ) {
+                #pragma omp master
+                DiagnosticWriter::instance().waitAll();
+            }
             localDiags[idiag]->run( smpi, *this, itime, simWindow, timers );
         }
 
@@ -1562,10 +1813,13 @@ void VectorPatch::solvePoisson( Params &params, SmileiMPI *smpi )
     // ---------------------------------------------------------
     // Starting iterative loop for the conjugate gradient method
     // ---------------------------------------------------------
+    if( params.poisson_solver == "PCG" ) {
+        iteration = solvePoissonPCG( params, smpi, false, 1., ( double )( nx_p2_global ), ctrl );
+    }
     if( smpi->isMaster() ) {
         DEBUG( "Starting iterative loop for CG method" );
     }
-    while( ( ctrl > error_max ) && ( iteration<iteration_max ) ) {
+    while( params.poisson_solver == "CG" && ( ctrl > error_max ) && ( iteration<iteration_max ) ) {
         iteration++;
         if( smpi->isMaster() ) {
             DEBUG( "iteration " << iteration << " started with control parameter ctrl = " << ctrl*1.e14 << " x 1e-14" );
@@ -1779,6 +2033,92 @@ void VectorPatch::solvePoisson( Params &params, SmileiMPI *smpi )
 
 } // END solvePoisson
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Preconditioned conjugate gradient (Main.poisson_solver = "PCG") in the variant of Chronopoulos & Gear:
+// the three scalar products of an iteration are reduced at once, and only the preconditioned residual u
+// is exchanged between patches. Starts from the state set by initPoisson (phi = 0, r = -rho).
+//   - ctrl = r.r/ctrl_norm, or sqrt(r.r)/ctrl_norm for the relativistic problem
+// ---------------------------------------------------------------------------------------------------------------------
+unsigned int VectorPatch::solvePoissonPCG( Params &params, SmileiMPI *smpi, bool relativistic, double gamma_mean, double ctrl_norm, double &ctrl )
+{
+    Timer ptimer( "global" );
+    ptimer.init( smpi );
+    ptimer.restart();
+
+    unsigned int iteration_max = relativistic ? params.relativistic_poisson_max_iteration : params.poisson_max_iteration;
+    double           error_max = relativistic ? params.relativistic_poisson_max_error : params.poisson_max_error;
+    unsigned int iteration = 0;
+
+    // Preconditioned residual u = M^-1 r, allocated by initPoisson
+    std::vector<Field *> u_( this->size() );
+    for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+        u_[ipatch] = ( *this )( ipatch )->EMfields->u_;
+    }
+
+    double gamma_old = 0.;
+    double alpha = 0.;
+    while( true ) {
+
+        // u = M^-1 r, exchanged, then w = A u
+        for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+            ElectroMagn *EMfields = ( *this )( ipatch )->EMfields;
+            EMfields->preconditionPoisson( EMfields->r_, EMfields->u_, gamma_mean );
+        }
+        SyncVectorPatch::exchangeAlongAllDirectionsNoOMP<double,Field>( u_, *this, smpi );
+        SyncVectorPatch::finalizeExchangeAlongAllDirectionsNoOMP( u_, *this );
+        for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+            // compute_Ap computes Ap_ from p_
+            ElectroMagn *EMfields = ( *this )( ipatch )->EMfields;
+            swap( EMfields->p_, EMfields->u_ );
+            swap( EMfields->Ap_, EMfields->w_ );
+            if( relativistic ) {
+                EMfields->compute_Ap_relativistic_Poisson( ( *this )( ipatch ), gamma_mean );
+            } else {
+                EMfields->compute_Ap( ( *this )( ipatch ) );
+            }
+            swap( EMfields->p_, EMfields->u_ );
+            swap( EMfields->Ap_, EMfields->w_ );
+        }
+
+        // r.u, w.u and r.r in a single reduction
+        double dot_local[3] = { 0., 0., 0. };
+        double dot[3];
+        for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+            ElectroMagn *EMfields = ( *this )( ipatch )->EMfields;
+            dot_local[0] += EMfields->poissonDotProduct( EMfields->r_, EMfields->u_ );
+            dot_local[1] += EMfields->poissonDotProduct( EMfields->w_, EMfields->u_ );
+            dot_local[2] += EMfields->poissonDotProduct( EMfields->r_, EMfields->r_ );
+        }
+        MPI_Allreduce( dot_local, dot, 3, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+
+        ctrl = relativistic ? sqrt( dot[2] )/ctrl_norm : dot[2]/ctrl_norm;
+        if( smpi->isMaster() ) {
+            DEBUG( "iteration " << iteration << " done, exiting with control parameter ctrl = " << ctrl );
+        }
+        if( ctrl <= error_max || iteration >= iteration_max ) {
+            break;
+        }
+        iteration++;
+
+        // new direction, potential and residual
+        double gamma = dot[0];
+        double beta = iteration == 1 ? 0. : gamma / gamma_old;
+        alpha = iteration == 1 ? gamma / dot[1] : gamma / ( dot[1] - beta * gamma / alpha );
+        gamma_old = gamma;
+        for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+            ElectroMagn *EMfields = ( *this )( ipatch )->EMfields;
+            EMfields->updatePoissonPCG( EMfields->u_, EMfields->w_, alpha, beta, iteration == 1 );
+        }
+    }
+
+    ptimer.update();
+    if( smpi->isMaster() ) {
+        MESSAGE( 1, "Preconditioned Poisson solver: " << iteration << " iterations in " << ptimer.getTime() << " s" );
+    }
+
+    return iteration;
+} // END solvePoissonPCG
+
 void VectorPatch::solvePoissonAM( Params &params, SmileiMPI *smpi )
 {
 
@@ -2169,10 +2509,13 @@ void VectorPatch::solveRelativisticPoisson( Params &params, SmileiMPI *smpi, dou
     // ---------------------------------------------------------
     // Starting iterative loop for the conjugate gradient method
     // ---------------------------------------------------------
+    if( params.poisson_solver == "PCG" ) {
+        iteration = solvePoissonPCG( params, smpi, true, gamma_mean, norm2_source_term, ctrl );
+    }
     if( smpi->isMaster() ) {
         DEBUG( "Starting iterative loop for CG method" );
     }
-    while( ( ctrl > error_max ) && ( iteration<iteration_max ) ) {
+    while( params.poisson_solver == "CG" && ( ctrl > error_max ) && ( iteration<iteration_max ) ) {
         iteration++;
 
         if( ( smpi->isMaster() ) && ( iteration%1000==0 ) ) {
@@ -2800,6 +3143,7 @@ void VectorPatch::solveRelativisticPoissonAM( Params &params, SmileiMPI *smpi, d
 
 void VectorPatch::loadBalance( Params &params, double time_dual, SmileiMPI *smpi, SimWindow *simWindow, unsigned int itime )
 {
+    EventTracing::Scope trace( EventTracing::load_balancing );
 
     // Compute new patch distribution
     smpi->recompute_patch_count( params, *this, time_dual );
@@ -3915,12 +4259,17 @@ void VectorPatch::applyBinaryProcesses( Params &params, int itime, Timers &timer
     }
 
     unsigned int nBPs = patches_[0]->vecBPs.size();
+    const bool measure_load = params.has_load_balancing && params.load_balancing_mode == "measured";
 
     #pragma omp for schedule(runtime)
     for( unsigned int ipatch=0 ; ipatch<size() ; ipatch++ ) {
+        const double patch_start = measure_load ? MPI_Wtime() : 0.;
         for( unsigned int iBPs=0 ; iBPs<nBPs; iBPs++ ) {
             patches_[ipatch]->vecBPs[iBPs]->apply( params, patches_[ipatch], itime, localDiags );
         }
+        if( measure_load ) {
+            patches_[ipatch]->measured_load_ += MPI_Wtime() - patch_start;
+        }
     }
 
     #pragma omp single
@@ -4254,6 +4603,8 @@ void VectorPatch::moveWindow(
     int       itime
     )
 {
+    EventTracing::Scope trace( EventTracing::moving_window );
+
     timers.movWindow.restart();
 
     // Bring all particles and field grids to the Host (except species grids)
@@ -4340,11 +4691,6 @@ void VectorPatch::ponderomotiveUpdateSusceptibilityAndMomentum( Params &params,
 
     timers.particles.restart();
 
-#  ifdef _PARTEVENTTRACING
-    bool diag_PartEventTracing = smpi->diagPartEventTracing( time_dual, params.timestep);
-    if (diag_PartEventTracing) smpi->reference_time_ = MPI_Wtime();
-#  endif
-
     #pragma omp single
     diag_flag = needsRhoJsNow( itime );
 
@@ -4373,24 +4719,9 @@ void VectorPatch::ponderomotiveUpdatePositionAndCurrents( Params &params,
 
     timers.particles.restart();
 
-#ifdef _PARTEVENTTRACING
-    bool diag_PartEventTracing {false};
-    diag_PartEventTracing = smpi->diagPartEventTracing( time_dual, params.timestep);
-    // if (diag_PartEventTracing) smpi->reference_time_ = MPI_Wtime();
-#endif
-
     ponderomotiveUpdatePositionAndCurrentsWithoutTasks( params, smpi, simWindow,
                           time_dual, timers, itime );
 
-// Write Task tracing output files
-#ifdef _PARTEVENTTRACING
-    #pragma omp single
-    {
-        int iteration = int((time_dual-0.5*params.timestep)/params.timestep);
-        if(diag_PartEventTracing) writeParticleEventTracingOutput(params, smpi, iteration);
-    } // end single
-#endif
-
     timers.particles.update( params.printNow( itime ) );
 #ifdef __DETAILED_TIMERS
     timers.interp_env_old.update( *this, params.printNow( itime ) );
@@ -4765,7 +5096,7 @@ void VectorPatch::dynamicsWithoutTasks( Params &params,
                             SimWindow *simWindow,
                             RadiationTables &RadiationTables,
                             MultiphotonBreitWheelerTables &MultiphotonBreitWheelerTables,
-                            double time_dual, Timers &/*timers*/, int /*itime*/ )
+                            double time_dual, Timers &/*timers*/, int itime )
 {
 
 #ifdef _PARTEVENTTRACING
@@ -4773,12 +5104,17 @@ void VectorPatch::dynamicsWithoutTasks( Params &params,
     diag_PartEventTracing = smpi->diagPartEventTracing( time_dual, params.timestep);
 #endif
 
+    const bool measure_load = params.has_load_balancing && params.load_balancing_mode == "measured";
+    const bool patch_timers = params.patch_timers;
+
     SMILEI_PY_SAVE_MASTER_THREAD
     #pragma omp for schedule(runtime)
         for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+            const double patch_start = measure_load ? MPI_Wtime() : 0.;
             ( *this )( ipatch )->EMfields->restartRhoJ();
             for( unsigned int ispec=0 ; ispec<( *this )( ipatch )->vecSpecies.size() ; ispec++ ) {
                 Species *spec = species( ipatch, ispec );
+                spec->addSubcycleCurrents( emfields( ipatch ), ispec, diag_flag );
 
                 if( params.keep_position_old ) {
                     spec->particles->savePositions();
@@ -4790,6 +5126,21 @@ void VectorPatch::dynamicsWithoutTasks( Params &params,
 
                 if( spec->isDynamic( time_dual, simWindow ) || diag_flag ) {
 
+                    // Subcycled species: frozen while their push is delayed
+                    double spec_time_dual = time_dual;
+                    bool subcycled_push = false;
+                    if( spec->subcycling_ > 1 && time_dual > spec->time_frozen_ ) {
+                        if( spec->delaySubcycledPush( params, emfields( ipatch ), itime ) ) {
+                            spec_time_dual = spec->time_frozen_;
+                        } else {
+                            subcycled_push = spec->beginSubcycledPush( params, emfields( ipatch ) );
+                        }
+                    }
+
+                    if( patch_timers ) {
+                        spec->startPerformanceCounters( ( *this )( ipatch ) );
+                    }
+
 #if defined( SMILEI_ACCELERATOR_GPU )
                     if (diag_flag) {
                         spec->Species::prepareSpeciesCurrentAndChargeOnDevice(
@@ -4799,38 +5150,180 @@ void VectorPatch::dynamicsWithoutTasks( Params &params,
                     }
 #endif
 
-                    // Dynamics with vectorized operators
-                    if( spec->vectorized_operators ) {
+                    speciesDynamics( spec, ispec, spec_time_dual, emfields( ipatch ), params, diag_flag, partwalls( ipatch ),
+                                     ( *this )( ipatch ), smpi, RadiationTables, MultiphotonBreitWheelerTables );
+
+                    if( subcycled_push ) {
+                        spec->endSubcycledPush( params, emfields( ipatch ) );
+                    }
+
+                    if( patch_timers ) {
+                        spec->stopPerformanceCounters( ( *this )( ipatch ) );
+                    }
+                } // end if condition on species
+            } // end loop on species
+            if( measure_load ) {
+                ( *this )( ipatch )->measured_load_ += MPI_Wtime() - patch_start;
+            }
+            //MESSAGE("species dynamics");
+        } // end loop on patches
+    SMILEI_PY_RESTORE_MASTER_THREAD
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Particle dynamics scheduled as OpenMP tasks, so that the bins of the densest patches are shared between threads
+//   - species compatible with the tasks per bin: one chain interpolation -> push -> BC -> projection per bin,
+//     ordered by the bin_has_* flags, projecting on private bin buffers reduced on the patch grid afterwards
+//   - other species (ionization, radiation, walls, ...): one task per species running the usual dynamics,
+//     serialized per patch as they project directly on the patch grid
+// The particle buffers of the tasks per bin are shared by at most 2 species per thread at a time.
+// ---------------------------------------------------------------------------------------------------------------------
+void VectorPatch::dynamicsWithTasks( Params &params,
+                            SmileiMPI *smpi,
+                            SimWindow *simWindow,
+                            RadiationTables &RadiationTables,
+                            MultiphotonBreitWheelerTables &MultiphotonBreitWheelerTables,
+                            double time_dual, Timers &/*timers*/, int /*itime*/ )
+{
+    const bool measure_load = params.has_load_balancing && params.load_balancing_mode == "measured";
+
+    #pragma omp for schedule(runtime)
+    for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+        ( *this )( ipatch )->EMfields->restartRhoJ();
+        for( unsigned int ispec=0 ; ispec<( *this )( ipatch )->vecSpecies.size() ; ispec++ ) {
+            species( ipatch, ispec )->uses_bin_tasks_ = false;
+            if( params.keep_position_old ) {
+                species( ipatch, ispec )->particles->savePositions();
+            }
+        }
+    }
+
+    SMILEI_PY_SAVE_MASTER_THREAD
+    #pragma omp single
+    {
+        // Particle buffers of the species being processed by tasks, after those of the threads:
+        // two species in flight per thread, a buffer being reused once all the bins of its species are projected
+        const int nthreads = Tools::getOMPNumThreads();
+        const int buffer_offset = nthreads;
+        const int nslots = 2 * nthreads;
+        smpi->resizeBuffers( buffer_offset + nslots );
+        std::vector<int> bins_in_slot( nslots, 0 );
+
+        for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+            Patch *patch = ( *this )( ipatch );
+
+            for( unsigned int ispec=0 ; ispec<patch->vecSpecies.size() ; ispec++ ) {
+                Species *spec = species( ipatch, ispec );
+
+                if( !( spec->isDynamic( time_dual, simWindow ) || diag_flag ) ) {
+                    continue;
+                }
+
+                if( spec->isBinTaskCompatible( time_dual, partwalls( ipatch ) ) ) {
+
+                    // Wait for a free buffer, running the pending tasks if this thread is alone
+                    int slot = -1;
+                    while( slot < 0 ) {
+                        for( int islot = 0 ; islot < nslots ; islot++ ) {
+                            int pending;
+                            #pragma omp atomic read
+                            pending = bins_in_slot[islot];
+                            if( pending == 0 ) {
+                                slot = islot;
+                                break;
+                            }
+                        }
+                        if( slot < 0 ) {
+                            if( nthreads == 1 ) {
+                                #pragma omp taskwait
+                            } else {
+                                #pragma omp taskyield
+                            }
+                        }
+                    }
+                    #pragma omp flush
+                    #pragma omp atomic write
+                    bins_in_slot[slot] = spec->Nbins;
+
+                    const int buffer_id = buffer_offset + slot;
+                    spec->uses_bin_tasks_ = true;
+                    spec->prepareBinTasks( smpi, buffer_id );
+
+                    for( unsigned int ibin=0 ; ibin<spec->Nbins ; ibin++ ) {
+                        #pragma omp task default(shared) firstprivate(patch, spec, ibin, buffer_id) depend(out:spec->bin_has_interpolated[ibin])
+                        {
+                            const double start = measure_load ? MPI_Wtime() : 0.;
+                            spec->interpolateBin( ibin, patch->EMfields, smpi, buffer_id );
+                            if( measure_load ) {
+                                #pragma omp atomic
+                                patch->measured_load_ += MPI_Wtime() - start;
+                            }
+                        }
+                        #pragma omp task default(shared) firstprivate(patch, spec, ibin, buffer_id) depend(in:spec->bin_has_interpolated[ibin]) depend(out:spec->bin_has_pushed[ibin])
+                        {
+                            const double start = measure_load ? MPI_Wtime() : 0.;
+                            spec->pushBin( ibin, smpi, buffer_id );
+                            if( measure_load ) {
+                                #pragma omp atomic
+                                patch->measured_load_ += MPI_Wtime() - start;
+                            }
+                        }
+                        #pragma omp task default(shared) firstprivate(patch, spec, ibin, buffer_id) depend(in:spec->bin_has_pushed[ibin]) depend(out:spec->bin_has_done_particles_BC[ibin])
+                        {
+                            const double start = measure_load ? MPI_Wtime() : 0.;
+                            spec->particlesBCBin( ibin, patch, smpi, buffer_id );
+                            if( measure_load ) {
+                                #pragma omp atomic
+                                patch->measured_load_ += MPI_Wtime() - start;
+                            }
+                        }
+                        #pragma omp task default(shared) firstprivate(patch, spec, ibin, buffer_id, slot) depend(in:spec->bin_has_done_particles_BC[ibin]) depend(out:spec->bin_has_projected[ibin])
+                        {
+                            const double start = measure_load ? MPI_Wtime() : 0.;
+                            spec->projectBin( ibin, smpi, buffer_id, diag_flag );
+                            if( measure_load ) {
+                                #pragma omp atomic
+                                patch->measured_load_ += MPI_Wtime() - start;
+                            }
+                            #pragma omp flush
+                            #pragma omp atomic
+                            bins_in_slot[slot]--;
+                        }
+                    }
+
+                } else {
+
+                    // The usual dynamics projects on the patch grid: one species at a time per patch
+                    #pragma omp task default(shared) firstprivate(patch, spec, ipatch, ispec) depend(inout:patch->EMfields)
+                    {
+                        const double start = measure_load ? MPI_Wtime() : 0.;
                         spec->dynamics( time_dual, ispec,
-                                        emfields( ipatch ),
+                                        patch->EMfields,
                                         params, diag_flag, partwalls( ipatch ),
-                                        ( *this )( ipatch ), smpi,
+                                        patch, smpi,
                                         RadiationTables,
                                         MultiphotonBreitWheelerTables );
-                    }
-                    // Dynamics with scalar operators
-                    else {
-                        if( params.vectorization_mode == "adaptive" ) {
-                            spec->scalarDynamics( time_dual, ispec,
-                                                   emfields( ipatch ),
-                                                   params, diag_flag, partwalls( ipatch ),
-                                                   ( *this )( ipatch ), smpi,
-                                                   RadiationTables,
-                                                   MultiphotonBreitWheelerTables );
-                        } else {
-                            spec->Species::dynamics( time_dual, ispec,
-                                                     emfields( ipatch ),
-                                                     params, diag_flag, partwalls( ipatch ),
-                                                     ( *this )( ipatch ), smpi,
-                                                     RadiationTables,
-                                                     MultiphotonBreitWheelerTables );
+                        if( measure_load ) {
+                            #pragma omp atomic
+                            patch->measured_load_ += MPI_Wtime() - start;
                         }
-                    } // end if condition on vectorization
-                } // end if condition on species
+                    }
+
+                }
             } // end loop on species
-            //MESSAGE("species dynamics");
         } // end loop on patches
+    } // end single, all tasks are completed at its implicit barrier
     SMILEI_PY_RESTORE_MASTER_THREAD
+
+    // Reduction of the bin buffers on the patch grids
+    #pragma omp for schedule(runtime)
+    for( unsigned int ipatch=0 ; ipatch<this->size() ; ipatch++ ) {
+        for( unsigned int ispec=0 ; ispec<( *this )( ipatch )->vecSpecies.size() ; ispec++ ) {
+            if( species( ipatch, ispec )->uses_bin_tasks_ ) {
+                ( *this )( ipatch )->copySpeciesBinsInLocalDensities( ispec, params.cluster_width_, params, diag_flag );
+            }
+        }
+    }
 }
 
 void VectorPatch::ponderomotiveUpdateSusceptibilityAndMomentumWithoutTasks( Params &params,
@@ -2,6 +2,7 @@
 #define VECTORPATCH_H
 
 #include <vector>
+#include <map>
 #include <iostream>
 #include <cstdlib>
 #include <iomanip>
@@ -20,6 +21,7 @@
 #include "ParticleCreator.h"
 
 class Field;
+class AggregatedExchange;
 class Timer;
 class SimWindow;
 class DomainDecomposition;
@@ -103,29 +105,6 @@ public :
         return false;
     }
 
-#  ifdef _PARTEVENTTRACING  
-    // Write Output for Particle Event Tracing diagnostic - this method must be called inside a pragma omp single construct
-    void writeParticleEventTracingOutput(Params &params, SmileiMPI *smpi, int iteration){
-        int rank(0);
-        MPI_Comm_rank( MPI_COMM_WORLD, &rank );
-        for (int ithread=0; ithread<omp_get_max_threads(); ithread++){ // write a file for eacht thread
-            std::ofstream outfile;
-            std::string namefile = "particle_event_tracing_rank_"+std::to_string(rank)+"_thread_"+std::to_string(ithread)+".txt";
-            outfile.open(namefile, std::ios_base::app); // append to file
-            outfile << "Start Iteration "<<std::to_string(iteration)<<"\n";
-            for (int event_id = 0; event_id<smpi->particle_event_tracing_event_time_[ithread].size();event_id++){
-                // Write line in file with structure Time Start/End EventName
-                outfile<<std::to_string((smpi->particle_event_tracing_event_time_[ithread][event_id]))<<" "
-                       <<(smpi->particle_event_tracing_start_or_end_[ithread][event_id])<<" "
-                       <<(smpi->particle_event_tracing_event_name_[ithread][event_id])<<" \n" ;
-            } // end loop on traced events
-        outfile << "End Iteration "<<std::to_string(iteration)<<"\n";
-        smpi->particle_event_tracing_event_time_[ithread].clear();
-        smpi->particle_event_tracing_start_or_end_[ithread].clear();
-        smpi->particle_event_tracing_event_name_[ithread].clear();
-        } // end loop on threads
-    } // end writeParticleEventTracingOutput
-#endif
     // Interfaces between main programs & main PIC operators
     // -----------------------------------------------------
     
@@ -155,12 +134,28 @@ public :
                    MultiphotonBreitWheelerTables &MultiphotonBreitWheelerTables,
                    double time_dual,
                    Timers &timers, int itime );
+
+    //! macro-particle operations as tasks per patch, species and bin (Main.dynamics_tasks)
+    void dynamicsWithTasks( Params &params,
+                   SmileiMPI *smpi,
+                   SimWindow *simWindow,
+                   RadiationTables &RadiationTables,
+                   MultiphotonBreitWheelerTables &MultiphotonBreitWheelerTables,
+                   double time_dual,
+                   Timers &timers, int itime );
     
     //! For all patches, exchange particles and sort them.
     void initExchParticles( Params &params, SmileiMPI *smpi, SimWindow *simWindow,
                                   double time_dual, Timers &timers, int itime );
     void finalizeExchParticlesAndSort( Params &params, SmileiMPI *smpi, SimWindow *simWindow,
+                                  RadiationTables &RadiationTables,
+                                  MultiphotonBreitWheelerTables &MultiphotonBreitWheelerTables,
                                   double time_dual, Timers &timers, int itime );
+    //! Subcycled species: push the patches which received particles during a subcycle, then exchange and sort again
+    void catchUpSubcycledPush( Params &params, SmileiMPI *smpi, unsigned int ispec,
+                               RadiationTables &RadiationTables,
+                               MultiphotonBreitWheelerTables &MultiphotonBreitWheelerTables,
+                               double time_dual );
     void finalizeSyncAndBCFields( Params &params, SmileiMPI *smpi, SimWindow *simWindow,
                                       double time_dual, Timers &timers, int itime );
 
@@ -246,6 +241,8 @@ public :
     
     //! Solve Poisson to initialize E
     void solvePoisson( Params &params, SmileiMPI *smpi );
+    //! Iterations of the preconditioned Poisson solvers (Main.poisson_solver = "PCG"), returns the number of iterations
+    unsigned int solvePoissonPCG( Params &params, SmileiMPI *smpi, bool relativistic, double gamma_mean, double ctrl_norm, double &ctrl );
     void runNonRelativisticPoissonModule( Params &params, SmileiMPI* smpi,  Timers &timers );
     void solvePoissonAM( Params &params, SmileiMPI *smpi);
     
@@ -450,6 +447,19 @@ public :
     //! Tells which iteration was last time the patches moved (by moving window or load balancing)
     unsigned int lastIterationPatchesMoved;
     
+    //! Set when a delayed push of a subcycled species caught up (see catchUpSubcycledPush)
+    int subcycle_catch_up_;
+    
+    //! Communicator of the aggregated field exchanges, MPI_COMM_NULL when they are not used
+    MPI_Comm aggregated_exchange_comm_;
+    //! Communicator of the single-pass particle exchanges between processes, MPI_COMM_NULL when they are not used
+    MPI_Comm particle_exchange_comm_;
+    //! Aggregated field exchanges, one per group of fields
+    std::map<std::string, AggregatedExchange *> aggregated_exchanges_;
+    //! Aggregated exchange of a group of fields, created at its first use (NULL if `Main.aggregate_exchanges` is False)
+    //! The tag of its messages is its rank of creation, identical in all processes which exchange the same groups in the same order
+    AggregatedExchange *aggregatedExchange( std::string key );
+    
     DomainDecomposition *domain_decomposition_;
     
     
@@ -526,6 +536,9 @@ private :
     double antenna_intensity_;
     
     std::vector<Timer *> diag_timers_;
+    
+    //! Timer of the pass shared by the particle binnings (also in diag_timers_), NULL without binnings
+    Timer *binnings_timer_;
 };
 
 
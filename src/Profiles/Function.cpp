@@ -1,6 +1,7 @@
 #include "Function.h"
 #include <complex>
 #include <cmath>
+#include <algorithm>
 
 using namespace std;
 
@@ -215,6 +216,331 @@ PyArrayObject *Function_Python4D::complexValueAt( std::vector<PyArrayObject *> x
 
 #endif
 
+// Python functions compiled into elementary operations
+static const char *compiled_operator_names[Function_Compiled::N_OPERATORS] = {
+    "arg", "const", "add", "sub", "mul", "div", "pow", "mod", "neg", "abs", "exp", "log", "log10", "sqrt",
+    "sin", "cos", "tan", "asin", "acos", "atan", "atan2", "hypot", "sinh", "cosh", "tanh", "floor", "ceil", "erf",
+    "min", "max", "lt", "le", "gt", "ge", "eq", "ne", "and", "or", "not", "where"
+};
+
+Function_Compiled *Function_Compiled::compile( PyObject *py_profile, unsigned int nvariables )
+{
+    // The operations are recorded by _compileProfile (see pyprofiles.py)
+    PyObject *compiler = PyObject_GetAttrString( PyImport_AddModule( "__main__" ), "_compileProfile" );
+    if( ! compiler ) {
+        PyTools::checkPyError( false, false );
+        return NULL;
+    }
+    PyObject *py_program = PyObject_CallFunction( compiler, const_cast<char *>( "OI" ), py_profile, nvariables );
+    Py_DECREF( compiler );
+    PyTools::checkPyError( false, false );
+    if( ! py_program || py_program == Py_None ) {
+        Py_XDECREF( py_program );
+        return NULL;
+    }
+    vector<string> names;
+    vector<double> values;
+    vector<unsigned int> operands;
+    bool ok = PyTuple_Check( py_program ) && PyTuple_Size( py_program ) == 3
+              && PyTools::py2vector( PyTuple_GetItem( py_program, 0 ), names )
+              && PyTools::py2vector( PyTuple_GetItem( py_program, 1 ), values )
+              && PyTools::py2vector( PyTuple_GetItem( py_program, 2 ), operands );
+    Py_DECREF( py_program );
+    if( ! ok || names.size() == 0 || values.size() != names.size() || operands.size() != 3*names.size() ) {
+        return NULL;
+    }
+
+    vector<Operation> program( names.size() );
+    for( unsigned int i=0; i<names.size(); i++ ) {
+        unsigned int op = 0;
+        while( op < N_OPERATORS && names[i] != compiled_operator_names[op] ) {
+            op++;
+        }
+        if( op == N_OPERATORS || ( op == ARG && values[i] >= nvariables ) ) {
+            return NULL;
+        }
+        program[i].op = op;
+        program[i].value = values[i];
+        program[i].a = operands[3*i  ];
+        program[i].b = operands[3*i+1];
+        program[i].c = operands[3*i+2];
+        // Operations only use previous results
+        if( ( i > 0 && max( program[i].a, max( program[i].b, program[i].c ) ) >= i )
+            || ( i == 0 && op != ARG && op != CONST ) ) {
+            return NULL;
+        }
+    }
+    Function_Compiled *f = new Function_Compiled( program, nvariables );
+
+    // Check the compiled function against python at a few points
+    vector<double> x( nvariables );
+    for( unsigned int ipoint=0; ipoint<2; ipoint++ ) {
+        PyObject *py_args = PyTuple_New( nvariables );
+        for( unsigned int i=0; i<nvariables; i++ ) {
+            x[i] = ipoint * 0.37 * ( i+1 );
+            PyTuple_SetItem( py_args, i, PyFloat_FromDouble( x[i] ) );
+        }
+        PyObject *py_value = PyObject_CallObject( py_profile, py_args );
+        Py_DECREF( py_args );
+        double expected;
+        // Points where python fails cannot be checked
+        if( PyTools::checkPyError( false, false ) || ! PyTools::py2scalar( py_value, expected ) ) {
+            Py_XDECREF( py_value );
+            PyTools::checkPyError( false, false );
+            continue;
+        }
+        Py_DECREF( py_value );
+        double value = f->valueAt( x );
+        bool same = ( std::isnan( value ) && std::isnan( expected ) ) || value == expected
+                    || abs( value - expected ) <= 1e-12 * max( abs( value ), abs( expected ) );
+        if( ! same ) {
+            delete f;
+            return NULL;
+        }
+    }
+    return f;
+}
+
+double Function_Compiled::valueAt( double time )
+{
+    const double *args[4] = { &time, &time, &time, &time };
+    const unsigned int strides[4] = { 0, 0, 0, 0 };
+    double v;
+    valuesAt( args, strides, 1, &v, false );
+    return v;
+}
+double Function_Compiled::valueAt( vector<double> x_cell, double time )
+{
+    // The time is the last argument
+    const double *args[4];
+    const unsigned int strides[4] = { 0, 0, 0, 0 };
+    for( unsigned int i=0; i+1<nvariables_; i++ ) {
+        args[i] = &x_cell[i];
+    }
+    args[nvariables_-1] = &time;
+    double v;
+    valuesAt( args, strides, 1, &v, false );
+    return v;
+}
+double Function_Compiled::valueAt( vector<double> x_cell )
+{
+    const double *args[4];
+    const unsigned int strides[4] = { 0, 0, 0, 0 };
+    for( unsigned int i=0; i<nvariables_; i++ ) {
+        args[i] = &x_cell[i];
+    }
+    double v;
+    valuesAt( args, strides, 1, &v, false );
+    return v;
+}
+
+void Function_Compiled::valuesAt( const double *const *args, const unsigned int *strides, unsigned int n, double *ret, bool add )
+{
+    if( n == 0 ) {
+        return;
+    }
+    const unsigned int block = min( n, block_size_ );
+    const unsigned int nop = program_.size();
+    // Results of all operations for one block of points
+    vector<double> results( nop * block );
+    for( unsigned int iop=0; iop<nop; iop++ ) {
+        if( program_[iop].op == CONST ) {
+            fill( &results[iop*block], &results[iop*block] + block, program_[iop].value );
+        }
+    }
+
+    for( unsigned int start=0; start<n; start+=block ) {
+        const unsigned int m = min( block, n-start );
+        for( unsigned int iop=0; iop<nop; iop++ ) {
+            const Operation &o = program_[iop];
+            double *__restrict__ r = &results[iop*block];
+            const double *__restrict__ a = &results[o.a*block];
+            const double *__restrict__ b = &results[o.b*block];
+            const double *__restrict__ c = &results[o.c*block];
+            switch( o.op ) {
+                case ARG: {
+                    const unsigned int iarg = ( unsigned int ) o.value;
+                    const double *x = args[iarg] + start*strides[iarg];
+                    const unsigned int s = strides[iarg];
+                    for( unsigned int i=0; i<m; i++ ) {
+                        r[i] = x[i*s];
+                    }
+                    break;
+                }
+                case CONST:
+                    break;
+                case ADD:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = a[i] + b[i]; }
+                    break;
+                case SUB:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = a[i] - b[i]; }
+                    break;
+                case MUL:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = a[i] * b[i]; }
+                    break;
+                case DIV:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = a[i] / b[i]; }
+                    break;
+                case POW:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = pow( a[i], b[i] ); }
+                    break;
+                case MOD:
+                    // Same sign as the divisor, as in python
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) {
+                        double v = fmod( a[i], b[i] );
+                        r[i] = ( v != 0. && ( v < 0. ) != ( b[i] < 0. ) ) ? v + b[i] : v;
+                    }
+                    break;
+                case NEG:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = -a[i]; }
+                    break;
+                case ABS:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = fabs( a[i] ); }
+                    break;
+                case EXP:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = exp( a[i] ); }
+                    break;
+                case LOG:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = log( a[i] ); }
+                    break;
+                case LOG10:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = log10( a[i] ); }
+                    break;
+                case SQRT:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = sqrt( a[i] ); }
+                    break;
+                case SIN:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = sin( a[i] ); }
+                    break;
+                case COS:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = cos( a[i] ); }
+                    break;
+                case TAN:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = tan( a[i] ); }
+                    break;
+                case ASIN:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = asin( a[i] ); }
+                    break;
+                case ACOS:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = acos( a[i] ); }
+                    break;
+                case ATAN:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = atan( a[i] ); }
+                    break;
+                case ATAN2:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = atan2( a[i], b[i] ); }
+                    break;
+                case HYPOT:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = hypot( a[i], b[i] ); }
+                    break;
+                case SINH:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = sinh( a[i] ); }
+                    break;
+                case COSH:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = cosh( a[i] ); }
+                    break;
+                case TANH:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = tanh( a[i] ); }
+                    break;
+                case FLOOR:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = floor( a[i] ); }
+                    break;
+                case CEIL:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = ceil( a[i] ); }
+                    break;
+                case ERF:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = erf( a[i] ); }
+                    break;
+                case MIN:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = b[i] < a[i] ? b[i] : a[i]; }
+                    break;
+                case MAX:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = b[i] > a[i] ? b[i] : a[i]; }
+                    break;
+                case LT:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = a[i] < b[i] ? 1. : 0.; }
+                    break;
+                case LE:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = a[i] <= b[i] ? 1. : 0.; }
+                    break;
+                case GT:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = a[i] > b[i] ? 1. : 0.; }
+                    break;
+                case GE:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = a[i] >= b[i] ? 1. : 0.; }
+                    break;
+                case EQ:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = a[i] == b[i] ? 1. : 0.; }
+                    break;
+                case NE:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = a[i] != b[i] ? 1. : 0.; }
+                    break;
+                case AND:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = ( a[i] != 0. && b[i] != 0. ) ? 1. : 0.; }
+                    break;
+                case OR:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = ( a[i] != 0. || b[i] != 0. ) ? 1. : 0.; }
+                    break;
+                case NOT:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = a[i] == 0. ? 1. : 0.; }
+                    break;
+                case WHERE:
+                    #pragma omp simd
+                    for( unsigned int i=0; i<m; i++ ) { r[i] = a[i] != 0. ? b[i] : c[i]; }
+                    break;
+            }
+        }
+        // The result is the last operation
+        const double *r = &results[( nop-1 )*block];
+        if( add ) {
+            for( unsigned int i=0; i<m; i++ ) {
+                ret[start+i] += r[i];
+            }
+        } else {
+            for( unsigned int i=0; i<m; i++ ) {
+                ret[start+i] = r[i];
+            }
+        }
+    }
+}
+
 // Profiles from file
 double Function_File::valueAt( vector<double> x_cell )
 {
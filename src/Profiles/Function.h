@@ -162,6 +162,61 @@ private:
     PyObject *py_profile;
 };
 
+// Child class for python functions compiled into elementary operations (see pyprofiles.py),
+// evaluated on blocks of points without python
+
+class Function_Compiled : public Function
+{
+public:
+    //! Elementary operators
+    enum Operator { ARG, CONST, ADD, SUB, MUL, DIV, POW, MOD, NEG, ABS, EXP, LOG, LOG10, SQRT,
+                    SIN, COS, TAN, ASIN, ACOS, ATAN, ATAN2, HYPOT, SINH, COSH, TANH, FLOOR, CEIL, ERF,
+                    MIN, MAX, LT, LE, GT, GE, EQ, NE, AND, OR, NOT, WHERE, N_OPERATORS };
+
+    //! One operation: its result is the operator applied to the results of previous operations.
+    //! For ARG, value is the index of the argument. For CONST, value is the constant.
+    struct Operation {
+        unsigned int op;
+        double value;
+        unsigned int a, b, c;
+    };
+
+    Function_Compiled( std::vector<Operation> program, unsigned int nvariables ) : program_( program ), nvariables_( nvariables ) {};
+    Function_Compiled( Function_Compiled *f ) : program_( f->program_ ), nvariables_( f->nvariables_ ) {};
+
+    //! Compile a python function of nvariables arguments. Returns NULL if it cannot be compiled.
+    static Function_Compiled *compile( PyObject *py_profile, unsigned int nvariables );
+
+    double valueAt( double ); // time
+    double valueAt( std::vector<double>, double ); // space + time
+    double valueAt( std::vector<double> ); // space
+    std::complex<double> complexValueAt( std::vector<double> x, double t )
+    {
+        return valueAt( x, t );
+    };
+    std::complex<double> complexValueAt( std::vector<double> x )
+    {
+        return valueAt( x );
+    };
+
+    //! Values at n points: args[i] points to the values of the argument i, which
+    //! are contiguous (stride 1) or the same for all points (stride 0)
+    void valuesAt( const double *const *args, const unsigned int *strides, unsigned int n, double *ret, bool add );
+
+    //! Number of operations
+    unsigned int size()
+    {
+        return program_.size();
+    };
+
+private:
+    std::vector<Operation> program_;
+    unsigned int nvariables_;
+
+    //! Number of points evaluated together
+    static const unsigned int block_size_ = 64;
+};
+
 class Function_File : public Function
 {
 public:
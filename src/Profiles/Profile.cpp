@@ -12,6 +12,7 @@ Profile::Profile( PyObject *py_profile, unsigned int nvariables, string name, Pa
     profileName_( "" ),
     nvariables_( nvariables ),
     uses_numpy_( false ),
+    uses_compiled_( false ),
     uses_file_( false ),
     filename_( "" )
 {
@@ -195,9 +196,19 @@ Profile::Profile( PyObject *py_profile, unsigned int nvariables, string name, Pa
         }
         
         
+        // Try to compile the profile, so that it is evaluated without python
+        Function_Compiled *compiled = NULL;
+        if( params.compile_profiles ) {
+            compiled = Function_Compiled::compile( py_profile, nvariables_ );
+        }
+        if( compiled ) {
+            DEBUG( "Profile `"<<name<<"`: compiled into " << compiled->size() << " operations" );
+            uses_compiled_ = true;
+        }
+        
         // Verify that the profile transforms a float in a float
 #ifdef SMILEI_USE_NUMPY
-        if( try_numpy ) {
+        if( try_numpy && ! uses_compiled_ ) {
             // If numpy available, verify that the profile accepts numpy arguments
             // We test 2 options : the arrays dimension equal to nvariables or nvariables-1
             unsigned int ndim;
@@ -250,7 +261,7 @@ Profile::Profile( PyObject *py_profile, unsigned int nvariables, string name, Pa
             }
         }
 #endif
-        if( !uses_numpy_ ) {
+        if( !uses_numpy_ && !uses_compiled_ ) {
             // Otherwise, try a float
             PyObject *z = PyFloat_FromDouble( 0. );
             PyObject *ret( nullptr );
@@ -274,7 +285,9 @@ Profile::Profile( PyObject *py_profile, unsigned int nvariables, string name, Pa
         }
         
         // Assign the evaluating function, which depends on the number of arguments
-        if( nvariables_ == 1 ) {
+        if( uses_compiled_ ) {
+            function_ = compiled;
+        } else if( nvariables_ == 1 ) {
             function_ = new Function_Python1D( py_profile );
         } else if( nvariables_  == 2 ) {
             function_ = new Function_Python2D( py_profile );
@@ -319,6 +332,7 @@ Profile::Profile( Profile *p )
     profileName_ = p->profileName_;
     nvariables_ = p->nvariables_;
     uses_numpy_  = p->uses_numpy_ ;
+    uses_compiled_ = p->uses_compiled_;
     uses_file_ = p->uses_file_;
     filename_ = p->filename_;
     
@@ -388,6 +402,8 @@ Profile::Profile( Profile *p )
         }
     } else if( uses_file_ ) {
         function_ = new Function_File( static_cast<Function_File *>( p->function_ ) );
+    } else if( uses_compiled_ ) {
+        function_ = new Function_Compiled( static_cast<Function_Compiled *>( p->function_ ) );
     } else {
         if( nvariables_ == 1 ) {
             function_ = new Function_Python1D( static_cast<Function_Python1D *>( p->function_ ) );
@@ -474,39 +490,51 @@ void Profile::valuesAt( std::vector<Field *> &coordinates, std::vector<double> g
             }
         }
     
+    // Otherwise, calculate profile for each point
+    } else {
+        std::vector<double *> x( nvar );
+        for( unsigned int ivar=0; ivar<nvar; ivar++ ) {
+            x[ivar] = coordinates[ivar]->data();
+        }
+        valuesAt( x, size, ret.data(), mode, time );
+    }
+}
+
+//! Get/add the value of the profile at n locations given by one array per coordinate
+void Profile::valuesAt( std::vector<double *> coordinates, unsigned int n, double *ret, int mode, double time )
+{
+    unsigned int nvar = coordinates.size();
+    if( mode < 0 || mode > 3 ) {
+        ERROR("valuesAt : wrong mode "<<mode);
+    }
+    
+    // Compiled profile: all points at once, the time being the last argument
+    if( uses_compiled_ ) {
+        std::vector<const double *> args( nvariables_ );
+        std::vector<unsigned int> strides( nvariables_, 1 );
+        unsigned int nspace = ( mode & 0b10 ) ? nvariables_ - 1 : nvariables_;
+        for( unsigned int ivar=0; ivar<nspace; ivar++ ) {
+            args[ivar] = coordinates[ivar];
+        }
+        if( mode & 0b10 ) {
+            args[nspace] = &time;
+            strides[nspace] = 0;
+        }
+        static_cast<Function_Compiled *>( function_ )->valuesAt( &args[0], &strides[0], n, ret, mode & 0b01 );
+    
     // Otherwise, calculate profile for each point
     } else {
         std::vector<double> x( nvar );
-        if( mode == 0 ) {
-            for( unsigned int i=0; i<size; i++ ) {
-                for( unsigned int ivar=0; ivar<nvar; ivar++ ) {
-                    x[ivar]=( *coordinates[ivar] )( i );
-                }
-                ret( i ) = function_->valueAt( x );
-            }
-        } else if( mode == 1 ) {
-            for( unsigned int i=0; i<size; i++ ) {
-                for( unsigned int ivar=0; ivar<nvar; ivar++ ) {
-                    x[ivar]=( *coordinates[ivar] )( i );
-                }
-                ret( i ) += function_->valueAt( x );
-            }
-        } else if( mode == 2 ) {
-            for( unsigned int i=0; i<size; i++ ) {
-                for( unsigned int ivar=0; ivar<nvar; ivar++ ) {
-                    x[ivar]=( *coordinates[ivar] )( i );
-                }
-                ret( i ) = function_->valueAt( x, time );
+        for( unsigned int i=0; i<n; i++ ) {
+            for( unsigned int ivar=0; ivar<nvar; ivar++ ) {
+                x[ivar] = coordinates[ivar][i];
             }
-        } else if( mode == 3 ) {
-            for( unsigned int i=0; i<size; i++ ) {
-                for( unsigned int ivar=0; ivar<nvar; ivar++ ) {
-                    x[ivar]=( *coordinates[ivar] )( i );
-                }
-                ret( i ) += function_->valueAt( x, time );
+            double v = ( mode & 0b10 ) ? function_->valueAt( x, time ) : function_->valueAt( x );
+            if( mode & 0b01 ) {
+                ret[i] += v;
+            } else {
+                ret[i] = v;
             }
-        } else {
-            ERROR("valuesAt : wrong mode "<<mode);
         }
     }
 }
@@ -60,6 +60,10 @@ public:
     //! mode = 3 : ADD values at given time
     void complexValuesAt( std::vector<Field *> &coordinates, cField &ret, int mode = 0, double time = 0. );
     
+    //! Get/add the value of the profile at n locations given by one array per coordinate
+    //! (same modes as above)
+    void valuesAt( std::vector<double *> coordinates, unsigned int n, double *ret, int mode = 0, double time = 0. );
+    
     //! Get the complex value of the profile at several locations (spatial + times)
     void complexValuesAtTimes( std::vector<Field *> &coordinates, Field *time, cField &ret );
     
@@ -75,7 +79,9 @@ public:
             info << " from file `" << filename_ << "`";
         } else {
             info << " user-defined function";
-            if( uses_numpy_ ) {
+            if( uses_compiled_ ) {
+                info << " (compiled)";
+            } else if( uses_numpy_ ) {
                 info << " (uses numpy)";
             }
         }
@@ -87,6 +93,12 @@ public:
         return info.str();
     };
 
+    //! Whether each evaluation of the profile calls the python interpreter
+    bool callsPython()
+    {
+        return profileName_.empty() && ! uses_file_ && ! uses_compiled_;
+    }
+    
     //! Get profile name
     std::string getProfileName()
     {
@@ -107,6 +119,9 @@ private:
     //! Whether the profile is using numpy
     bool uses_numpy_;
     
+    //! Whether the profile is a python function compiled into elementary operations
+    bool uses_compiled_;
+    
     //! Whether the profile is taken from a file
     bool uses_file_;
     std::string filename_;
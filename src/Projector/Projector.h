@@ -43,6 +43,13 @@ public:
     //!Wrapper
     virtual void currentsAndDensityWrapper( ElectroMagn *, Particles &, SmileiMPI *, int, int, int, bool, bool, int, int = 0, int = 0 ) = 0;
 
+    //! Wrapper projecting the particles istart to iend of a single bin on its own buffers (tasks per bin),
+    //! bin_shift being the first primal index of the bin along x
+    virtual void currentsAndDensityWrapperOnBuffers( double *, double *, double *, double *, int, Particles &, SmileiMPI *, int, int, int, bool )
+    {
+        ERROR( "Tasks per bin are not implemented with this geometry and this order" );
+    };
+
     virtual void susceptibility( ElectroMagn *, Particles &, double , SmileiMPI *, int, int, int, int = 0, int = 0 )
     {
         ERROR( "Envelope not implemented with this geometry and this order" );
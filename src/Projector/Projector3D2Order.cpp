@@ -765,6 +765,24 @@ void Projector3D2Order::currentsAndDensityWrapper( ElectroMagn *EMfields, Partic
     
 } // end wrapper for currents and density
 
+// Wrapper for the projection of a single bin on its own buffers (tasks per bin)
+void Projector3D2Order::currentsAndDensityWrapperOnBuffers( double *b_Jx, double *b_Jy, double *b_Jz, double *b_rho, int bin_shift, Particles &particles, SmileiMPI *smpi, int istart, int iend, int buffer_id, bool diag_flag )
+{
+    std::vector<int> *iold = &( smpi->dynamics_iold[buffer_id] );
+    std::vector<double> *delta = &( smpi->dynamics_deltaold[buffer_id] );
+    std::vector<double> *invgf = &( smpi->dynamics_invgf[buffer_id] );
+    
+    if( !diag_flag ) {
+        for( int ipart=istart ; ipart<iend; ipart++ ) {
+            currents( b_Jx, b_Jy, b_Jz, particles,  ipart, ( *invgf )[ipart], &( *iold )[ipart], &( *delta )[ipart], bin_shift );
+        }
+    } else {
+        for( int ipart=istart ; ipart<iend; ipart++ ) {
+            currentsAndDensity( b_Jx, b_Jy, b_Jz, b_rho, particles,  ipart, ( *invgf )[ipart], &( *iold )[ipart], &( *delta )[ipart], bin_shift );
+        }
+    }
+}
+
 // Projector for susceptibility used as source term in envelope equation
 void Projector3D2Order::susceptibility( ElectroMagn *EMfields, Particles &particles, double species_mass, SmileiMPI *smpi, int istart, int iend,  int ithread, int /*icell*/, int /*ipart_ref*/ )
 
@@ -21,6 +21,14 @@ public:
     //! Overloading of () operator
     virtual void operator()( Particles &particles, SmileiMPI *smpi, int istart, int iend, int ithread, int ipart_buffer_offset = 0 ) = 0;
     
+    //! Change the timestep of the push (subcycled species)
+    void setTimestep( double timestep )
+    {
+        dt   = timestep;
+        dts2 = timestep/2.;
+        dts4 = timestep/4.;
+    }
+    
 protected:
     double dt, dts2, dts4;
     //! \todo Move mass_ in Particles_
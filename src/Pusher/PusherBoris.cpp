@@ -34,7 +34,7 @@ void PusherBoris::operator()( Particles &particles, SmileiMPI *smpi, int istart,
 
     double *const __restrict__ invgf = &( smpi->dynamics_invgf[ithread][0] );
 
-    const int nparts = particles.last_index.back(); // particles.size()
+    const int nparts = smpi->getBufferSize(ithread);
 
     const double *const __restrict__ Ex = &( ( smpi->dynamics_Epart[ithread] )[0*nparts] );
     const double *const __restrict__ Ey = &( ( smpi->dynamics_Epart[ithread] )[1*nparts] );
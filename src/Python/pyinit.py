@@ -178,6 +178,13 @@ class Main(SmileiSingleton):
     timestep_over_CFL = None
     cell_sorting = None
     gpu_computing = False                      # Activate the computation on GPU
+    dynamics_tasks = False                     # Particle dynamics as tasks per bin
+    single_pass_particle_exchange = False      # Particles sent directly to their final patch, diagonals included
+    aggregate_exchanges = False                # One persistent message per MPI neighbor for field exchanges
+    overlap_field_exchange = False             # Exchange B while the Faraday solver updates the patch interiors
+    solver_tile_size = 0                       # Tiles of the Yee solvers (0 for the whole patch)
+    field_memory_pool = 0.                     # MB of field arrays kept for reuse by new patches
+    dynamics_chunk_size = 0                    # Particles per chunk of cells in the vectorized dynamics (0 for the whole patch)
     
     # PXR tuning
     spectral_solver_order = []
@@ -187,6 +194,7 @@ class Main(SmileiSingleton):
     solve_poisson = True
     poisson_max_iteration = 50000
     poisson_max_error = 1.e-14
+    poisson_solver = "CG"
 
     # Relativistic Poisson tuning
     solve_relativistic_poisson = False
@@ -221,6 +229,7 @@ class Main(SmileiSingleton):
     reference_angular_frequency_SI = 0.
     print_every = None
     random_seed = None
+    compile_profiles = True
     print_expected_disk_usage = True
 
     terminal_mode = True
@@ -331,6 +340,8 @@ class LoadBalancing(SmileiSingleton):
     initial_balance      = True
     cell_load            = 1.0
     frozen_particle_load = 0.1
+    mode                 = "particles"
+    smoothing            = 0.5
 
 class MultipleDecomposition(SmileiSingleton):
     """Multiple Decomposition parameters"""
@@ -344,6 +355,8 @@ class Vectorization(SmileiSingleton):
     mode                = "off"
     reconfigure_every   = 20
     initial_mode        = "off"
+    calibration         = False
+    calibration_file    = "vectorization_calibration.txt"
 
 
 class MovingWindow(SmileiSingleton):
@@ -367,12 +380,15 @@ class Checkpoints(SmileiSingleton):
     exit_after_dump = True
     file_grouping = 0
     restart_files = []
+    asynchronous = False
+    max_staging_memory = 0.
 
 class CurrentFilter(SmileiSingleton):
     """Current filtering parameters"""
     model = "binomial"
     passes = [0]
     kernelFIR = [0.25,0.5,0.25]
+    single_exchange = False
 
 class FieldFilter(SmileiSingleton):
     """Fields filtering parameters"""
@@ -422,6 +438,7 @@ class Species(SmileiComponent):
     merge_min_momentum = 1e-5
 
     time_frozen = 0.0
+    subcycling = 1
     radiating = False
     relativistic_field_initialization = False
     boundary_conditions = [["periodic"]]
@@ -432,6 +449,7 @@ class Species(SmileiComponent):
     atomic_number = None
     maximum_charge_state = 0
     ionization_tl_parameter = 6
+    ionization_tolerance = 0.
     is_test = False
     relativistic_field_initialization = False
     keep_interpolated_fields = []
@@ -463,6 +481,7 @@ class Laser(SmileiComponent):
     delay_phase = [0., 0.]
     space_time_profile = None
     space_time_profile_AM = None
+    time_envelope_samples = 8
     file = None
     _offset = None
 
@@ -514,6 +533,7 @@ class DiagProbe(SmileiComponent):
     flush_every = 1
     time_integral = False
     datatype = "double"
+    asynchronous = False
 
 class DiagParticleBinning(SmileiComponent):
     """Particle Binning diagnostic"""
@@ -564,6 +584,7 @@ class DiagFields(SmileiComponent):
     subgrid = None
     flush_every = 1
     datatype = "double"
+    asynchronous = False
 
 class DiagTrackParticles(SmileiComponent):
     """Track diagnostic"""
@@ -573,6 +594,7 @@ class DiagTrackParticles(SmileiComponent):
     flush_every = 1
     filter = None
     attributes = ["x", "y", "z", "px", "py", "pz", "w"]
+    asynchronous = False
 
 class DiagNewParticles(SmileiComponent):
     """Track diagnostic"""
@@ -588,6 +610,7 @@ class DiagPerformances(SmileiSingleton):
     every = 0
     flush_every = 1
     patch_information = True
+    patch_timers = False
 
 # external fields
 class ExternalField(SmileiComponent):
@@ -812,3 +812,175 @@ except:
         )
         print("WARNING: LaserOffset unavailable because numpy was not found")
 
+
+
+# Compilation of python profiles into elementary operations, evaluated by Smilei
+# on many points at once without calling python (see Function_Compiled).
+# The profile is called once with arguments that record the operations made with them.
+# Any unsupported construct (conditions, loops over values, unknown functions) raises
+# an exception and the profile is left to python.
+import numbers as _numbers, types as _types
+
+class _ProfileTracer(object):
+    __array_priority__ = 1000
+    __hash__ = None
+    def __init__(self, program, op, value=0., operands=()):
+        self._program = program
+        self._index = len(program)
+        program.append( (op, float(value), [o._index for o in operands]) )
+    def __add__     (self, o): return _traceOperation("add", self, o)
+    def __radd__    (self, o): return _traceOperation("add", o, self)
+    def __sub__     (self, o): return _traceOperation("sub", self, o)
+    def __rsub__    (self, o): return _traceOperation("sub", o, self)
+    def __mul__     (self, o): return _traceOperation("mul", self, o)
+    def __rmul__    (self, o): return _traceOperation("mul", o, self)
+    def __truediv__ (self, o): return _traceOperation("div", self, o)
+    def __rtruediv__(self, o): return _traceOperation("div", o, self)
+    __div__, __rdiv__ = __truediv__, __rtruediv__
+    def __pow__     (self, o): return _traceOperation("pow", self, o)
+    def __rpow__    (self, o): return _traceOperation("pow", o, self)
+    def __mod__     (self, o): return _traceOperation("mod", self, o)
+    def __rmod__    (self, o): return _traceOperation("mod", o, self)
+    def __and__     (self, o): return _traceOperation("and", self, o)
+    def __rand__    (self, o): return _traceOperation("and", o, self)
+    def __or__      (self, o): return _traceOperation("or", self, o)
+    def __ror__     (self, o): return _traceOperation("or", o, self)
+    def __lt__      (self, o): return _traceOperation("lt", self, o)
+    def __le__      (self, o): return _traceOperation("le", self, o)
+    def __gt__      (self, o): return _traceOperation("gt", self, o)
+    def __ge__      (self, o): return _traceOperation("ge", self, o)
+    def __eq__      (self, o): return _traceOperation("eq", self, o)
+    def __ne__      (self, o): return _traceOperation("ne", self, o)
+    def __neg__     (self): return _traceOperation("neg", self)
+    def __pos__     (self): return self
+    def __abs__     (self): return _traceOperation("abs", self)
+    def _unsupported(self, *args):
+        raise TypeError("the value of a compiled profile argument is unknown")
+    __bool__ = __nonzero__ = __float__ = __int__ = __index__ = __complex__ = _unsupported
+    # numpy functions
+    def __array_ufunc__(self, ufunc, method, *inputs, **kwargs):
+        if method != "__call__" or kwargs or ufunc.__name__ not in _profile_ufuncs:
+            raise TypeError("unsupported numpy operation "+ufunc.__name__)
+        return _profile_ufuncs[ufunc.__name__](*inputs)
+    def __array_function__(self, func, types, args, kwargs):
+        if func.__name__ == "where" and len(args) == 3 and not kwargs:
+            return _traceOperation("where", *args)
+        if func.__name__ == "clip" and len(args) == 3 and not kwargs:
+            return _traceOperation("min", _traceOperation("max", args[0], args[1]), args[2])
+        raise TypeError("unsupported numpy function "+func.__name__)
+
+def _traceOperation(op, *operands):
+    program = [o._program for o in operands if isinstance(o, _ProfileTracer)][0]
+    traced = []
+    for o in operands:
+        if not isinstance(o, _ProfileTracer):
+            if not isinstance(o, _numbers.Real):
+                raise TypeError("unsupported value "+repr(o))
+            o = _ProfileTracer(program, "const", o)
+        traced += [o]
+    return _ProfileTracer(program, op, 0., traced)
+
+def _traceFunction(op, nargs=1):
+    def f(*args):
+        if len(args) != nargs:
+            raise TypeError(op+" requires "+str(nargs)+" arguments")
+        return _traceOperation(op, *args)
+    return f
+
+_profile_ufuncs = dict(
+    add=_traceFunction("add",2), subtract=_traceFunction("sub",2), multiply=_traceFunction("mul",2),
+    divide=_traceFunction("div",2), true_divide=_traceFunction("div",2), power=_traceFunction("pow",2),
+    float_power=_traceFunction("pow",2), remainder=_traceFunction("mod",2), negative=_traceFunction("neg"),
+    positive=lambda a:a, absolute=_traceFunction("abs"), fabs=_traceFunction("abs"), square=lambda a:a*a,
+    exp=_traceFunction("exp"), log=_traceFunction("log"), log10=_traceFunction("log10"), sqrt=_traceFunction("sqrt"),
+    sin=_traceFunction("sin"), cos=_traceFunction("cos"), tan=_traceFunction("tan"),
+    arcsin=_traceFunction("asin"), arccos=_traceFunction("acos"), arctan=_traceFunction("atan"),
+    arctan2=_traceFunction("atan2",2), hypot=_traceFunction("hypot",2),
+    sinh=_traceFunction("sinh"), cosh=_traceFunction("cosh"), tanh=_traceFunction("tanh"),
+    floor=_traceFunction("floor"), ceil=_traceFunction("ceil"),
+    minimum=_traceFunction("min",2), maximum=_traceFunction("max",2),
+    less=_traceFunction("lt",2), less_equal=_traceFunction("le",2), greater=_traceFunction("gt",2),
+    greater_equal=_traceFunction("ge",2), equal=_traceFunction("eq",2), not_equal=_traceFunction("ne",2),
+    logical_and=_traceFunction("and",2), logical_or=_traceFunction("or",2), logical_not=_traceFunction("not"),
+)
+
+# Replacements of the functions of the math module, which only trace when given traced arguments
+def _tracingMathFunction(original, trace):
+    def f(*args):
+        if any(isinstance(a, _ProfileTracer) for a in args):
+            return trace(*args)
+        return original(*args)
+    return f
+_profile_math = _types.ModuleType("math")
+_profile_math.__dict__.update(math.__dict__)
+for _name, _trace in dict(
+        exp="exp", log10="log10", sqrt="sqrt", sin="sin", cos="cos", tan="tan", asin="asin", acos="acos",
+        atan="atan", sinh="sinh", cosh="cosh", tanh="tanh", fabs="abs", floor="floor", ceil="ceil", erf="erf"
+        ).items():
+    setattr(_profile_math, _name, _tracingMathFunction(getattr(math, _name), _traceFunction(_trace)))
+for _name in ["atan2", "hypot", "pow"]:
+    setattr(_profile_math, _name, _tracingMathFunction(getattr(math, _name), _traceFunction(_name,2)))
+_profile_math.log = _tracingMathFunction(math.log,
+    lambda x, base=None: _traceOperation("log", x) if base is None else _profile_math.log(x)/_profile_math.log(base))
+_profile_math_functions = dict( (id(getattr(math, _name)), getattr(_profile_math, _name)) for _name in dir(math) )
+del _name, _trace
+
+def _tracingObject(obj, namespaces):
+    # The math module and its functions are replaced by the tracing versions
+    if obj is math:
+        return _profile_math
+    if id(obj) in _profile_math_functions:
+        return _profile_math_functions[id(obj)]
+    # Other python functions are replaced, when called, by copies that use the tracing versions
+    if isinstance(obj, _types.FunctionType):
+        return lambda *a, **k: _tracingCopy(obj, namespaces)(*a, **k)
+    return obj
+
+def _tracingCopy(f, namespaces):
+    # Copy of the global variables of the function (once per module)
+    g = namespaces.get(id(f.__globals__))
+    if g is None:
+        g = namespaces[id(f.__globals__)] = {}
+        g.update( (k, _tracingObject(v, namespaces)) for k, v in f.__globals__.items() )
+    # Copy of the variables captured by the function
+    closure = None
+    if f.__closure__:
+        closure = []
+        for cell in f.__closure__:
+            try:
+                closure += [ (lambda v: lambda: v)(_tracingObject(cell.cell_contents, namespaces)).__closure__[0] ]
+            except ValueError:
+                closure += [ cell ]
+        closure = tuple(closure)
+    return _types.FunctionType(f.__code__, g, f.__name__, f.__defaults__, closure)
+
+def _compileProfile(f, nvariables):
+    """Returns the operations made by the profile `f` as three lists (names, values and
+    operands), or None if it cannot be compiled"""
+    try:
+        program = []
+        args = [_ProfileTracer(program, "arg", i) for i in range(nvariables)]
+        result = _tracingCopy(f, {})(*args)
+        if not isinstance(result, _ProfileTracer):
+            if not isinstance(result, _numbers.Real):
+                return None
+            result = _ProfileTracer(program, "const", result)
+    except Exception:
+        return None
+    # Keep only the operations needed by the result, which becomes the last one
+    needed = [False]*len(program)
+    needed[result._index] = True
+    for i in range(result._index, -1, -1):
+        if needed[i]:
+            for o in program[i][2]:
+                needed[o] = True
+    new_index = {}
+    names, values, operands = [], [], []
+    for i in range(result._index+1):
+        if needed[i]:
+            new_index[i] = len(names)
+            op, value, ops = program[i]
+            names += [op]
+            values += [value]
+            operands += ([new_index[o] for o in ops] + [0,0,0])[:3]
+    return names, values, operands
@@ -34,6 +34,7 @@ Radiation::Radiation( Params &params, Species *species, Random * rand )
 
     // Pointer to the local patch random generator
     rand_ = rand;
+    random_stream_ = Random::stream( Random::radiation_process, species->species_number_ );
     
     // Dimension for particles
     nDim_          = params.nDim_particle;
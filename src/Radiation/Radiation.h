@@ -112,6 +112,9 @@ protected:
     double dt_;
 
     Random * rand_;
+    
+    //! Stream of the counter-based random numbers of this species
+    uint32_t random_stream_;
 
     // _________________________________________
     // Factors
@@ -306,6 +306,11 @@ void RadiationMonteCarlo::operator()(
         // Number of emitted photons per particles
         int i_photon_emission = 0;
 
+#ifndef SMILEI_ACCELERATOR_GPU_OACC
+        // Number of random numbers drawn for this particle
+        uint32_t idraw = 0;
+#endif
+
         // Monte-Carlo Manager inside the time step
         while( ( local_it_time < dt_ )
                 &&( mc_it_nb < max_monte_carlo_iterations_ ) ) {
@@ -339,7 +344,7 @@ void RadiationMonteCarlo::operator()(
                 while( tau[ipart] <= epsilon_tau_ ) {
                     //tau[ipart] = -log( 1.-Rand::uniform() );
                     #ifndef SMILEI_ACCELERATOR_GPU_OACC
-                        tau[ipart] = -std::log( 1.-rand_->uniform() );
+                        tau[ipart] = rand_->exponential( random_stream_, idraw++, ipart );
                     #else
                         seed_curand_1 = (int) (ipart+1)*(initial_seed_1+1); //Seed for linear generator
                         seed_curand_1 = (a * seed_curand_1 + c) % m; //Linear generator
@@ -382,7 +387,7 @@ void RadiationMonteCarlo::operator()(
 
                     // Draw random number in [0,1[
                     #ifndef SMILEI_ACCELERATOR_GPU_OACC
-                        random_number = rand_->uniform();
+                        random_number = rand_->uniform( random_stream_, idraw++, ipart );
                     #else
                         seed_curand_2 = (int) (ipart + 1)*(initial_seed_2 + 1); //Seed for linear generator
                         seed_curand_2 = (a * seed_curand_2 + c) % m; //Linear generator
@@ -91,7 +91,9 @@ void RadiationNiel::operator()(
 
     // Particle id
     int ipart;
+#ifdef SMILEI_ACCELERATOR_GPU_OACC
     double p;
+#endif
 
     // Radiated energy
     double rad_energy;
@@ -234,59 +236,13 @@ void RadiationNiel::operator()(
 
     #else
 
-    // Vectorized computation of the random number in a uniform distribution
-    // #pragma omp simd
+    // Vectorized computation of the random numbers in a normal distribution
+    // of standard deviation sqrt(dt_) (variance dt_)
+    // (counter-based, so that they do not depend on the order of the particles)
+    rand_->normals( random_stream_, 0, istart, nbparticles, random_numbers );
+    #pragma omp simd
     for( ipart=0 ; ipart < nbparticles; ipart++ ) {
-
-        // Below particle_chi = minimum_chi_continuous, radiation losses are negligible
-        if( particle_chi[ipart+istart] > minimum_chi_continuous ) {
-
-            // Pick a random number in the normal distribution of standard
-            // deviation sqrt(dt_) (variance dt_)
-            //random_numbers[ipart] = 2.*Rand::uniform() -1.;
-            //random_numbers[ipart] = 2.*drand48() -1.;
-            random_numbers[ipart] = rand_->uniform2();
-        }
-        // else {
-        //     random_numbers[ipart] = 0;
-        // }
-    }
-
-    // Vectorized computation of the random number in a normal distribution
-    #pragma omp simd private(p,temp)
-    for( ipart=0 ; ipart < nbparticles; ipart++ ) {
-        // Below particle_chi = minimum_chi_continuous, radiation losses are negligible
-        if( particle_chi[ipart+istart] > minimum_chi_continuous ) {
-            temp = -std::log( ( 1.0-random_numbers[ipart] )*( 1.0+random_numbers[ipart] ) );
-
-            if( temp < 5.000000 ) {
-                temp = temp - 2.500000;
-                p = +2.81022636000e-08      ;
-                p = +3.43273939000e-07 + p*temp;
-                p = -3.52338770000e-06 + p*temp;
-                p = -4.39150654000e-06 + p*temp;
-                p = +0.00021858087e+00 + p*temp;
-                p = -0.00125372503e+00 + p*temp;
-                p = -0.00417768164e+00 + p*temp;
-                p = +0.24664072700e+00 + p*temp;
-                p = +1.50140941000e+00 + p*temp;
-            } else {
-                temp = std::sqrt( temp ) - 3.000000;
-                p = -0.000200214257      ;
-                p = +0.000100950558 + p*temp;
-                p = +0.001349343220 + p*temp;
-                p = -0.003673428440 + p*temp;
-                p = +0.005739507730 + p*temp;
-                p = -0.007622461300 + p*temp;
-                p = +0.009438870470 + p*temp;
-                p = +1.001674060000 + p*temp;
-                p = +2.832976820000 + p*temp;
-            }
-
-            random_numbers[ipart] *= p*sqrtdt*std::sqrt( 2. );
-
-            //random_numbers[ipart] = userFunctions::erfinv2(random_numbers[ipart])*sqrtdt*sqrt(2.);
-        }
+        random_numbers[ipart] *= sqrtdt;
     }
     #endif
 
@@ -37,6 +37,9 @@
 #include "DoubleGrids.h"
 #include "DoubleGridsAM.h"
 #include "Timers.h"
+#include "PartCompTimeCalibration.h"
+#include "FieldMemoryPool.h"
+#include "EventTracing.h"
 
 using namespace std;
 
@@ -106,6 +109,7 @@ int main( int argc, char *argv[] )
     // Read and print simulation parameters
     TITLE( "Reading the simulation parameters" );
     Params params( &smpi, vector<string>( argv + 1, argv + argc ) );
+    FieldMemoryPool::setCapacity( params.field_memory_pool * 1024 * 1024 );
     OpenPMDparams openPMD( params );
     PyTools::setIteration( 0 );
 
@@ -262,6 +266,7 @@ int main( int argc, char *argv[] )
 
         // Patch reconfiguration for the adaptive vectorization
         if( params.has_adaptive_vectorization ) {
+            PartCompTimeCalibration::calibrate( params, &smpi, vecPatches );
             vecPatches.configuration( params, timers, 0 );
         }
 
@@ -343,6 +348,7 @@ int main( int argc, char *argv[] )
 
         // Patch reconfiguration
         if( params.has_adaptive_vectorization ) {
+            PartCompTimeCalibration::calibrate( params, &smpi, vecPatches );
             vecPatches.configuration( params, timers, 0 );
         }
 
@@ -490,6 +496,10 @@ int main( int argc, char *argv[] )
             PyTools::setIteration( itime ); // sets python variable "Main.iteration" for users
         }
         
+#ifdef _PARTEVENTTRACING
+        EventTracing::startIteration( itime );
+#endif
+
         #pragma omp parallel shared (time_dual,smpi,params, vecPatches, region, simWindow, checkpoint, itime)
         {
             
@@ -634,7 +644,8 @@ int main( int argc, char *argv[] )
         #pragma omp parallel shared (time_dual,smpi,params, vecPatches, region, simWindow, checkpoint, itime)
         {
             // finalize particle exchanges and sort particles
-            vecPatches.finalizeExchParticlesAndSort( params, &smpi, simWindow, time_dual, timers, itime );
+            vecPatches.finalizeExchParticlesAndSort( params, &smpi, simWindow, radiation_tables_,
+                                                     multiphoton_Breit_Wheeler_tables_, time_dual, timers, itime );
 
             // Particle merging
             vecPatches.mergeParticles(params, time_dual,timers, itime );
@@ -678,7 +689,7 @@ int main( int argc, char *argv[] )
 
             // Checkpointing: dump data
             #pragma omp master
-            checkpoint.dump( vecPatches, region, itime, &smpi, simWindow, params );
+            checkpoint.dump( vecPatches, region, itime, &smpi, simWindow, params, timers );
             #pragma omp barrier
             // ----------------------------------------------------------------------
 
@@ -733,6 +744,10 @@ int main( int argc, char *argv[] )
             }
         }
 
+#ifdef _PARTEVENTTRACING
+        EventTracing::endIteration();
+#endif
+
         // print message at given time-steps
         // --------------------------------
         if( params.printNow( itime ) ) {
@@ -748,6 +763,10 @@ int main( int argc, char *argv[] )
     
     }//END of the time loop
 
+#ifdef _PARTEVENTTRACING
+    EventTracing::finalize();
+#endif
+    checkpoint.waitAsynchronousDump( timers );
     smpi.barrier();
 
     // ------------------------------------------------------------------
@@ -758,6 +777,7 @@ int main( int argc, char *argv[] )
 
     TITLE( "Time profiling : (print time > 0.001%)" );
     timers.profile( &smpi );
+    timers.sortingStatistics( &smpi, vecPatches );
 
     smpi.barrier();
 
@@ -784,6 +804,7 @@ int main( int argc, char *argv[] )
     vecPatches.close( &smpi );
     smpi.barrier(); // Don't know why but sync needed by HDF5 Phasespace managment
     delete simWindow;
+    FieldMemoryPool::clear();
     PyTools::closePython();
     TITLE( "END" );
 
@@ -0,0 +1,164 @@
+#include "AggregatedExchange.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+
+#include "EventTracing.h"
+#include "Field.h"
+#include "Patch.h"
+#include "VectorPatch.h"
+
+using namespace std;
+
+AggregatedExchange::AggregatedExchange( MPI_Comm comm, int tag ) :
+    active_( false ),
+    comm_( comm ),
+    tag_( tag ),
+    dim_start_( 0 ),
+    dim_end_( 0 ),
+    built_iteration_( 0 ),
+    built_( false )
+{
+}
+
+AggregatedExchange::~AggregatedExchange()
+{
+    clear();
+}
+
+void AggregatedExchange::clear()
+{
+    if( active_ ) {
+        MPI_Waitall( requests_.size(), &requests_[0], MPI_STATUSES_IGNORE );
+        active_ = false;
+    }
+    for( unsigned int i=0 ; i<requests_.size() ; i++ ) {
+        MPI_Request_free( &requests_[i] );
+    }
+    requests_.clear();
+    sends_.clear();
+    recvs_.clear();
+    send_faces_.clear();
+    recv_faces_.clear();
+    built_ = false;
+}
+
+void AggregatedExchange::build( vector<Field *> &fields, vector<int> &field_patches, VectorPatch &vecPatches,
+                                unsigned int dim_start, unsigned int dim_end )
+{
+    clear();
+
+    // Faces sent to and received from each MPI process
+    // Both processes sort them by the receiving patch so that they are packed and unpacked in the same order
+    map<int, vector<Face> > sent, received;
+    vector<unsigned int> component( vecPatches.size(), 0 );
+    for( unsigned int ifield=0 ; ifield<fields.size() ; ifield++ ) {
+        unsigned int ipatch = field_patches.empty() ? ifield : field_patches[ifield % field_patches.size()];
+        Patch *patch = vecPatches( ipatch );
+        unsigned int icomp = component[ipatch]++;
+        for( unsigned int iDim=dim_start ; iDim<dim_end ; iDim++ ) {
+            for( unsigned int iNeighbor=0 ; iNeighbor<2 ; iNeighbor++ ) {
+                if( !patch->is_a_MPI_neighbor( iDim, iNeighbor ) ) {
+                    continue;
+                }
+                Face face;
+                face.ifield = ifield;
+                face.slot = iDim*2+iNeighbor;
+                face.offset = 0;
+
+                face.key = {{ ( unsigned int ) patch->neighbor_[iDim][iNeighbor], iDim, 1-iNeighbor, icomp }};
+                face.size = fields[ifield]->sendFields_[face.slot]->size();
+                sent[patch->MPI_neighbor_[iDim][iNeighbor]].push_back( face );
+
+                face.key = {{ ( unsigned int ) patch->hindex, iDim, iNeighbor, icomp }};
+                face.size = fields[ifield]->recvFields_[face.slot]->size();
+                received[patch->MPI_neighbor_[iDim][iNeighbor]].push_back( face );
+            }
+        }
+    }
+
+    for( int isend=0 ; isend<2 ; isend++ ) {
+        map<int, vector<Face> > &faces = isend ? sent : received;
+        vector<Message> &messages = isend ? sends_ : recvs_;
+        vector<pair<unsigned int, unsigned int> > &all_faces = isend ? send_faces_ : recv_faces_;
+        for( map<int, vector<Face> >::iterator it = faces.begin() ; it != faces.end() ; it++ ) {
+            Message message;
+            message.rank = it->first;
+            message.faces = it->second;
+            sort( message.faces.begin(), message.faces.end() );
+            unsigned int offset = 0;
+            for( unsigned int iface=0 ; iface<message.faces.size() ; iface++ ) {
+                message.faces[iface].offset = offset;
+                offset += message.faces[iface].size;
+                all_faces.push_back( make_pair( messages.size(), iface ) );
+            }
+            message.buffer.resize( offset );
+            messages.push_back( message );
+        }
+    }
+
+    // Persistent requests, created once the buffers do not move anymore
+    requests_.resize( recvs_.size() + sends_.size() );
+    for( unsigned int i=0 ; i<recvs_.size() ; i++ ) {
+        MPI_Recv_init( &recvs_[i].buffer[0], recvs_[i].buffer.size(), MPI_DOUBLE, recvs_[i].rank, tag_, comm_, &requests_[i] );
+    }
+    for( unsigned int i=0 ; i<sends_.size() ; i++ ) {
+        MPI_Send_init( &sends_[i].buffer[0], sends_[i].buffer.size(), MPI_DOUBLE, sends_[i].rank, tag_, comm_, &requests_[recvs_.size()+i] );
+    }
+
+    fields_ = fields;
+    field_patches_ = field_patches;
+    dim_start_ = dim_start;
+    dim_end_ = dim_end;
+    built_iteration_ = vecPatches.lastIterationPatchesMoved;
+    built_ = true;
+}
+
+void AggregatedExchange::start( vector<Field *> &fields, vector<int> &field_patches, VectorPatch &vecPatches,
+                                unsigned int dim_start, unsigned int dim_end )
+{
+    #pragma omp single
+    {
+        if( !built_
+            || built_iteration_ != vecPatches.lastIterationPatchesMoved
+            || dim_start_ != dim_start || dim_end_ != dim_end
+            || fields_ != fields || field_patches_ != field_patches ) {
+            build( fields, field_patches, vecPatches, dim_start, dim_end );
+        }
+    }
+
+    #pragma omp for schedule(static)
+    for( unsigned int i=0 ; i<send_faces_.size() ; i++ ) {
+        Message &message = sends_[send_faces_[i].first];
+        Face &face = message.faces[send_faces_[i].second];
+        memcpy( &message.buffer[face.offset], fields_[face.ifield]->sendFields_[face.slot]->data_, face.size*sizeof( double ) );
+    }
+
+    #pragma omp single
+    {
+        if( requests_.size() > 0 ) {
+            MPI_Startall( requests_.size(), &requests_[0] );
+        }
+        active_ = true;
+    }
+}
+
+void AggregatedExchange::finalize()
+{
+    #pragma omp single
+    {
+        if( requests_.size() > 0 ) {
+            EventTracing::Scope trace( EventTracing::mpi_wait );
+            MPI_Waitall( requests_.size(), &requests_[0], MPI_STATUSES_IGNORE );
+        }
+        active_ = false;
+    }
+
+    #pragma omp for schedule(static)
+    for( unsigned int i=0 ; i<recv_faces_.size() ; i++ ) {
+        Message &message = recvs_[recv_faces_[i].first];
+        Face &face = message.faces[recv_faces_[i].second];
+        memcpy( fields_[face.ifield]->recvFields_[face.slot]->data_, &message.buffer[face.offset], face.size*sizeof( double ) );
+    }
+}
@@ -0,0 +1,97 @@
+#ifndef AGGREGATEDEXCHANGE_H
+#define AGGREGATEDEXCHANGE_H
+
+#include <mpi.h>
+#include <array>
+#include <vector>
+
+class Field;
+class VectorPatch;
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class AggregatedExchange
+//! Exchange of the ghost cells of a group of fields (one or several fields per patch) in which all the faces
+//! going to the same MPI process are packed in a single message. The messages are persistent requests,
+//! built at the first exchange and rebuilt only when the patches have moved (load balancing, moving window).
+//! The faces are the sub-fields sendFields_ and recvFields_ of the fields, filled and used by the caller
+//! as with Patch::initExchange and Patch::finalizeExchange. The exchanges between patches of the same
+//! process are not handled here: they remain direct copies.
+//  --------------------------------------------------------------------------------------------------------------------
+class AggregatedExchange
+{
+public:
+
+    //! All the messages of this exchange use the given communicator and tag
+    AggregatedExchange( MPI_Comm comm, int tag );
+    ~AggregatedExchange();
+
+    // -------------------------------------------------------------------------
+    //! Pack the faces sendFields_ along dimensions dim_start to dim_end-1 and start the messages
+    //! @param field_patches index of the patch of each field, repeated for each component when the fields
+    //! contain several components one after the other (empty when fields[i] belongs to patch i)
+    //! Contains OpenMP worksharing constructs: must be called by all threads of the parallel region
+    // -------------------------------------------------------------------------
+    void start( std::vector<Field *> &fields, std::vector<int> &field_patches, VectorPatch &vecPatches,
+                unsigned int dim_start, unsigned int dim_end );
+
+    // -------------------------------------------------------------------------
+    //! Wait for the messages and unpack them in the faces recvFields_
+    //! Contains OpenMP worksharing constructs: must be called by all threads of the parallel region
+    // -------------------------------------------------------------------------
+    void finalize();
+
+    //! Whether messages were started and not yet finalized
+    bool active_;
+
+private:
+
+    //! Order of the faces in a message: hindex of the receiving patch, dimension, side of the receiving patch, component
+    typedef std::array<unsigned int, 4> FaceKey;
+
+    //! Location of a face in the fields and in the message buffer
+    struct Face {
+        FaceKey key;
+        unsigned int ifield;
+        unsigned int slot;
+        unsigned int offset;
+        unsigned int size;
+        bool operator<( const Face &other ) const
+        {
+            return key < other.key;
+        }
+    };
+
+    //! All the faces exchanged with one MPI process
+    struct Message {
+        int rank;
+        std::vector<Face> faces;
+        std::vector<double> buffer;
+    };
+
+    //! Lists the faces, allocates the buffers and creates the persistent requests
+    void build( std::vector<Field *> &fields, std::vector<int> &field_patches, VectorPatch &vecPatches,
+                unsigned int dim_start, unsigned int dim_end );
+
+    //! Frees the persistent requests
+    void clear();
+
+    MPI_Comm comm_;
+    int tag_;
+
+    //! Messages sent and received
+    std::vector<Message> sends_, recvs_;
+    //! Persistent requests: the receptions then the sends
+    std::vector<MPI_Request> requests_;
+    //! All the faces sent (then received) as pairs of (message, face) indices, for the OpenMP loops
+    std::vector<std::pair<unsigned int, unsigned int> > send_faces_, recv_faces_;
+
+    //! Fields, patches, dimensions and iteration of the last patch move when the messages were built
+    std::vector<Field *> fields_;
+    std::vector<int> field_patches_;
+    unsigned int dim_start_, dim_end_;
+    unsigned int built_iteration_;
+    bool built_;
+
+};//END class AggregatedExchange
+
+#endif
@@ -73,6 +73,10 @@ SpeciesMPIbuffers::~SpeciesMPIbuffers()
         delete partSend[i][0];
         delete partSend[i][1];
     }
+    for( size_t i=0 ; i<partSendCorners.size() ; i++ ) {
+        delete partSendCorners[i];
+        delete partRecvCorners[i];
+    }
 }
 
 
@@ -109,5 +113,56 @@ void SpeciesMPIbuffers::allocate( Params &params, Patch *patch )
             partSend[i][1] = new Particles();
         }
     }
+    
+    // Diagonal packets: all displacements crossing at least two dimensions
+    unsigned int ncorners = 1;
+    for( unsigned int i=0 ; i<params.nDim_field ; i++ ) {
+        ncorners *= 3;
+    }
+    partSendCorners.resize( ncorners, NULL );
+    partRecvCorners.resize( ncorners, NULL );
+    partSendSizePerDirection.resize( ncorners, 0 );
+    partRecvSizePerDirection.resize( ncorners, 0 );
+    srequestPerDirection.resize( ncorners );
+    rrequestPerDirection.resize( ncorners );
+    typePartSendPerDirection.resize( ncorners, MPI_DATATYPE_NULL );
+    typePartRecvPerDirection.resize( ncorners, MPI_DATATYPE_NULL );
+    if( params.geometry != "AMcylindrical" ) {
+        for( unsigned int icorner=0 ; icorner<ncorners ; icorner++ ) {
+            unsigned int ncrossed = 0;
+            for( unsigned int i=0, c=icorner ; i<params.nDim_field ; i++, c/=3 ) {
+                ncrossed += ( c%3 != 1 );
+            }
+            if( ncrossed > 1 && !partSendCorners[icorner] ) {
+                partSendCorners[icorner] = new Particles();
+                partRecvCorners[icorner] = new Particles();
+            }
+        }
+    }
 }
 
+
+Particles *SpeciesMPIbuffers::sendPacket( unsigned int index, unsigned int ndim )
+{
+    unsigned int lastDim, side;
+    unsigned int ncrossed = lastCrossedDimension( index, ndim, lastDim, side );
+    if( ncrossed == 0 ) {
+        return NULL;
+    } else if( ncrossed == 1 ) {
+        return partSend[lastDim][1-side];
+    }
+    return partSendCorners[index];
+}
+
+
+Particles *SpeciesMPIbuffers::recvPacket( unsigned int index, unsigned int ndim )
+{
+    unsigned int lastDim, side;
+    unsigned int ncrossed = lastCrossedDimension( index, ndim, lastDim, side );
+    if( ncrossed == 0 ) {
+        return NULL;
+    } else if( ncrossed == 1 ) {
+        return partRecv[lastDim][side];
+    }
+    return partRecvCorners[index];
+}
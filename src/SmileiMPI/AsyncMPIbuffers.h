@@ -45,11 +45,59 @@ public:
     //! ndim vectors of 2 received packets of particles (1 per direction)
     std::vector< std::vector<Particles* > > partSend;
     
+    //! 3^ndim packets of particles leaving towards a diagonal neighbor, indexed by cornerIndex
+    //! (only used by the single-pass exchange, NULL for the faces)
+    std::vector<Particles* > partSendCorners;
+    //! 3^ndim packets of particles received from a diagonal neighbor of another process, indexed by cornerIndex
+    //! (only used by the single-pass exchange, NULL for the faces)
+    std::vector<Particles* > partRecvCorners;
+    
+    //! Index in partSendCorners of the displacement (offset[iDim] = -1, 0 or 1)
+    static unsigned int cornerIndex( const int *offset, unsigned int ndim )
+    {
+        unsigned int index = 0;
+        for( int iDim = ndim-1; iDim >= 0; iDim-- ) {
+            index = 3*index + ( offset[iDim]+1 );
+        }
+        return index;
+    }
+    
     //! ndim vectors of 2 numbers of particles to send (1 per direction)
     std::vector< std::vector< unsigned int > > partSendSize;
     //! ndim vectors of 2 numbers of particles to receive (1 per direction)
     std::vector< std::vector< unsigned int > > partRecvSize;
     
+    //! Single-pass exchange with other processes: numbers of particles sent and received per displacement
+    std::vector<unsigned int> partSendSizePerDirection;
+    std::vector<unsigned int> partRecvSizePerDirection;
+    //! Single-pass exchange with other processes: requests and datatypes per displacement
+    std::vector<MPI_Request> srequestPerDirection;
+    std::vector<MPI_Request> rrequestPerDirection;
+    std::vector<MPI_Datatype> typePartSendPerDirection;
+    std::vector<MPI_Datatype> typePartRecvPerDirection;
+    
+    //! Packet of particles leaving along the displacement `index` (partSend for a face, partSendCorners for a diagonal)
+    Particles *sendPacket( unsigned int index, unsigned int ndim );
+    //! Packet where the particles arriving along the displacement `index` from another process are received
+    //! (partRecv of the face of arrival, partRecvCorners for a diagonal)
+    Particles *recvPacket( unsigned int index, unsigned int ndim );
+    
+    //! Number of dimensions crossed by the displacement `index`, with the last one and the side of arrival in that dimension
+    static unsigned int lastCrossedDimension( unsigned int index, unsigned int ndim, unsigned int &lastDim, unsigned int &side )
+    {
+        unsigned int ncrossed = 0;
+        lastDim = 0;
+        side = 0;
+        for( unsigned int iDim = 0; iDim < ndim; iDim++, index /= 3 ) {
+            if( index%3 != 1 ) {
+                ncrossed++;
+                lastDim = iDim;
+                side = 1 - index%3/2;
+            }
+        }
+        return ncrossed;
+    }
+    
 };
 
 #endif
@@ -134,6 +134,8 @@ void SmileiMPI::init( Params &params, DomainDecomposition *domain_decomposition
     patch_count.resize( smilei_sz, 0 );
     capabilities.resize( smilei_sz, 1 );
     Tcapabilities = smilei_sz;
+    last_balancing_time_ = 0.;
+    predicted_imbalance_ = -1.;
 
     if( smilei_rk == 0 ) {
         remove( "patch_load.txt" ) ;
@@ -238,9 +240,6 @@ void SmileiMPI::init( Params &params, DomainDecomposition *domain_decomposition
 #ifdef _PARTEVENTTRACING
     iter_frequency_particle_event_tracing_ = 100;
     int nthreads = omp_get_max_threads();
-    particle_event_tracing_event_time_.resize(nthreads);
-    particle_event_tracing_start_or_end_.resize(nthreads);
-    particle_event_tracing_event_name_.resize(nthreads);
 
     unsigned int tot_species_number = PyTools::nComponents( "Species" );
     unsigned int Npatches           = params.tot_number_of_patches;
@@ -258,29 +257,9 @@ void SmileiMPI::init( Params &params, DomainDecomposition *domain_decomposition
     }
     Ntasks = int(Ntasks/nthreads); // suppose tasks are evenly distributed among threads
 
-    for (unsigned int ithread = 0; ithread<nthreads; ithread++){
-        // use reserve to prevent frequent memory reallocation which increases tracing overhead
-        particle_event_tracing_event_time_[ithread].reserve(Ntasks);
-        particle_event_tracing_start_or_end_[ithread].reserve(Ntasks);
-        particle_event_tracing_event_name_[ithread].reserve(Ntasks);
-        // initialize vectors to zero size
-        particle_event_tracing_event_time_[ithread].resize(0);          // stores time
-        particle_event_tracing_start_or_end_[ithread].resize(0);        // stores start (0) or end (1)
-        particle_event_tracing_event_name_[ithread].resize(0);          // stores task type
-        // task types:
-        // -  0: Interp 
-        // -  1: Push
-        // -  2: Particle BC
-        // -  3: Proj
-        // -  4: Density Reduction (tasks subgrids)
-        // -  5: Ionization
-        // -  6: Radiation
-        // -  7: Multiphoton Breit Wheeler
-        // -  8: Ionization Reduction of new electrons
-        // -  9: Radiation Reduction of new photons
-        // - 10: Multiphoton Breit Wheeler Reduction of new electron-positron couples
-        // - 11: Computation of keys and count for vectorization
-    }
+    // Fixed-size ring buffers: a start and an end per task, and room for the stages of the main loop and the MPI waits
+    // (event types: see EventTracing::Name)
+    EventTracing::init( smilei_rk, nthreads, 2*Ntasks + 65536, iter_frequency_particle_event_tracing_ );
 #endif
 
 } // END init
@@ -518,20 +497,66 @@ void SmileiMPI::recompute_patch_count( Params &params, VectorPatch &vecpatches,
         Lp_right.resize( patch_count[smilei_rk+1] );
     }
 
+    // In the "measured" mode, the load of a patch is its smoothed wall time per timestep.
+    // The cell load is then converted into a time using the average cost of a particle.
+    bool measured = ( params.load_balancing_mode == "measured" );
+    double particle_cost = 1.;
+    double measured_imbalance = -1.;
+    if( measured ) {
+        double nsteps = max( 1., ( time_dual - last_balancing_time_ ) / params.timestep );
+        last_balancing_time_ = time_dual;
+
+        // Sum of the per-step patch times and number of particles
+        double sample_loc[2] = { 0., 0. }, sample[2];
+        for( unsigned int ipatch=0; ipatch < ( unsigned int )patch_count[smilei_rk]; ipatch++ ) {
+            sample_loc[0] += vecpatches( ipatch )->measured_load_ / nsteps;
+            for( unsigned int ispecies = 0; ispecies < tot_species_number; ispecies++ ) {
+                sample_loc[1] += vecpatches( ipatch )->vecSpecies[ispecies]->getNbrOfParticles();
+            }
+        }
+        MPI_Allreduce( sample_loc, sample, 2, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+        if( sample[0] > 0. && sample[1] > 0. ) {
+            particle_cost = sample[0] / sample[1];
+        }
 
+        // Imbalance actually measured since the previous balancing
+        double rank_load = sample_loc[0] + patch_count[smilei_rk]*cells_load*particle_cost;
+        double max_rank_load, total_load;
+        MPI_Allreduce( &rank_load, &max_rank_load, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD );
+        MPI_Allreduce( &rank_load, &total_load, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+        if( total_load > 0. ) {
+            measured_imbalance = max_rank_load * Tcapabilities / total_load;
+        }
+
+        // Exponential smoothing of the patch loads across balancing periods
+        for( unsigned int ipatch=0; ipatch < ( unsigned int )patch_count[smilei_rk]; ipatch++ ) {
+            Patch *patch = vecpatches( ipatch );
+            double load = patch->measured_load_ / nsteps;
+            if( patch->smoothed_load_ < 0. ) {
+                patch->smoothed_load_ = load;
+            } else {
+                patch->smoothed_load_ = params.load_balancing_smoothing * load + ( 1.-params.load_balancing_smoothing ) * patch->smoothed_load_;
+            }
+            patch->measured_load_ = 0.;
+        }
+    }
 
     while( recompute_tload ) {
 
         Tload_loc = 0.;
         Ncur = 0; // Variation of the number of patches assigned to current rank r.
         for( unsigned int ipatch=0; ipatch < ( unsigned int )patch_count[smilei_rk]; ipatch++ ) {
-            Lp[ipatch] =  cells_load ;
+            Lp[ipatch] =  cells_load * particle_cost ;
         }
 
         //Compute particle contribution to Local Loads of each Patch (Lp)
         for( unsigned int ipatch=0; ipatch < ( unsigned int )patch_count[smilei_rk]; ipatch++ ) {
-            for( unsigned int ispecies = 0; ispecies < tot_species_number; ispecies++ ) {
-                Lp[ipatch] += vecpatches( ipatch )->vecSpecies[ispecies]->getNbrOfParticles()*( 1+( params.frozen_particle_load-1 )*( time_dual < vecpatches( ipatch )->vecSpecies[ispecies]->time_frozen_ ) ) ;
+            if( measured ) {
+                Lp[ipatch] += vecpatches( ipatch )->smoothed_load_;
+            } else {
+                for( unsigned int ispecies = 0; ispecies < tot_species_number; ispecies++ ) {
+                    Lp[ipatch] += vecpatches( ipatch )->vecSpecies[ispecies]->getNbrOfParticles()*( 1+( params.frozen_particle_load-1 )*( time_dual < vecpatches( ipatch )->vecSpecies[ispecies]->time_frozen_ ) ) ;
+                }
             }
             Tload_loc += Lp[ipatch];
         }
@@ -630,6 +655,15 @@ void SmileiMPI::recompute_patch_count( Params &params, VectorPatch &vecpatches,
     //Stores in Ncur the final patch count of this rank
     Ncur += patch_count[smilei_rk] ;
 
+    //In the "measured" mode, the master gathers all patch loads to predict the imbalance of the new distribution
+    std::vector<double> Lp_all;
+    if( measured ) {
+        if( smilei_rk==0 ) {
+            Lp_all.resize( patch_refHindexes[smilei_sz-1] + patch_count[smilei_sz-1] );
+        }
+        MPI_Gatherv( &( Lp[0] ), patch_count[smilei_rk], MPI_DOUBLE, Lp_all.data(), &( patch_count[0] ), &( patch_refHindexes[0] ), MPI_DOUBLE, 0, MPI_COMM_WORLD );
+    }
+
     //Ncur now has to be gathered to all as target_patch_count[smilei_rk]
     MPI_Allgather( &Ncur, 1, MPI_INT, &patch_count[0], 1, MPI_INT, MPI_COMM_WORLD );
 
@@ -644,6 +678,28 @@ void SmileiMPI::recompute_patch_count( Params &params, VectorPatch &vecpatches,
         for( int irk=0; irk<smilei_sz; irk++ ) {
             fout << " patch_count[" << irk << "] = " << patch_count[irk] << endl;
         }
+        if( measured ) {
+            double max_rank_load = 0., total_load = 0.;
+            for( int irk=0; irk<smilei_sz; irk++ ) {
+                double rank_load = 0.;
+                for( int ipatch=patch_refHindexes[irk]; ipatch<patch_refHindexes[irk]+patch_count[irk]; ipatch++ ) {
+                    rank_load += Lp_all[ipatch];
+                }
+                max_rank_load = max( max_rank_load, rank_load );
+                total_load += rank_load;
+            }
+            if( measured_imbalance > 0. ) {
+                fout << " measured imbalance = " << measured_imbalance;
+                if( predicted_imbalance_ > 0. ) {
+                    fout << " (predicted " << predicted_imbalance_ << ")";
+                }
+                fout << endl;
+            }
+            if( total_load > 0. ) {
+                predicted_imbalance_ = max_rank_load * Tcapabilities / total_load;
+                fout << " predicted imbalance = " << predicted_imbalance_ << endl;
+            }
+        }
         fout.close();
     }
 
@@ -800,7 +856,7 @@ void SmileiMPI::isend_species( Patch *patch, int to, int &irequest, int tag, Par
 #endif
 
     // Send some scalars
-    unsigned int nscalars = 4 + ( params.has_MC_radiation_ || params.has_LL_radiation_ || params.has_Niel_radiation_ );
+    unsigned int nscalars = 6 + ( params.has_MC_radiation_ || params.has_LL_radiation_ || params.has_Niel_radiation_ );
     patch->buffer_scalars_particles.resize( nscalars*nspec );
     for( unsigned int ispec=0; ispec<nspec; ispec++ ) {
         unsigned int i = ispec*nscalars;
@@ -808,8 +864,10 @@ void SmileiMPI::isend_species( Patch *patch, int to, int &irequest, int tag, Par
         patch->buffer_scalars_particles[i+1] = patch->vecSpecies[ispec]->nrj_new_part_; // injected
         patch->buffer_scalars_particles[i+2] = patch->vecSpecies[ispec]->nrj_mw_out; // lost by moving window
         patch->buffer_scalars_particles[i+3] = patch->vecSpecies[ispec]->nrj_mw_inj; // gained by moving window
+        patch->buffer_scalars_particles[i+4] = patch->vecSpecies[ispec]->nrj_subcycling_; // gained in subcycled pushes
+        patch->buffer_scalars_particles[i+5] = patch->vecSpecies[ispec]->subcycle_steps_; // current subcycle
         if( params.has_MC_radiation_ || params.has_LL_radiation_ || params.has_Niel_radiation_ ) {
-            patch->buffer_scalars_particles[i+4] = patch->vecSpecies[ispec]->nrj_radiated_; // radiated energy
+            patch->buffer_scalars_particles[i+6] = patch->vecSpecies[ispec]->nrj_radiated_; // radiated energy
         }
     }
     MPI_Isend( &patch->buffer_scalars_particles[0], patch->buffer_scalars_particles.size(), MPI_DOUBLE, to, tag + irequest, world_, &patch->requests_[irequest] );
@@ -826,7 +884,7 @@ void SmileiMPI::isend_fields( Patch *patch, int to, int &irequest, int tag, Para
     }
 
     // Send some scalars
-    unsigned int nscalars = 2 + 2*params.nDim_field;
+    unsigned int nscalars = 4 + 2*params.nDim_field;
     patch->buffer_scalars_fields.resize( nscalars );
     patch->buffer_scalars_fields[0] = patch->EMfields->nrj_mw_out; // lost by moving window
     patch->buffer_scalars_fields[1] = patch->EMfields->nrj_mw_inj; // lost by moving window
@@ -835,6 +893,8 @@ void SmileiMPI::isend_fields( Patch *patch, int to, int &irequest, int tag, Para
             patch->buffer_scalars_fields[2+i*2+jp] = patch->EMfields->poynting[jp][i];
         }
     }
+    patch->buffer_scalars_fields[2+2*params.nDim_field] = patch->measured_load_; // load measured since last balancing
+    patch->buffer_scalars_fields[3+2*params.nDim_field] = patch->smoothed_load_; // load history
     MPI_Isend( &patch->buffer_scalars_fields[0], patch->buffer_scalars_fields.size(), MPI_DOUBLE, to, tag + irequest, world_, &patch->requests_[irequest] );
     irequest ++;
 } // END isend( Patch )
@@ -959,7 +1019,7 @@ void SmileiMPI::recv_species( Patch *patch, int from, int &tag, Params &params )
     tag += 2*nspec;
 
     // Receive some scalars
-    unsigned int nscalars = 4 + ( params.has_MC_radiation_ || params.has_LL_radiation_ || params.has_Niel_radiation_ );
+    unsigned int nscalars = 6 + ( params.has_MC_radiation_ || params.has_LL_radiation_ || params.has_Niel_radiation_ );
     patch->buffer_scalars_particles.resize( nscalars*nspec );
     MPI_Status status;
     MPI_Recv( &patch->buffer_scalars_particles[0], patch->buffer_scalars_particles.size(), MPI_DOUBLE, from, tag, world_, &status );
@@ -970,8 +1030,10 @@ void SmileiMPI::recv_species( Patch *patch, int from, int &tag, Params &params )
         patch->vecSpecies[ispec]->nrj_new_part_ = patch->buffer_scalars_particles[i+1];
         patch->vecSpecies[ispec]->nrj_mw_out    = patch->buffer_scalars_particles[i+2];
         patch->vecSpecies[ispec]->nrj_mw_inj    = patch->buffer_scalars_particles[i+3];
+        patch->vecSpecies[ispec]->nrj_subcycling_ = patch->buffer_scalars_particles[i+4];
+        patch->vecSpecies[ispec]->subcycle_steps_ = patch->buffer_scalars_particles[i+5];
         if( params.has_MC_radiation_ || params.has_LL_radiation_ || params.has_Niel_radiation_ ) {
-            patch->vecSpecies[ispec]->nrj_radiated_ = patch->buffer_scalars_particles[i+4];
+            patch->vecSpecies[ispec]->nrj_radiated_ = patch->buffer_scalars_particles[i+6];
         }
     }
 }
@@ -987,7 +1049,7 @@ void SmileiMPI::recv_fields( Patch *patch, int from, int &tag, Params &params, b
     }
 
     // Receive some scalars
-    unsigned int nscalars = 2 + 2*params.nDim_field;
+    unsigned int nscalars = 4 + 2*params.nDim_field;
     patch->buffer_scalars_fields.resize( nscalars );
     MPI_Status status;
     MPI_Recv( &patch->buffer_scalars_fields[0], patch->buffer_scalars_fields.size(), MPI_DOUBLE, from, tag, world_, &status );
@@ -999,6 +1061,8 @@ void SmileiMPI::recv_fields( Patch *patch, int from, int &tag, Params &params, b
             patch->EMfields->poynting[jp][i] = patch->buffer_scalars_fields[2+i*2+jp];
         }
     }
+    patch->measured_load_ = patch->buffer_scalars_fields[2+2*params.nDim_field];
+    patch->smoothed_load_ = patch->buffer_scalars_fields[3+2*params.nDim_field];
 } // END recv ( Patch )
 
 
@@ -9,6 +9,7 @@
 #include "Field.h"
 #include "Particles.h"
 #include "Tools.h"
+#include "EventTracing.h"
 #include "gpu.h"
 
 class Params;
@@ -36,6 +37,7 @@ class SmileiMPI
     friend class VectorPatch;
     friend class SimWindow;
     friend class AsyncMPIbuffers;
+    friend class SyncVectorPatch;
 
 public:
     SmileiMPI() {};
@@ -369,37 +371,23 @@ public:
     bool test_mode;
 
     // Task tracing diag
-    std::vector<std::vector<double>> particle_event_tracing_event_time_;
-    std::vector<std::vector<unsigned int>> particle_event_tracing_start_or_end_;
-    std::vector<std::vector<int>> particle_event_tracing_event_name_;
     int iter_frequency_particle_event_tracing_;
-    double reference_time_;
 
     // determine if "task" tracing is performed at this iteration
-    bool diagPartEventTracing(double time_dual, double timestep ){
-        bool diagTracing = false;
-        if (int((time_dual-0.5*timestep)/timestep)%(iter_frequency_particle_event_tracing_)==0){
-            diagTracing = true;
-        }
-        return diagTracing;
-    }
-    // trace event or "task"
-    void trace_event(int thread, double event_time,unsigned int event_start_or_end, int event_name)
+    bool diagPartEventTracing( double, double )
     {
-        particle_event_tracing_event_time_[thread].push_back(event_time);           // write time
-        particle_event_tracing_start_or_end_[thread].push_back(event_start_or_end); // write Start/End
-        particle_event_tracing_event_name_[thread].push_back(event_name);           // write Event Name
-    };
+        return EventTracing::active();
+    }
 
     // If particle event tracing diagnostic is activated, trace event
 #ifdef _PARTEVENTTRACING
-    void traceEventIfDiagTracing( bool, int, unsigned int, int ) {};
-#else
     void traceEventIfDiagTracing( bool diag_PartEventTracing, int thread,
                                   unsigned int event_start_or_end, int event_name )
     {
-        if( diag_PartEventTracing ) trace_event( thread, (MPI_Wtime()-reference_time_), event_start_or_end, event_name );
+        if( diag_PartEventTracing ) EventTracing::record( thread, event_start_or_end, event_name );
     };
+#else
+    void traceEventIfDiagTracing( bool, int, unsigned int, int ) {};
 #endif
 
     bool use_BTIS3;
@@ -427,6 +415,11 @@ protected:
     //Number of patches owned by each mpi process.
     std::vector<int>  patch_count, capabilities, patch_refHindexes;
     int Tcapabilities; //Default = smilei_sz (1 per MPI rank)
+
+    //! Time of the previous load balancing, used to normalize measured patch loads per timestep
+    double last_balancing_time_;
+    //! Load imbalance (max/mean) predicted by the previous load balancing, known by the master only
+    double predicted_imbalance_;
 };
 
 
@@ -34,6 +34,7 @@
 #include "SimWindow.h"
 #include "Tools.h"
 #include "gpu.h"
+#include "HardwareCounters.h"
 
 
 // necessary for the static_cast
@@ -52,6 +53,11 @@ Species::Species( Params &params, Patch *patch ) :
     pusher_name_( "boris" ),
     radiation_model_( "none" ),
     time_frozen_( 0 ),
+    subcycling_( 1 ),
+    subcycle_steps_( 0 ),
+    subcycle_fields_steps_( 0 ),
+    subcycle_newcomers_( nullptr ),
+    subcycle_currents_pending_( false ),
     radiating_( false ),
     relativistic_field_initialization_( false ),
     iter_relativistic_initialization_( 0 ),
@@ -177,6 +183,7 @@ void Species::initCluster( Params &params, Patch *patch )
     nrj_mw_inj = 0.;
     nrj_new_part_ = 0.;
     nrj_radiated_ = 0.;
+    nrj_subcycling_ = 0.;
 
 }//END initCluster
 
@@ -299,6 +306,12 @@ void Species::initOperators( Params &params, Patch *patch )
             MPI_buffer_.partSend[iDim][iNeighbor]->initialize( 0, ( *particles ) );
         }
     }
+    for( unsigned int icorner=0 ; icorner < MPI_buffer_.partSendCorners.size() ; icorner++ ) {
+        if( MPI_buffer_.partSendCorners[icorner] ) {
+            MPI_buffer_.partSendCorners[icorner]->initialize( 0, ( *particles ) );
+            MPI_buffer_.partRecvCorners[icorner]->initialize( 0, ( *particles ) );
+        }
+    }
     typePartSend.resize( nDim_field*2, MPI_DATATYPE_NULL );
     typePartRecv.resize( nDim_field*2, MPI_DATATYPE_NULL );
     exchangePatch = MPI_DATATYPE_NULL;
@@ -341,6 +354,25 @@ Species::~Species()
     
     delete birth_records_;
     
+    for( unsigned int i=0; i<subcycle_fields_.size(); i++ ) {
+        delete subcycle_fields_[i];
+    }
+    for( unsigned int i=0; i<subcycle_currents_.size(); i++ ) {
+        delete subcycle_currents_[i];
+    }
+    delete subcycle_newcomers_;
+    
+    for( unsigned int ibin = 0 ; ibin < b_Jx.size() ; ibin++ ) {
+        delete [] b_Jx[ibin];
+        delete [] b_Jy[ibin];
+        delete [] b_Jz[ibin];
+        delete [] b_rho[ibin];
+    }
+    delete [] bin_has_interpolated;
+    delete [] bin_has_pushed;
+    delete [] bin_has_done_particles_BC;
+    delete [] bin_has_projected;
+    
 }
 
 #if defined( SMILEI_ACCELERATOR_GPU )
@@ -874,6 +906,146 @@ void Species::dynamics( double time_dual,
     } // End projection for frozen particles
 } //END dynamics
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Performance counters of the species in its patch (DiagPerformances.patch_timers)
+// The wall time, hardware counters and detailed timers of the patch are read before and after the dynamics
+// (the detailed timers 0 to 6: interpolation, push, projection, cell keys, ionization, radiation, Breit-Wheeler)
+// ---------------------------------------------------------------------------------------------------------------------
+#ifdef  __DETAILED_TIMERS
+const unsigned int Species::n_performance_counters_ = 2 + HardwareCounters::size + 7;
+#else
+const unsigned int Species::n_performance_counters_ = 2 + HardwareCounters::size;
+#endif
+
+#ifdef  __DETAILED_TIMERS
+void Species::startPerformanceCounters( Patch *patch )
+#else
+void Species::startPerformanceCounters( Patch * )
+#endif
+{
+    if( performance_start_.size() == 0 ) {
+        performance_counters_.resize( n_performance_counters_, 0. );
+        performance_start_.resize( n_performance_counters_, 0. );
+    }
+    HardwareCounters::read( &performance_start_[2] );
+#ifdef  __DETAILED_TIMERS
+    for( unsigned int i = 0; i < 7; i++ ) {
+        performance_start_[2+HardwareCounters::size+i] = patch->patch_timers_[i];
+    }
+#endif
+    performance_start_[0] = MPI_Wtime();
+}
+
+#ifdef  __DETAILED_TIMERS
+void Species::stopPerformanceCounters( Patch *patch )
+#else
+void Species::stopPerformanceCounters( Patch * )
+#endif
+{
+    performance_counters_[0] += MPI_Wtime() - performance_start_[0];
+    double counters[HardwareCounters::size];
+    if( HardwareCounters::read( counters ) ) {
+        for( unsigned int i = 0; i < HardwareCounters::size; i++ ) {
+            performance_counters_[2+i] += counters[i] - performance_start_[2+i];
+        }
+    }
+#ifdef  __DETAILED_TIMERS
+    for( unsigned int i = 0; i < 7; i++ ) {
+        const unsigned int j = 2+HardwareCounters::size+i;
+        performance_counters_[j] += patch->patch_timers_[i] - performance_start_[j];
+    }
+#endif
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Operators used by the task-based dynamics (Main.dynamics_tasks)
+// Each bin goes through interpolation -> push -> boundary conditions -> projection, each step being a task
+// depending on the previous step of the same bin, and the currents of each bin are projected on its own buffers.
+// ---------------------------------------------------------------------------------------------------------------------
+bool Species::isBinTaskCompatible( double time_dual, PartWalls *partWalls )
+{
+    if( time_dual <= time_frozen_ || Ionize || Radiate || Multiphoton_Breit_Wheeler_process
+        || partWalls->size() > 0 || particles->interpolated_fields_ ) {
+        return false;
+    }
+    // Thermalizing boundaries draw random numbers from the patch generator
+    for( unsigned int iDim = 0 ; iDim < boundary_conditions_.size() ; iDim++ ) {
+        for( unsigned int iside = 0 ; iside < boundary_conditions_[iDim].size() ; iside++ ) {
+            if( boundary_conditions_[iDim][iside] == "thermalize" ) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void Species::prepareBinTasks( SmileiMPI *smpi, int buffer_id )
+{
+    // The bin buffers and dependency flags are only allocated when tasks are used
+    if( b_Jx.size() == 0 ) {
+        const unsigned int size  = b_dim[0] * b_dim[1] * b_dim[2];
+        const unsigned int sizey = nDim_field > 1 ? b_dim[0] * ( b_dim[1]+1 ) * b_dim[2] : size;
+        const unsigned int sizez = nDim_field > 2 ? b_dim[0] * b_dim[1] * ( b_dim[2]+1 ) : size;
+        b_Jx .resize( Nbins );
+        b_Jy .resize( Nbins );
+        b_Jz .resize( Nbins );
+        b_rho.resize( Nbins );
+        for( unsigned int ibin = 0 ; ibin < Nbins ; ibin++ ) {
+            b_Jx [ibin] = new double[size];
+            b_Jy [ibin] = new double[sizey];
+            b_Jz [ibin] = new double[sizez];
+            b_rho[ibin] = new double[size];
+        }
+        bin_has_interpolated      = new int[Nbins];
+        bin_has_pushed            = new int[Nbins];
+        bin_has_done_particles_BC = new int[Nbins];
+        bin_has_projected         = new int[Nbins];
+    }
+
+    smpi->resizeBuffers( buffer_id, nDim_field, particles->numberOfParticles() );
+}
+
+void Species::interpolateBin( unsigned int ibin, ElectroMagn *EMfields, SmileiMPI *smpi, int buffer_id )
+{
+    Interp->fieldsWrapper( EMfields, *particles, smpi, &( particles->first_index[ibin] ), &( particles->last_index[ibin] ), buffer_id );
+}
+
+void Species::pushBin( unsigned int ibin, SmileiMPI *smpi, int buffer_id )
+{
+    ( *Push )( *particles, smpi, particles->first_index[ibin], particles->last_index[ibin], buffer_id );
+}
+
+void Species::particlesBCBin( unsigned int ibin, Patch *patch, SmileiMPI *smpi, int buffer_id )
+{
+    double energy_lost( 0. );
+    partBoundCond->apply( this, particles->first_index[ibin], particles->last_index[ibin], smpi->dynamics_invgf[buffer_id], patch->rand_, energy_lost );
+    if( mass_ > 0 ) {
+        energy_lost *= mass_;
+    }
+    #pragma omp atomic
+    nrj_bc_lost += energy_lost;
+}
+
+void Species::projectBin( unsigned int ibin, SmileiMPI *smpi, int buffer_id, bool diag_flag )
+{
+    const unsigned int size  = b_dim[0] * b_dim[1] * b_dim[2];
+    const unsigned int sizey = nDim_field > 1 ? b_dim[0] * ( b_dim[1]+1 ) * b_dim[2] : size;
+    const unsigned int sizez = nDim_field > 2 ? b_dim[0] * b_dim[1] * ( b_dim[2]+1 ) : size;
+    memset( b_Jx [ibin], 0, size *sizeof( double ) );
+    memset( b_Jy [ibin], 0, sizey*sizeof( double ) );
+    memset( b_Jz [ibin], 0, sizez*sizeof( double ) );
+    if( diag_flag ) {
+        memset( b_rho[ibin], 0, size *sizeof( double ) );
+    }
+
+    // Do not project test particles nor photons
+    if( ( !particles->is_test ) && ( mass_ > 0 ) ) {
+        Proj->currentsAndDensityWrapperOnBuffers( b_Jx[ibin], b_Jy[ibin], b_Jz[ibin], b_rho[ibin], ibin*cluster_width_,
+                                                  *particles, smpi, particles->first_index[ibin], particles->last_index[ibin],
+                                                  buffer_id, diag_flag );
+    }
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 // For all particles of the species
 //   - interpolate the fields at the particle position
@@ -1367,7 +1539,7 @@ void Species::countSortParticles( Params &params )
 }
 
 // Move all particles from another species to this one
-void Species::importParticles( Params &params, Patch *patch, Particles &source_particles, vector<Diagnostic *> &localDiags, double time_dual, Ionization *I )
+void Species::importParticles( Params &params, Patch *patch, Particles &source_particles, vector<Diagnostic *> &localDiags, double time_dual, Ionization *I, bool new_particles )
 {
 #if defined( SMILEI_ACCELERATOR_GPU_OMP ) || defined( SMILEI_ACCELERATOR_GPU_OACC )
     // ---------------------------------------------------
@@ -1390,12 +1562,12 @@ void Species::importParticles( Params &params, Patch *patch, Particles &source_p
     const double inv_cell_length = 1./ params.cell_length[0];
 
     // If this species is tracked, set the particle IDs
-    if( particles->tracked ) {
+    if( particles->tracked && new_particles ) {
         dynamic_cast<DiagnosticTrack *>( localDiags[tracking_diagnostic] )->setIDs( source_particles );
     }
     
     // If there is a diagnostic for recording particle birth, then copy new particles to the buffer
-    if( birth_records_ ) {
+    if( birth_records_ && new_particles ) {
         birth_records_->update( source_particles, npart, time_dual, I );
     }
     
@@ -1430,17 +1602,6 @@ void Species::importParticles( Params &params, Patch *patch, Particles &source_p
                     src_bin_keys[ip_swap] = tmp;
                 } // rearrange particles
             } // end loop on particles of a cell
-
-            // inject in main data structure per cell
-            source_particles.copyParticles( istart, bin_count[ibin],
-                                        *particles,
-                                        particles->first_index[ibin] );
-            particles->last_index[ibin] += bin_count[ibin];
-            for ( unsigned int idx=ibin+1 ; idx<particles->last_index.size() ; idx++ ) {
-                particles->first_index[idx] += bin_count[ibin];
-                particles->last_index[idx]  += bin_count[ibin];
-            }
-
         }
         // update istart/istop fot the next cell
         istart += bin_count[ibin];
@@ -1450,6 +1611,10 @@ void Species::importParticles( Params &params, Patch *patch, Particles &source_p
             istop = npart;
 
     } // End cell loop
+
+    // inject in main data structure, all bins at once
+    source_particles.copyParticlesToBins( bin_count, *particles );
+
     //particles->cell_keys.resize( particles->size() );
     particles->resizeCellKeys( particles->size() );
 
@@ -2000,6 +2165,193 @@ bool Species::hasMoved( double time_dual, SimWindow *simWindow )
     return time_dual > time_frozen_  || ( simWindow->isMoving( time_dual ) ) ;
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Subcycling (Species.subcycling)
+// In a patch where no particle of the species can move by more than half a cell before the next multiple of
+// subcycling_, the push is delayed until this multiple: meanwhile the species is treated as frozen, and the fields
+// are summed so that the final push uses the fields averaged over the whole subcycle, with a longer timestep.
+// ---------------------------------------------------------------------------------------------------------------------
+bool Species::delaySubcycledPush( Params &params, ElectroMagn *EMfields, int itime )
+{
+    const bool push_now = ( itime % subcycling_ ) == 0;
+    
+    // Decide whether a subcycle starts in this patch
+    if( subcycle_steps_ == 0 ) {
+        if( push_now ) {
+            return false;
+        }
+        const unsigned int nsteps = subcycling_ - itime % subcycling_ + 1;
+        const double max_displacement = 0.5;
+        const unsigned int npart = getNbrOfParticles();
+        const double *const __restrict__ px = particles->getPtrMomentum( 0 );
+        const double *const __restrict__ py = particles->getPtrMomentum( 1 );
+        const double *const __restrict__ pz = particles->getPtrMomentum( 2 );
+        for( unsigned int idim=0; idim<nDim_particle; idim++ ) {
+            const double *const __restrict__ p = particles->getPtrMomentum( idim );
+            double vmax = 0.;
+            #pragma omp simd reduction(max:vmax)
+            for( unsigned int ipart=0; ipart<npart; ipart++ ) {
+                const double v = std::abs( p[ipart] ) / std::sqrt( 1. + px[ipart]*px[ipart] + py[ipart]*py[ipart] + pz[ipart]*pz[ipart] );
+                vmax = std::max( vmax, v );
+            }
+            if( vmax * nsteps * params.timestep * dx_inv_[idim] > max_displacement ) {
+                return false;
+            }
+        }
+        subcycle_fields_steps_ = 0;
+    }
+    
+    // Sum the fields seen by the species
+    Field *fields[6] = { EMfields->Ex_, EMfields->Ey_, EMfields->Ez_, EMfields->Bx_m, EMfields->By_m, EMfields->Bz_m };
+    if( subcycle_fields_.empty() ) {
+        for( unsigned int i=0; i<6; i++ ) {
+            subcycle_fields_.push_back( fields[i]->clone() );
+        }
+    } else if( subcycle_fields_steps_ == 0 ) {
+        for( unsigned int i=0; i<6; i++ ) {
+            subcycle_fields_[i]->copyFrom( fields[i] );
+        }
+    } else {
+        for( unsigned int i=0; i<6; i++ ) {
+            double *const __restrict__ sum = subcycle_fields_[i]->data();
+            const double *const __restrict__ f = fields[i]->data();
+            const unsigned int n = fields[i]->size();
+            #pragma omp simd
+            for( unsigned int j=0; j<n; j++ ) {
+                sum[j] += f[j];
+            }
+        }
+    }
+    subcycle_fields_steps_++;
+    subcycle_steps_++;
+    
+    return ! push_now;
+}
+
+bool Species::beginSubcycledPush( Params &params, ElectroMagn *EMfields )
+{
+    if( subcycle_steps_ == 0 ) {
+        return false;
+    }
+    
+    // The interpolator sees the averaged fields instead of the current ones
+    const double inv_steps = 1. / ( double ) subcycle_fields_steps_;
+    for( unsigned int i=0; i<6; i++ ) {
+        double *const __restrict__ f = subcycle_fields_[i]->data();
+        const unsigned int n = subcycle_fields_[i]->size();
+        #pragma omp simd
+        for( unsigned int j=0; j<n; j++ ) {
+            f[j] *= inv_steps;
+        }
+    }
+    std::swap( EMfields->Ex_ , subcycle_fields_[0] );
+    std::swap( EMfields->Ey_ , subcycle_fields_[1] );
+    std::swap( EMfields->Ez_ , subcycle_fields_[2] );
+    std::swap( EMfields->Bx_m, subcycle_fields_[3] );
+    std::swap( EMfields->By_m, subcycle_fields_[4] );
+    std::swap( EMfields->Bz_m, subcycle_fields_[5] );
+    
+    // One push for all the timesteps of the subcycle
+    Push->setTimestep( subcycle_steps_ * params.timestep );
+    nrj_subcycling_ -= computeEnergy();
+    
+    return true;
+}
+
+void Species::endSubcycledPush( Params &params, ElectroMagn *EMfields )
+{
+    std::swap( EMfields->Ex_ , subcycle_fields_[0] );
+    std::swap( EMfields->Ey_ , subcycle_fields_[1] );
+    std::swap( EMfields->Ez_ , subcycle_fields_[2] );
+    std::swap( EMfields->Bx_m, subcycle_fields_[3] );
+    std::swap( EMfields->By_m, subcycle_fields_[4] );
+    std::swap( EMfields->Bz_m, subcycle_fields_[5] );
+    
+    Push->setTimestep( params.timestep );
+    nrj_subcycling_ += computeEnergy();
+    
+    subcycle_steps_ = 0;
+    subcycle_fields_steps_ = 0;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Particles received during a subcycle are at the current time, while the particles of the patch are still at the
+// start of the subcycle: the newcomers are kept apart, the delayed push catches up right after the exchange
+// (its currents are kept for the next timestep), the particles are exchanged and sorted again, then the newcomers
+// are inserted (see VectorPatch::catchUpSubcycledPush).
+// ---------------------------------------------------------------------------------------------------------------------
+bool Species::holdSubcycleNewcomers()
+{
+    if( subcycle_steps_ == 0 ) {
+        return false;
+    }
+    
+    for( unsigned int iDim=0; iDim<MPI_buffer_.partRecv.size(); iDim++ ) {
+        for( unsigned int iNeighbor=0; iNeighbor<2; iNeighbor++ ) {
+            Particles &partRecv = *MPI_buffer_.partRecv[iDim][iNeighbor];
+            if( partRecv.size() == 0 ) {
+                continue;
+            }
+            if( ! subcycle_newcomers_ ) {
+                subcycle_newcomers_ = new Particles();
+                subcycle_newcomers_->initialize( 0, *particles );
+            }
+            partRecv.copyParticles( 0, partRecv.size(), *subcycle_newcomers_, subcycle_newcomers_->size() );
+            partRecv.clear();
+        }
+    }
+    
+    return subcycle_newcomers_ && subcycle_newcomers_->size() > 0;
+}
+
+void Species::swapSubcycleCurrents( ElectroMagn *EMfields )
+{
+    if( subcycle_currents_.empty() ) {
+        subcycle_currents_.push_back( EMfields->Jx_->clone() );
+        subcycle_currents_.push_back( EMfields->Jy_->clone() );
+        subcycle_currents_.push_back( EMfields->Jz_->clone() );
+    }
+    if( ! subcycle_currents_pending_ ) {
+        for( unsigned int i=0; i<3; i++ ) {
+            subcycle_currents_[i]->put_to( 0. );
+        }
+        subcycle_currents_pending_ = true;
+    }
+    std::swap( EMfields->Jx_, subcycle_currents_[0] );
+    std::swap( EMfields->Jy_, subcycle_currents_[1] );
+    std::swap( EMfields->Jz_, subcycle_currents_[2] );
+}
+
+void Species::importSubcycleNewcomers( Params &params, Patch *patch, std::vector<Diagnostic *> &localDiags, double time_dual )
+{
+    importParticles( params, patch, *subcycle_newcomers_, localDiags, time_dual, nullptr, false );
+}
+
+void Species::addSubcycleCurrents( ElectroMagn *EMfields, unsigned int ispec, bool diag_flag )
+{
+    if( ! subcycle_currents_pending_ ) {
+        return;
+    }
+    
+    // Species currents are projected separately when diagnosed
+    Field *currents[3] = { EMfields->Jx_, EMfields->Jy_, EMfields->Jz_ };
+    if( diag_flag && EMfields->Jx_s[ispec] ) {
+        currents[0] = EMfields->Jx_s[ispec];
+        currents[1] = EMfields->Jy_s[ispec];
+        currents[2] = EMfields->Jz_s[ispec];
+    }
+    for( unsigned int i=0; i<3; i++ ) {
+        double *const __restrict__ J = currents[i]->data();
+        const double *const __restrict__ Jsub = subcycle_currents_[i]->data();
+        const unsigned int n = currents[i]->size();
+        #pragma omp simd
+        for( unsigned int j=0; j<n; j++ ) {
+            J[j] += Jsub[j];
+        }
+    }
+    subcycle_currents_pending_ = false;
+}
+
 void Species::disableXmax()
 {
     partBoundCond->bc_xmax   = &internal_sup;
@@ -82,6 +82,9 @@ public:
     //! alpha parameter in the Tong-Lin ionization model
     double ionization_tl_parameter_;
 
+    //! relative tolerance of the tabulated tunnel ionization rates (0 for the exact formula)
+    double ionization_tolerance_;
+
     //! user defined ionization rate profile
     PyObject *ionization_rate_;
 
@@ -104,6 +107,25 @@ public:
     //! Time for which the species is frozen
     double time_frozen_;
 
+    //! Number of timesteps between two pushes in the patches where the species is subcycled (1 = no subcycling)
+    unsigned int subcycling_;
+
+    //! Number of timesteps of the current subcycle in this patch, including the push (0 = not subcycled)
+    unsigned int subcycle_steps_;
+
+    //! Fields (Ex, Ey, Ez, Bx_m, By_m, Bz_m) summed during the current subcycle, and number of summed timesteps
+    std::vector<Field *> subcycle_fields_;
+    unsigned int subcycle_fields_steps_;
+
+    //! Particles received during the current subcycle: they are at the current time, unlike the delayed ones,
+    //! so they are kept apart until the delayed push has caught up
+    Particles *subcycle_newcomers_;
+
+    //! Currents (Jx, Jy, Jz) of a delayed push which caught up after the particle exchange,
+    //! added to the currents of the next timestep
+    std::vector<Field *> subcycle_currents_;
+    bool subcycle_currents_pending_;
+
     //! logical true if particles radiate
     bool radiating_;
 
@@ -154,6 +176,15 @@ public:
     //! Vector containing all Particles of the considered Species
     Particles *particles;
     Particles particles_sorted[2];
+    //! Statistics of the cell sorting: number of in-place sorts, number of out-of-place sorts,
+    //! number of particles that changed cell or patch, and number of particles sorted
+    uint64_t sorting_statistics_[4] = { 0, 0, 0, 0 };
+    //! Performance counters of the species in its patch since the last output of DiagPerformances
+    //! with `patch_timers`: wall time of the dynamics, wall time of the import and sorting of the particles,
+    //! CPU cycles and instructions of the dynamics, then the detailed timers of the dynamics (if compiled)
+    std::vector<double> performance_counters_;
+    //! Number of performance counters
+    static const unsigned int n_performance_counters_;
     //std::vector<int> index_of_particles_to_exchange;
 
     //! If initialization from file, this contains the number of particles. Otherwise 0
@@ -263,6 +294,8 @@ public:
     double nrj_new_part_;
     //! Accumulate energy lost by the particle with the radiation
     double nrj_radiated_;
+    //! Accumulate kinetic energy gained by the particles in the subcycled pushes
+    double nrj_subcycling_;
 
     //! whether to choose vectorized operators with respective sorting methods
     int vectorized_operators;
@@ -432,6 +465,25 @@ public:
                            RadiationTables &RadiationTables,
                            MultiphotonBreitWheelerTables &MultiphotonBreitWheelerTables );
 
+    //! Start measuring the dynamics of the species in the patch for the performance counters
+    void startPerformanceCounters( Patch *patch );
+    //! Accumulate the performance counters of the dynamics since startPerformanceCounters
+    void stopPerformanceCounters( Patch *patch );
+
+    //! Tells if the dynamics of this species can be split in independent tasks per bin
+    //! (no ionization, radiation, pair creation, walls, thermalizing boundaries or frozen particles)
+    bool isBinTaskCompatible( double time_dual, PartWalls *partWalls );
+    //! True if the particles were moved by the tasks per bin during the current iteration
+    bool uses_bin_tasks_ = false;
+    //! Prepare the particle buffers buffer_id and the bin projection buffers for the tasks per bin
+    void prepareBinTasks( SmileiMPI *smpi, int buffer_id );
+    //! Operators applied by the tasks on the bin ibin, using the particle buffers buffer_id
+    void interpolateBin( unsigned int ibin, ElectroMagn *EMfields, SmileiMPI *smpi, int buffer_id );
+    void pushBin( unsigned int ibin, SmileiMPI *smpi, int buffer_id );
+    void particlesBCBin( unsigned int ibin, Patch *patch, SmileiMPI *smpi, int buffer_id );
+    //! Project the currents (and densities if diag_flag) of the bin ibin on its own buffers
+    void projectBin( unsigned int ibin, SmileiMPI *smpi, int buffer_id, bool diag_flag );
+
     //! Method projecting susceptibility and calculating the particles updated momentum (interpolation, momentum pusher), only particles interacting with envelope
     virtual void ponderomotiveUpdateSusceptibilityAndMomentum( double time_dual,
             ElectroMagn *EMfields,
@@ -524,6 +576,22 @@ public:
     //! Method to know if this species must project diagnostic or trigger exchanges of particles.
     bool  hasMoved( double time_dual, SimWindow *simWindow );
 
+    //! Subcycling: sum the fields seen by the species, and return true if its push is delayed at this timestep
+    bool delaySubcycledPush( Params &params, ElectroMagn *EMfields, int itime );
+    //! Subcycling: prepare the push of the whole subcycle (averaged fields and longer timestep).
+    //! Returns false if the species is not subcycled in this patch.
+    bool beginSubcycledPush( Params &params, ElectroMagn *EMfields );
+    //! Subcycling: restore the fields and the timestep after the push of the subcycle
+    void endSubcycledPush( Params &params, ElectroMagn *EMfields );
+    //! Subcycling: keep apart the particles received during a subcycle. Returns true if there are any.
+    bool holdSubcycleNewcomers();
+    //! Subcycling: exchange the currents of the patch with those of the delayed push catching up
+    void swapSubcycleCurrents( ElectroMagn *EMfields );
+    //! Subcycling: insert the particles received during the subcycle, once the delayed push has caught up
+    void importSubcycleNewcomers( Params &params, Patch *patch, std::vector<Diagnostic *> &localDiags, double time_dual );
+    //! Subcycling: add the currents of a delayed push which caught up to those of this timestep
+    void addSubcycleCurrents( ElectroMagn *EMfields, unsigned int ispec, bool diag_flag );
+
     inline double computeEnergy()
     {
         double nrj( 0. );
@@ -555,7 +623,8 @@ public:
     }
 
     //! Method to import particles in this species while conserving the sorting among bins
-    virtual void importParticles( Params &, Patch *, Particles &, std::vector<Diagnostic *> &, double time_dual, Ionization *I = nullptr );
+    //! (new_particles = false for particles which already exist, to keep their IDs and not record their birth)
+    virtual void importParticles( Params &, Patch *, Particles &, std::vector<Diagnostic *> &, double time_dual, Ionization *I = nullptr, bool new_particles = true );
 
     //! This method eliminates the space gap between the bins
     //! (presence of empty particles between the bins)
@@ -636,11 +705,11 @@ public:
     std::vector<double *> b_Chi;
 
     // Tags for the task dependencies of the particle operations
-    int *bin_has_interpolated;
-    int *bin_has_pushed;
-    int *bin_has_done_particles_BC;
-    int *bin_has_projected_chi;
-    int *bin_has_projected;
+    int *bin_has_interpolated = nullptr;
+    int *bin_has_pushed = nullptr;
+    int *bin_has_done_particles_BC = nullptr;
+    int *bin_has_projected_chi = nullptr;
+    int *bin_has_projected = nullptr;
 
     // buffers for bin projection when tasks are used
     std::vector< std::complex<double> *> b_Jl;
@@ -663,6 +732,9 @@ protected:
 
 private:
 
+    //! Values of the performance counters at the start of the current measurement
+    std::vector<double> performance_start_;
+
 };
 
 #endif
@@ -749,6 +749,13 @@ public:
             this_species->ionization_tl_parameter_ = 6;
             PyTools::extract( "ionization_tl_parameter", this_species->ionization_tl_parameter_, "Species", ispec);
 
+            this_species->ionization_tolerance_ = 0.;
+            PyTools::extract( "ionization_tolerance", this_species->ionization_tolerance_, "Species", ispec);
+            if( this_species->ionization_tolerance_ < 0. ) {
+                ERROR_NAMELIST( "For species '" << species_name << "', ionization_tolerance must be positive or zero",
+                LINK_NAMELIST + std::string("#species") );
+            }
+
             std::string model;
             PyTools::extract( "ionization_model", model, "Species", ispec );
             if( model!="none" ) {
@@ -987,6 +994,35 @@ public:
             LINK_NAMELIST + std::string("#species") );
         }
 
+        // Extract the subcycling period
+        int subcycling = 1;
+        PyTools::extract( "subcycling", subcycling, "Species", ispec );
+        if( subcycling < 1 ) {
+            ERROR_NAMELIST( "For species '" << species_name << "', subcycling must be a positive integer",
+            LINK_NAMELIST + std::string("#species") );
+        }
+        this_species->subcycling_ = subcycling;
+        if( subcycling > 1 ) {
+            if( this_species->mass_ <= 0 || this_species->ionization_model_ != "none" || this_species->radiation_model_ != "none"
+                || this_species->pusher_name_.find( "ponderomotive" ) != std::string::npos ) {
+                ERROR_NAMELIST( "For species '" << species_name << "', subcycling is not compatible with photons, ionization, radiation or envelope pushers",
+                LINK_NAMELIST + std::string("#species") );
+            }
+#ifdef SMILEI_ACCELERATOR_GPU
+            ERROR_NAMELIST( "For species '" << species_name << "', subcycling is not available on GPU",
+            LINK_NAMELIST + std::string("#species") );
+#endif
+            if( params.geometry == "AMcylindrical" || params.is_spectral || params.dynamics_tasks ) {
+                ERROR_NAMELIST( "For species '" << species_name << "', subcycling is only available in cartesian geometries, without spectral solvers nor `dynamics_tasks`",
+                LINK_NAMELIST + std::string("#species") );
+            }
+            if( params.vectorization_mode != "off" ) {
+                ERROR_NAMELIST( "For species '" << species_name << "', subcycling requires `vectorization_mode = \"off\"`",
+                LINK_NAMELIST + std::string("#species") );
+            }
+            MESSAGE( 2, "> Subcycled every " << subcycling << " timesteps where it is cold enough" );
+        }
+
         return this_species;
     } // End Species* create()
 
@@ -1035,6 +1071,7 @@ public:
         new_species->c_part_max_                               = species->c_part_max_;
         new_species->mass_                                     = species->mass_;
         new_species->time_frozen_                              = species->time_frozen_;
+        new_species->subcycling_                               = species->subcycling_;
         new_species->radiating_                                = species->radiating_;
         new_species->relativistic_field_initialization_        = species->relativistic_field_initialization_;
         new_species->iter_relativistic_initialization_         = species->iter_relativistic_initialization_;
@@ -1046,6 +1083,7 @@ public:
         new_species->atomic_number_                            = species->atomic_number_;
         new_species->maximum_charge_state_                     = species->maximum_charge_state_;
         new_species->ionization_tl_parameter_                  = species->ionization_tl_parameter_;
+        new_species->ionization_tolerance_                     = species->ionization_tolerance_;
         new_species->ionization_rate_                          = species->ionization_rate_;
         if( new_species->ionization_rate_!=Py_None ) {
             Py_INCREF( new_species->ionization_rate_ );
@@ -1178,6 +1216,10 @@ public:
                     ERROR_NAMELIST( "For species '"<<s1.name_<<"' ionization_electrons must be a species with mass==1",
                         LINK_NAMELIST + std::string("#species") );
                 }
+                if( s1.electron_species->subcycling_ > 1 ) {
+                    ERROR_NAMELIST( "For species '"<<s1.name_<<"' ionization_electrons cannot be a subcycled species",
+                        LINK_NAMELIST + std::string("#species") );
+                }
                 
                 // int max_eon_number = s1.getNbrOfParticles() * ( s1.atomic_number_ || s1.maximum_charge_state_ );
                 // s1.Ionize->new_electrons.initializeReserve( max_eon_number, *s1.electron_species->particles
@@ -1252,6 +1294,12 @@ public:
                                   LINK_NAMELIST + std::string("#species") );
                             }
 
+                            if( patch->vecSpecies[ispec2]->subcycling_ > 1 ) {
+                                ERROR_NAMELIST( "For species '"<<s1.name_
+                                  <<"', pair species cannot be subcycled",
+                                  LINK_NAMELIST + std::string("#species") );
+                            }
+
                             s1.mBW_pair_species_index_[k] = ispec2;
                             s1.mBW_pair_species_[k] = patch->vecSpecies[ispec2];
 
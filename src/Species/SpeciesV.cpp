@@ -124,6 +124,7 @@ void SpeciesV::initCluster( Params &params, Patch *patch )
     nrj_mw_inj = 0.;
     nrj_new_part_ = 0.;
     nrj_radiated_ = 0.;
+    nrj_subcycling_ = 0.;
 
 }//END initCluster
 
@@ -162,6 +163,16 @@ void SpeciesV::dynamics( double time_dual, unsigned int ispec,
         }
     }
 
+    // Chunks are not compatible with the operators applied to all the particles of the patch at once,
+    // and with the boundary conditions reading the buffers at the absolute particle index (walls, AM)
+    if( params.dynamics_chunk_size > 0 && time_dual > time_frozen_
+        && !Ionize && !Radiate && !Multiphoton_Breit_Wheeler_process
+        && partWalls->size() == 0 && !particles->interpolated_fields_
+        && params.geometry != "AMcylindrical" ) {
+        dynamicsByChunks( ispec, EMfields, params, diag_flag, patch, smpi, diag_PartEventTracing );
+        return;
+    }
+
     unsigned int iPart;
 
     int tid( 0 );
@@ -562,6 +573,120 @@ void SpeciesV::dynamics( double time_dual, unsigned int ispec,
 
 }//END dynamics
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Particle dynamics chunk by chunk: each chunk gathers whole consecutive cells, as many as possible within
+// params.dynamics_chunk_size particles (a single cell may exceed it). The buffers of the thread are resized
+// to the chunk and indexed from its first particle.
+// ---------------------------------------------------------------------------------------------------------------------
+void SpeciesV::dynamicsByChunks( unsigned int ispec, ElectroMagn *EMfields, Params &params, bool diag_flag,
+                                 Patch *patch, SmileiMPI *smpi, bool diag_PartEventTracing )
+{
+    const int ithread = Tools::getOMPThreadNum();
+    const unsigned int ncells = particles->first_index.size();
+    const int chunk_size = params.dynamics_chunk_size;
+
+#ifdef  __DETAILED_TIMERS
+    double timer;
+#endif
+
+    double nrj_lost = 0.;
+
+    // Reinitialize count for sorting and more
+    for( unsigned int i=0; i<count.size(); i++ ) {
+        count[i] = 0;
+    }
+
+    unsigned int first_cell = 0;
+    while( first_cell < ncells ) {
+
+        unsigned int end_cell = first_cell + 1;
+        while( end_cell < ncells && particles->last_index[end_cell] - particles->first_index[first_cell] <= chunk_size ) {
+            end_cell++;
+        }
+        int start = particles->first_index[first_cell], stop = particles->last_index[end_cell-1];
+        if( stop == start ) {
+            first_cell = end_cell;
+            continue;
+        }
+        smpi->resizeBuffers( ithread, nDim_field, stop - start );
+
+#ifdef  __DETAILED_TIMERS
+        timer = MPI_Wtime();
+#endif
+
+        // Interpolate the fields at the particle position
+        smpi->traceEventIfDiagTracing(diag_PartEventTracing, ithread, 0,0);
+        for( unsigned int scell = first_cell ; scell < end_cell ; scell++ ) {
+            Interp->fieldsWrapper( EMfields, *particles, smpi, &( particles->first_index[scell] ),
+                                   &( particles->last_index[scell] ),
+                                   ithread, scell, start );
+        }
+        smpi->traceEventIfDiagTracing(diag_PartEventTracing, ithread,1,0);
+
+#ifdef  __DETAILED_TIMERS
+        patch->patch_timers_[0] += MPI_Wtime() - timer;
+        timer = MPI_Wtime();
+#endif
+
+        // Push the particles and the photons
+        smpi->traceEventIfDiagTracing(diag_PartEventTracing, ithread,0,1);
+        ( *Push )( *particles, smpi, start, stop, ithread, start );
+        smpi->traceEventIfDiagTracing(diag_PartEventTracing, ithread,1,1);
+
+#ifdef  __DETAILED_TIMERS
+        patch->patch_timers_[1] += MPI_Wtime() - timer;
+        timer = MPI_Wtime();
+#endif
+
+        // Boundary conditions and energy lost
+        smpi->traceEventIfDiagTracing(diag_PartEventTracing, ithread,0,2);
+        for( unsigned int scell = first_cell ; scell < end_cell ; scell++ ) {
+            double energy_lost = 0;
+            partBoundCond->apply( this, particles->first_index[scell], particles->last_index[scell], smpi->dynamics_invgf[ithread], patch->rand_, energy_lost );
+            nrj_lost += ( mass_ > 0 ? mass_ : 1. ) * energy_lost;
+        }
+        smpi->traceEventIfDiagTracing(diag_PartEventTracing, ithread,1,2);
+
+        // Cell keys
+        smpi->traceEventIfDiagTracing(diag_PartEventTracing, ithread,0,11);
+        computeParticleCellKeys( params, particles, &particles->cell_keys[0], &count[0], start, stop );
+        smpi->traceEventIfDiagTracing(diag_PartEventTracing, ithread,1,11);
+
+#ifdef  __DETAILED_TIMERS
+        patch->patch_timers_[3] += MPI_Wtime() - timer;
+#endif
+
+        // Project currents if not a Test species and charges as well if a diag is needed.
+        // Do not project if a photon
+        if( ( !particles->is_test ) && ( mass_ > 0 ) ) {
+#ifdef  __DETAILED_TIMERS
+            timer = MPI_Wtime();
+#endif
+
+            smpi->traceEventIfDiagTracing(diag_PartEventTracing, ithread,0,3);
+            for( unsigned int scell = first_cell ; scell < end_cell ; scell++ ) {
+                Proj->currentsAndDensityWrapper(
+                    EMfields, *particles, smpi, particles->first_index[scell],
+                    particles->last_index[scell],
+                    ithread,
+                    diag_flag, params.is_spectral,
+                    ispec, scell, start
+                );
+            }
+            smpi->traceEventIfDiagTracing(diag_PartEventTracing, ithread,1,3);
+
+#ifdef  __DETAILED_TIMERS
+            patch->patch_timers_[2] += MPI_Wtime() - timer;
+#endif
+        }
+
+        first_cell = end_cell;
+    }
+
+    nrj_bc_lost += nrj_lost;
+
+}//END dynamicsByChunks
+
 // ---------------------------------------------------------------------------------------------------------------------
 // For all particles of the species
 //   - increment the charge (projection)
@@ -641,6 +766,27 @@ void SpeciesV::sortParticles( Params &params )
         }
     }
 
+    // Count the particles that changed cell, left the patch or arrived in the patch
+    unsigned int nmoved = 0;
+    for( unsigned int ic=0; ic < ncell; ic++ ) {
+        for( int ip = particles->first_index[ic]; ip < particles->last_index[ic]; ip++ ) {
+            nmoved += ( particles->cell_keys[ip] != ( int ) ic );
+        }
+    }
+    if( npart > ( unsigned int ) particles->last_index.back() ) {
+        nmoved += npart - particles->last_index.back();
+    }
+    for( unsigned int idim=0; idim < nDim_field ; idim++ ) {
+        for( unsigned int ineighbor=0 ; ineighbor < 2 ; ineighbor++ ) {
+            nmoved += MPI_buffer_.partRecv[idim][ineighbor]->size();
+        }
+    }
+
+    bool out_of_place = nmoved > out_of_place_sort_fraction_ * npart;
+    sorting_statistics_[out_of_place ? 1 : 0]++;
+    sorting_statistics_[2] += nmoved;
+    sorting_statistics_[3] += npart;
+
     // second loop convert the count array in cumulative sum
     particles->first_index[0]=0;
     for( unsigned int ic=1; ic < ncell; ic++ ) {
@@ -651,6 +797,11 @@ void SpeciesV::sortParticles( Params &params )
     //New total number of particles is stored as last element of particles->last_index
     particles->last_index[ncell-1] = particles->last_index[ncell-2] + count.back() ;
 
+    if( out_of_place ) {
+        countingSortParticles( params, buf_cell_keys );
+        return;
+    }
+
     //Now proceed to the cycle sort
 
     if( MPI_buffer_.partRecv[0][0]->size() == 0 ) {
@@ -761,6 +912,50 @@ void SpeciesV::sortParticles( Params &params )
     }
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Sort particles out of place: the cell keys are the single digit of a counting sort, whose destinations are given
+// by the cumulative sum of the counts already stored in first_index. The particles are scattered, property by
+// property, into a second particle store which is then swapped with the particles.
+// ---------------------------------------------------------------------------------------------------------------------
+void SpeciesV::countingSortParticles( Params &, vector<int> buf_cell_keys[3][2] )
+{
+    unsigned int npart = particles->size();
+    unsigned int ncell = particles->first_index.size();
+
+    if( sort_buffer_.double_prop_.empty() ) {
+        sort_buffer_.initialize( 0, *particles );
+    }
+    sort_buffer_.resize( particles->last_index.back() );
+
+    // Destination of each particle, the erased particles (negative keys) are not copied
+    sort_destination_.resize( npart );
+    for( unsigned int ip=0; ip < npart; ip++ ) {
+        int key = particles->cell_keys[ip];
+        sort_destination_[ip] = key >= 0 ? particles->first_index[key]++ : -1;
+    }
+    particles->scatterParticles( &sort_destination_[0], npart, sort_buffer_ );
+
+    // The particles just arrived are placed after the other particles of their cell
+    for( unsigned int idim=0; idim < nDim_field ; idim++ ) {
+        for( unsigned int ineighbor=0 ; ineighbor < 2 ; ineighbor++ ) {
+            for( unsigned int ip=0; ip < MPI_buffer_.partRecv[idim][ineighbor]->size(); ip++ ) {
+                int key = buf_cell_keys[idim][ineighbor][ip];
+                int ip_dest = particles->first_index[key]++;
+                MPI_buffer_.partRecv[idim][ineighbor]->overwriteParticle( ip, sort_buffer_, ip_dest );
+                sort_buffer_.cell_keys[ip_dest] = key;
+            }
+        }
+    }
+
+    particles->swapProperties( sort_buffer_ );
+
+    // Restore particles->first_index initial value
+    particles->first_index[0]=0;
+    for( unsigned int ic=1; ic < ncell; ic++ ) {
+        particles->first_index[ic] = particles->last_index[ic-1];
+    }
+}
+
 // Compute particle cell_keys from istart to iend
 // This function vectorizes well on Intel and ARM architectures
 void SpeciesV::computeParticleCellKeys( Params    & params,
@@ -890,18 +1085,18 @@ void SpeciesV::computeParticleCellKeys( Params &params )
 
 }
 
-void SpeciesV::importParticles( Params &params, Patch *, Particles &source_particles, vector<Diagnostic *> &localDiags, double time_dual, Ionization *I )
+void SpeciesV::importParticles( Params &params, Patch *, Particles &source_particles, vector<Diagnostic *> &localDiags, double time_dual, Ionization *I, bool new_particles )
 {
 
     unsigned int npart = source_particles.size(), ncells=particles->first_index.size();
 
     // If this species is tracked, set the particle IDs
-    if( particles->tracked ) {
+    if( particles->tracked && new_particles ) {
         dynamic_cast<DiagnosticTrack *>( localDiags[tracking_diagnostic] )->setIDs( source_particles );
     }
     
     // If there is a diagnostic for recording particle birth, then copy new particles to the buffer
-    if( birth_records_ ) {
+    if( birth_records_ && new_particles ) {
         birth_records_->update( source_particles, npart, time_dual, I );
     }
     
@@ -946,16 +1141,6 @@ void SpeciesV::importParticles( Params &params, Patch *, Particles &source_parti
                     src_cell_keys[ip_swap] = tmp;
                 } // rearrange particles
             } // end loop on particles of a cell
-
-            // inject in main data structure per cell
-            source_particles.copyParticles( istart, src_count[icell],
-                                        *particles,
-                                        particles->first_index[icell] );
-            particles->last_index[icell] += src_count[icell];
-            for ( unsigned int idx=icell+1 ; idx<particles->last_index.size() ; idx++ ) {
-                particles->first_index[idx] += src_count[icell];
-                particles->last_index[idx]  += src_count[icell];
-            }
             count[icell] += src_count[icell];
 
         }
@@ -967,6 +1152,9 @@ void SpeciesV::importParticles( Params &params, Patch *, Particles &source_parti
             istop = npart;
 
     } // End cell loop
+
+    // inject in main data structure, all cells at once
+    source_particles.copyParticlesToBins( src_count, *particles );
     //source_particles.clear();
 
     // Set place for new particles in species->particles->cell_keys
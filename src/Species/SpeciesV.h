@@ -81,7 +81,7 @@ public:
     }
 
     //! Method to import particles in this species while conserving the sorting among bins
-    void importParticles( Params &, Patch *, Particles &, std::vector<Diagnostic *> &, double, Ionization *I = nullptr )override;
+    void importParticles( Params &, Patch *, Particles &, std::vector<Diagnostic *> &, double, Ionization *I = nullptr, bool new_particles = true )override;
 
     //! Method performing the merging of particles
     virtual void mergeParticles( double time_dual )override;
@@ -94,6 +94,22 @@ private:
     //! Size of the pack in number of particles
     unsigned int packsize_;
 
+    //! Particle dynamics by chunks of consecutive cells containing about `dynamics_chunk_size` particles:
+    //! the interpolation, push, boundary conditions, cell keys and projection of a chunk are done
+    //! before the next chunk, so that the thread buffers only hold the particles of one chunk
+    void dynamicsByChunks( unsigned int ispec, ElectroMagn *EMfields, Params &params, bool diag_flag,
+                           Patch *patch, SmileiMPI *smpi, bool diag_PartEventTracing );
+
+    //! Out-of-place counting sort of the particles on their cell keys, used when many particles changed cell
+    void countingSortParticles( Params &params, std::vector<int> buf_cell_keys[3][2] );
+    //! Fraction of the particles changing cell or patch above which the out-of-place sort is used.
+    //! The cycle sort only moves these particles, but each move is a random access to all the properties.
+    static constexpr double out_of_place_sort_fraction_ = 0.1;
+    //! Second particle store, swapped with the particles after each out-of-place sort
+    Particles sort_buffer_;
+    //! Destination of each particle in the out-of-place sort
+    std::vector<int> sort_destination_;
+
 };
 
 #endif
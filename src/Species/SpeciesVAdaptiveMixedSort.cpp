@@ -135,13 +135,13 @@ void SpeciesVAdaptiveMixedSort::resizeCluster( Params &params )
 // 
 // }
 
-void SpeciesVAdaptiveMixedSort::importParticles( Params &params, Patch *patch, Particles &source_particles, vector<Diagnostic *> &localDiags, double time_dual, Ionization *I )
+void SpeciesVAdaptiveMixedSort::importParticles( Params &params, Patch *patch, Particles &source_particles, vector<Diagnostic *> &localDiags, double time_dual, Ionization *I, bool new_particles )
 {
 
     if( vectorized_operators ) {
-        importParticles( params, patch, source_particles, localDiags, time_dual, I );
+        SpeciesV::importParticles( params, patch, source_particles, localDiags, time_dual, I, new_particles );
     } else {
-        Species::importParticles( params, patch, source_particles, localDiags, time_dual, I );
+        Species::importParticles( params, patch, source_particles, localDiags, time_dual, I, new_particles );
     }
 }
 
@@ -50,7 +50,7 @@ public:
     // void computeParticleCellKeys( Params &params ) override;
     
     //! Method to import particles in this species while conserving the sorting among bins
-    void importParticles( Params &, Patch *, Particles &, std::vector<Diagnostic *> &, double, Ionization *I = nullptr )override;
+    void importParticles( Params &, Patch *, Particles &, std::vector<Diagnostic *> &, double, Ionization *I = nullptr, bool new_particles = true )override;
     
 private:
 
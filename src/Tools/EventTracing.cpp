@@ -0,0 +1,130 @@
+#include "EventTracing.h"
+
+#include <fstream>
+#include <iomanip>
+
+using namespace std;
+
+vector<EventTracing::ThreadBuffer> EventTracing::buffers_;
+bool EventTracing::active_ = false;
+unsigned int EventTracing::every_ = 1;
+unsigned int EventTracing::iteration_ = 0;
+int EventTracing::rank_ = 0;
+double EventTracing::origin_ = 0.;
+double EventTracing::iteration_start_ = 0.;
+bool EventTracing::warned_ = false;
+string EventTracing::json_filename_;
+
+// Names in the trace files (the text files use the numbers of the particle operators)
+static const char *event_names[EventTracing::number_of_names] = {
+    "Interpolation", "Push", "Boundary conditions", "Projection", "Density reduction",
+    "Ionization", "Radiation", "Breit-Wheeler", "Ionization reduction", "Radiation reduction",
+    "Breit-Wheeler reduction", "Cell keys",
+    "Dynamics", "Sum densities", "Maxwell", "Particle exchange and sort",
+    "Diagnostics", "Load balancing", "Moving window", "MPI wait"
+};
+
+static const char *event_category( int name )
+{
+    if( name < EventTracing::dynamics ) {
+        return "particles";
+    } else if( name == EventTracing::mpi_wait ) {
+        return "mpi";
+    }
+    return "main loop";
+}
+
+void EventTracing::init( int rank, int number_of_threads, unsigned int capacity, unsigned int every )
+{
+    rank_ = rank;
+    every_ = every;
+    buffers_.resize( number_of_threads );
+    for( int ithread = 0; ithread < number_of_threads; ithread++ ) {
+        buffers_[ithread].events.resize( capacity );
+        buffers_[ithread].count = 0;
+    }
+    origin_ = MPI_Wtime();
+
+    // JSON array of events: the first ones name the process and the threads
+    json_filename_ = "particle_event_tracing_rank_" + to_string( rank_ ) + ".json";
+    ofstream file( json_filename_ );
+    file << "[{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << rank_
+         << ",\"args\":{\"name\":\"MPI process " << rank_ << "\"}}";
+    for( int ithread = 0; ithread < number_of_threads; ithread++ ) {
+        file << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << rank_ << ",\"tid\":" << ithread
+             << ",\"args\":{\"name\":\"OpenMP thread " << ithread << "\"}}";
+    }
+}
+
+void EventTracing::startIteration( unsigned int itime )
+{
+    active_ = ( itime % every_ == 0 );
+    if( active_ ) {
+        iteration_ = itime;
+        iteration_start_ = MPI_Wtime() - origin_;
+        for( unsigned int ithread = 0; ithread < buffers_.size(); ithread++ ) {
+            buffers_[ithread].count = 0;
+        }
+    }
+}
+
+void EventTracing::endIteration()
+{
+    if( ! active_ ) {
+        return;
+    }
+    active_ = false;
+
+    ofstream json( json_filename_, ios_base::app );
+    json << setprecision( 3 ) << fixed;
+    json << ",\n{\"name\":\"Iteration " << iteration_ << "\",\"ph\":\"i\",\"s\":\"p\",\"pid\":" << rank_
+         << ",\"tid\":0,\"ts\":" << iteration_start_*1e6 << "}";
+
+    for( unsigned int ithread = 0; ithread < buffers_.size(); ithread++ ) {
+        ThreadBuffer &buffer = buffers_[ithread];
+        const uint64_t size = buffer.events.size();
+        const uint64_t first = buffer.count > size ? buffer.count - size : 0;
+        if( first > 0 && ! warned_ ) {
+            PMESSAGE( 0, rank_, "Event tracing: " << first << " events overwritten in the buffer of thread " << ithread
+                      << " at iteration " << iteration_ << ", only the last " << size << " events are written" );
+            warned_ = true;
+        }
+
+        // Text file read by scripts/parse_particle_event_tracing.py: particle operators only, starting with a start event
+        ofstream text( "particle_event_tracing_rank_" + to_string( rank_ ) + "_thread_" + to_string( ithread ) + ".txt", ios_base::app );
+        text << "Start Iteration " << iteration_ << "\n";
+        bool started = false;
+        // Events of the trace: the ends of events overwritten in the buffer are skipped
+        unsigned int depth = 0;
+        for( uint64_t i = first; i < buffer.count; i++ ) {
+            const Event &event = buffer.events[i % size];
+            if( event.name < dynamics ) {
+                started = started || event.start_or_end == 0;
+                if( started ) {
+                    text << to_string( event.time ) << " " << event.start_or_end << " " << event.name << " \n";
+                }
+            }
+            if( event.start_or_end == 0 ) {
+                depth++;
+            } else if( depth > 0 ) {
+                depth--;
+            } else {
+                continue;
+            }
+            json << ",\n{\"name\":\"" << event_names[event.name] << "\",\"cat\":\"" << event_category( event.name )
+                 << "\",\"ph\":\"" << ( event.start_or_end == 0 ? "B" : "E" ) << "\",\"pid\":" << rank_
+                 << ",\"tid\":" << ithread << ",\"ts\":" << event.time*1e6 << "}";
+        }
+        text << "End Iteration " << iteration_ << "\n";
+        buffer.count = 0;
+    }
+}
+
+void EventTracing::finalize()
+{
+    if( json_filename_.empty() ) {
+        return;
+    }
+    ofstream json( json_filename_, ios_base::app );
+    json << "\n]\n";
+}
@@ -0,0 +1,121 @@
+#ifndef EVENTTRACING_H
+#define EVENTTRACING_H
+
+#include <mpi.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Tools.h"
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class EventTracing
+//! Tracing of the particle operators, of the stages of the main loop and of the MPI waits, available when compiled
+//! with config=part_event_tracing. During the traced iterations, each thread records the start and end of its
+//! events in a fixed-size ring buffer (the oldest events are overwritten when it is full). At the end of a traced
+//! iteration, each MPI process writes its events
+//!   - in the Chrome trace-event format, readable by standard trace viewers: particle_event_tracing_rank_X.json
+//!   - for the particle operators only, in the text files particle_event_tracing_rank_X_thread_Y.txt
+//!     read by scripts/parse_particle_event_tracing.py
+//  --------------------------------------------------------------------------------------------------------------------
+class EventTracing
+{
+public:
+
+    //! Events: the particle operators (0 to 11), then the stages of the main loop and the MPI waits
+    enum Name {
+        interpolation = 0, push, boundary_conditions, projection, density_reduction,
+        ionization, radiation, breit_wheeler, ionization_reduction, radiation_reduction,
+        breit_wheeler_reduction, cell_keys,
+        dynamics, sum_densities, maxwell, particle_exchange_and_sort,
+        diagnostics, load_balancing, moving_window, mpi_wait,
+        number_of_names
+    };
+
+    //! Allocates the buffers of the threads, each holding `capacity` events, and creates the trace file
+    static void init( int rank, int number_of_threads, unsigned int capacity, unsigned int every );
+
+    //! Starts tracing if the iteration is traced (every `every` iterations); called outside parallel regions
+    static void startIteration( unsigned int itime );
+
+    //! Writes the events of a traced iteration and stops tracing; called outside parallel regions
+    static void endIteration();
+
+    //! Closes the trace file
+    static void finalize();
+
+    //! Whether the current iteration is traced
+    static inline bool active()
+    {
+        return active_;
+    }
+
+    //! Records the start (0) or end (1) of an event on the given thread
+    static inline void record( int thread, unsigned int start_or_end, int name )
+    {
+        ThreadBuffer &buffer = buffers_[thread];
+        Event &event = buffer.events[buffer.count % buffer.events.size()];
+        event.time = MPI_Wtime() - origin_;
+        event.start_or_end = start_or_end;
+        event.name = name;
+        buffer.count++;
+    }
+
+    //! Records an event on the calling thread from the construction to the destruction of the scope,
+    //! when the iteration is traced and `enabled` is true
+    class Scope
+    {
+    public:
+#ifdef _PARTEVENTTRACING
+        Scope( int name, bool enabled = true ) : name_( name ), thread_( -1 )
+        {
+            if( active_ && enabled ) {
+                thread_ = Tools::getOMPThreadNum();
+                record( thread_, 0, name_ );
+            }
+        }
+        ~Scope()
+        {
+            if( thread_ >= 0 ) {
+                record( thread_, 1, name_ );
+            }
+        }
+    private:
+        int name_;
+        int thread_;
+#else
+        Scope( int, bool = true ) {}
+#endif
+    };
+
+private:
+
+    struct Event {
+        double time;
+        unsigned int start_or_end;
+        int name;
+    };
+
+    //! Events of one thread, padded so that the counters of the threads are in different cache lines
+    struct ThreadBuffer {
+        std::vector<Event> events;
+        uint64_t count;
+        char padding[64];
+    };
+
+    static std::vector<ThreadBuffer> buffers_;
+    static bool active_;
+    static unsigned int every_;
+    static unsigned int iteration_;
+    static int rank_;
+    //! Time origin of all the events of this process
+    static double origin_;
+    //! Start of the current traced iteration
+    static double iteration_start_;
+    //! Whether events were overwritten in a previous iteration (warned only once)
+    static bool warned_;
+    static std::string json_filename_;
+
+};//END class EventTracing
+
+#endif
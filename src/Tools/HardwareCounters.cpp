@@ -0,0 +1,54 @@
+#include "HardwareCounters.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#include <cstdint>
+#endif
+
+thread_local int HardwareCounters::fd_[HardwareCounters::size] = { -2, -2 };
+
+bool HardwareCounters::read( double *values )
+{
+#ifdef __linux__
+    if( fd_[0] == -2 ) {
+        // The cycles lead a group so that both counters are read at once
+        const uint64_t config[size] = { PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS };
+        for( unsigned int i = 0; i < size; i++ ) {
+            struct perf_event_attr attr;
+            memset( &attr, 0, sizeof( attr ) );
+            attr.size = sizeof( attr );
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = config[i];
+            attr.read_format = PERF_FORMAT_GROUP;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            fd_[i] = syscall( __NR_perf_event_open, &attr, 0, -1, i == 0 ? -1 : fd_[0], 0 );
+            if( fd_[i] < 0 ) {
+                for( unsigned int j = 0; j < i; j++ ) {
+                    close( fd_[j] );
+                }
+                for( unsigned int j = 0; j < size; j++ ) {
+                    fd_[j] = -1;
+                }
+                break;
+            }
+        }
+    }
+    if( fd_[0] >= 0 ) {
+        uint64_t buffer[1+size];
+        if( ::read( fd_[0], buffer, sizeof( buffer ) ) == ( ssize_t ) sizeof( buffer ) && buffer[0] == size ) {
+            for( unsigned int i = 0; i < size; i++ ) {
+                values[i] = ( double ) buffer[1+i];
+            }
+            return true;
+        }
+    }
+#endif
+    for( unsigned int i = 0; i < size; i++ ) {
+        values[i] = 0.;
+    }
+    return false;
+}
@@ -0,0 +1,27 @@
+#ifndef HARDWARECOUNTERS_H
+#define HARDWARECOUNTERS_H
+
+//  --------------------------------------------------------------------------------------------------------------------
+//! Class HardwareCounters
+//! CPU cycles and instructions of the calling thread, read from the Linux perf_event interface.
+//! The counters of each thread are opened at its first read. They are not available on other systems,
+//! or when forbidden by /proc/sys/kernel/perf_event_paranoid: the values are then zero.
+//  --------------------------------------------------------------------------------------------------------------------
+class HardwareCounters
+{
+public:
+
+    //! Number of counters: CPU cycles, instructions
+    static const unsigned int size = 2;
+
+    //! Current values of the counters of the calling thread, returns false if they are not available
+    static bool read( double *values );
+
+private:
+
+    //! File descriptors of the counters of the calling thread (-2 before opening, -1 if not available)
+    static thread_local int fd_[size];
+
+};//END class HardwareCounters
+
+#endif
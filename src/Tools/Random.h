@@ -37,6 +37,33 @@ namespace Random_namespace // in order to use the random functions without havin
 #ifdef SMILEI_ACCELERATOR_OMP
 #pragma omp declare target
 #endif
+namespace Philox // counter-based generator Philox4x32-10 (Salmon et al., SC'11)
+{
+    //! Replace the counter (c0, c1, c2, c3) by 4 random integers that only depend on
+    //! this counter and on the key (k0, k1). Vectorizes as it has no state.
+    inline void philox4x32( uint32_t &c0, uint32_t &c1, uint32_t &c2, uint32_t &c3, uint32_t k0, uint32_t k1 )
+    {
+        for( int round = 0; round < 10; round++ ) {
+            const uint64_t p0 = ( uint64_t ) 0xD2511F53u * c0;
+            const uint64_t p1 = ( uint64_t ) 0xCD9E8D57u * c2;
+            const uint32_t hi0 = ( uint32_t )( p0 >> 32 ), lo0 = ( uint32_t ) p0;
+            const uint32_t hi1 = ( uint32_t )( p1 >> 32 ), lo1 = ( uint32_t ) p1;
+            c0 = hi1 ^ c1 ^ k0;
+            c1 = lo1;
+            c2 = hi0 ^ c3 ^ k1;
+            c3 = lo0;
+            k0 += 0x9E3779B9u;
+            k1 += 0xBB67AE85u;
+        }
+    }
+    
+    //! Uniform number between 0 and 1 (both excluded) from a random integer
+    inline double toUniform( uint32_t x )
+    {
+        return ( x + 0.5 ) * ( 1./4294967296. );
+    }
+}
+
 class Random
 {
 public:
@@ -47,12 +74,18 @@ public:
         if( xorshift32_state==0 ) {
             xorshift32_state = 4294967295;
         }
+        key_[0] = seed;
+        key_[1] = 0;
+        iteration_ = 0;
     }
     
     Random( Random * rand ) {
         xorshift32_state = rand->xorshift32_state;
+        key_[0] = rand->key_[0];
+        key_[1] = rand->key_[1];
+        iteration_ = rand->iteration_;
     }
-    
+
     //! add n to the seed
     inline void add( uint32_t n ) {
         xorshift32_state += n;
@@ -61,6 +94,72 @@ public:
             xorshift32_state = 4294967295;
         }
     }
+
+    // -----------------------------------------------------------------------------------------------------------------
+    // Counter-based random numbers: they do not depend on the order in which they are drawn, but only on
+    // the key (seed and patch), the iteration, the process, and the index and draw number given by the caller
+    // (typically the particle index and the number of previous draws for this particle in this iteration)
+    // -----------------------------------------------------------------------------------------------------------------
+    
+    //! Identifiers of the processes drawing counter-based random numbers
+    static const uint32_t ionization_process  = 1;
+    static const uint32_t radiation_process   = 2;
+    static const uint32_t multiphoton_process = 3;
+    
+    //! Stream of a process for a given species, so that two species never draw the same numbers
+    static inline uint32_t stream( uint32_t process, uint32_t species ) {
+        return process | ( species << 8 );
+    }
+    
+    //! Set the key of the counter-based generator (seed and patch index)
+    inline void setKey( uint32_t seed, uint32_t patch ) {
+        key_[0] = seed;
+        key_[1] = patch;
+    }
+    
+    //! Set the iteration of the counter-based generator
+    inline void setIteration( uint32_t iteration ) {
+        iteration_ = iteration;
+    }
+    
+    //! Counter-based uniform rand between 0 and 1 (both excluded)
+    inline double uniform( uint32_t stream, uint32_t draw, uint32_t index ) const {
+        uint32_t c0 = index, c1 = draw >> 2, c2 = iteration_, c3 = stream;
+        Philox::philox4x32( c0, c1, c2, c3, key_[0], key_[1] );
+        const uint32_t word = draw & 3;
+        return Philox::toUniform( word == 0 ? c0 : word == 1 ? c1 : word == 2 ? c2 : c3 );
+    }
+    
+    //! Counter-based uniform rands between 0 and 1 (both excluded), for the indices first to first+n-1
+    inline void uniforms( uint32_t stream, uint32_t draw, uint32_t first, unsigned int n, double *__restrict__ out ) const {
+        const uint32_t k0 = key_[0], k1 = key_[1], it = iteration_, c1_draw = draw >> 2, word = draw & 3;
+        #pragma omp simd
+        for( unsigned int i = 0; i < n; i++ ) {
+            uint32_t c0 = first + i, c1 = c1_draw, c2 = it, c3 = stream;
+            Philox::philox4x32( c0, c1, c2, c3, k0, k1 );
+            out[i] = Philox::toUniform( word == 0 ? c0 : word == 1 ? c1 : word == 2 ? c2 : c3 );
+        }
+    }
+    
+    //! Counter-based exponential rand (mean 1)
+    inline double exponential( uint32_t stream, uint32_t draw, uint32_t index ) const {
+        return -std::log( uniform( stream, draw, index ) );
+    }
+    
+    //! Counter-based normal rands (std deviation = 1.), for the indices first to first+n-1.
+    //! Uses the draws `draw` (must be even) and `draw+1`.
+    inline void normals( uint32_t stream, uint32_t draw, uint32_t first, unsigned int n, double *__restrict__ out ) const {
+        const uint32_t k0 = key_[0], k1 = key_[1], it = iteration_, c1_draw = draw >> 2;
+        const bool low = ( draw & 2 ) == 0;
+        #pragma omp simd
+        for( unsigned int i = 0; i < n; i++ ) {
+            uint32_t c0 = first + i, c1 = c1_draw, c2 = it, c3 = stream;
+            Philox::philox4x32( c0, c1, c2, c3, k0, k1 );
+            const double u = Philox::toUniform( low ? c0 : c2 );
+            const double v = Philox::toUniform( low ? c1 : c3 );
+            out[i] = std::sqrt( -2. * std::log( u ) ) * std::cos( 2. * M_PI * v );
+        }
+    }
     
     //! random integer
     inline uint32_t integer() {
@@ -114,6 +213,12 @@ public:
     //! State of the random number generator
     uint32_t xorshift32_state;
 
+    //! Key of the counter-based generator: seed and patch index
+    uint32_t key_[2];
+    
+    //! Iteration used in the counter of the counter-based generator
+    uint32_t iteration_;
+
 private:
     
     //! Random number generator
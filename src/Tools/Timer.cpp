@@ -57,6 +57,16 @@ void Timer::updateInTask( bool store )
     }
 }
 
+//! Set the accumulated time, measured outside of the timer
+void Timer::set( double time, bool store )
+{
+    time_acc_ = time;
+    if( store )
+    {
+        register_timers.push_back( time_acc_ );
+    }
+}
+
 
 #ifdef __DETAILED_TIMERS
 //!Accumulate time couting from last init/restart using patch detailed timers
@@ -24,6 +24,9 @@ public:
     
     //! Accumulate time couting from last init/restart without omp master for tasking
     void updateInTask( bool store = false );
+    
+    //! Set the accumulated time, when it is measured outside of the timer (e.g. by another thread)
+    void set( double time, bool store = false );
 
     
 #ifdef __DETAILED_TIMERS
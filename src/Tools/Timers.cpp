@@ -4,6 +4,7 @@
 #include "Timers.h"
 
 #include "SmileiMPI.h"
+#include "VectorPatch.h"
 #include "Tools.h"
 
 using namespace std;
@@ -28,7 +29,9 @@ Timers::Timers( SmileiMPI *smpi ) :
     envelope( "Envelope" ),
     susceptibility( "Sync_Susceptibility" ),
     grids("Grids"),
-    densitiesCorrection("Dens Correction")
+    densitiesCorrection("Dens Correction"),
+    checkpoint( "Checkpoint" ),             // Checkpoint dump (blocking part)
+    checkpointIO( "Checkpoint I/O" )        // Asynchronous checkpoint writing, overlapping the PIC loop
 #ifdef __DETAILED_TIMERS
     // Details of Dynamic
     , interpolator( "Interpolator" ),
@@ -70,6 +73,8 @@ Timers::Timers( SmileiMPI *smpi ) :
     timers.push_back( &susceptibility );
     timers.push_back( &grids );
     timers.push_back( &densitiesCorrection );
+    timers.push_back( &checkpoint );
+    timers.push_back( &checkpointIO );
     patch_timer_id_start = timers.size()-1;
 #ifdef __DETAILED_TIMERS
     timers.push_back( &interpolator );
@@ -140,7 +145,10 @@ void Timers::profile( SmileiMPI *smpi )
         // Computation of the coverage: it only takes into account
         // the main timers (14)
         for( unsigned int i=1 ; i<patch_timer_id_start+1 ; i++ ) {
-            coverage += timers[i]->getTime();
+            // The asynchronous checkpoint writing overlaps other timers
+            if( timers[i] != &checkpointIO ) {
+                coverage += timers[i]->getTime();
+            }
         }
         
         MESSAGE( "Time_in_time_loop\t" << global.getTime() << "\t"<<coverage/global.getTime()*100.<< "% coverage" );
@@ -176,6 +184,44 @@ void Timers::profile( SmileiMPI *smpi )
     }
 }
 
+//! Output the statistics of the particle sorting of each species, summed over patches and MPI processes
+void Timers::sortingStatistics( SmileiMPI *smpi, VectorPatch &vecPatches )
+{
+    // A process may own no patch: the number of species is taken from the others, and its counts are zero
+    // (one extra element so that the buffers are never empty)
+    unsigned int local_nspec = vecPatches.size() > 0 ? vecPatches( 0 )->vecSpecies.size() : 0;
+    unsigned int nspec = 0;
+    MPI_Allreduce( &local_nspec, &nspec, 1, MPI_UNSIGNED, MPI_MAX, MPI_COMM_WORLD );
+    std::vector<uint64_t> local( 4*nspec+1, 0 ), total( 4*nspec+1, 0 );
+    for( unsigned int ipatch=0 ; ipatch<vecPatches.size() ; ipatch++ ) {
+        for( unsigned int ispec=0 ; ispec<nspec ; ispec++ ) {
+            for( unsigned int i=0 ; i<4 ; i++ ) {
+                local[4*ispec+i] += vecPatches( ipatch )->vecSpecies[ispec]->sorting_statistics_[i];
+            }
+        }
+    }
+    MPI_Reduce( &local[0], &total[0], 4*nspec, MPI_UINT64_T, MPI_SUM, 0, MPI_COMM_WORLD );
+    
+    // Only the cell-sorted species are counted
+    uint64_t nsorts = 0;
+    for( unsigned int ispec=0 ; ispec<nspec ; ispec++ ) {
+        nsorts += total[4*ispec] + total[4*ispec+1];
+    }
+    if( smpi->isMaster() && nsorts > 0 ) {
+        MESSAGE( "\n Particle sorting (in place / out of place, fraction of particles moved):" );
+        for( unsigned int ispec=0 ; ispec<nspec ; ispec++ ) {
+            if( total[4*ispec] + total[4*ispec+1] == 0 ) {
+                continue;
+            }
+            double fraction = total[4*ispec+3] > 0 ? ( double )total[4*ispec+2] / ( double )total[4*ispec+3] : 0.;
+            std::string name = vecPatches.size() > 0 ? vecPatches( 0 )->vecSpecies[ispec]->name_ : "species " + std::to_string( ispec );
+            MESSAGE( 0, "\t" << setw( 20 ) << name
+                     << "\t" << total[4*ispec] << " / " << total[4*ispec+1]
+                     << "\t" << fixed << setprecision( 2 ) << fraction*100. << "%" );
+        }
+    }
+}
+
 //! Perform the required processing on the timers for output
 std::vector<Timer *> Timers::consolidate( SmileiMPI *smpi, bool final_profile )
 {
@@ -7,6 +7,7 @@
 #include "Timer.h"
 
 class SmileiMPI;
+class VectorPatch;
 
 //  --------------------------------------------------------------------------------------------------------------------
 //! Class Timers
@@ -39,6 +40,8 @@ public:
     Timer susceptibility ;
     Timer grids ;
     Timer densitiesCorrection ;
+    Timer checkpoint ;
+    Timer checkpointIO ;
 #ifdef __DETAILED_TIMERS
     Timer interpolator  ;
     Timer pusher  ;
@@ -65,6 +68,9 @@ public:
     //! Output the timer profile
     void profile( SmileiMPI *smpi );
     
+    //! Output the statistics of the particle sorting of each species (the sort time is in the detailed timer `sorting`)
+    void sortingStatistics( SmileiMPI *smpi, VectorPatch &vecPatches );
+    
     //! Perform the required processing on the timers for output
     std::vector<Timer *> consolidate( SmileiMPI *smpi, bool final_profile = false );
     
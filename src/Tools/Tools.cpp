@@ -101,6 +101,16 @@ int Tools::getOMPThreadNum()
 #endif
 }
 
+//! Wrapper to get the number of threads of the current team
+int Tools::getOMPNumThreads()
+{
+#ifdef _OPENMP
+    return ::omp_get_num_threads();
+#else
+    return 1;
+#endif
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 //! This function returns true/flase whether the file exists or not
 //! \param file file name to test
@@ -180,6 +180,8 @@ public:
 
     //! Wrapper to get the thread number
     static int getOMPThreadNum();
+    //! Wrapper to get the number of threads of the current team
+    static int getOMPNumThreads();
 };
 
 #define LINK_NAMELIST "https://smileipic.github.io/Smilei/namelist.html"
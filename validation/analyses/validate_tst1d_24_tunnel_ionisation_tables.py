@@ -0,0 +1,21 @@
+import os, re, numpy as np, math
+import happi
+
+S = happi.Open(["./restart*"], verbose=False)
+
+def mean_charge(name):
+	charge_distribution = S.ParticleBinning("carbon_"+name).getData()
+	charge_distribution /= charge_distribution[0].sum()
+	n = charge_distribution[0].size
+	return np.array([np.sum(d*np.arange(n)) for d in charge_distribution])
+
+# The tabulated rates only differ from the exact ones by the tolerance: the tests below
+# do not depend on the random realization, so that they hold for any reference run
+for bsi_model in ("none", "Tong_Lin", "KAG"):
+	exact = mean_charge(bsi_model+"_exact")
+	tables = mean_charge(bsi_model+"_tables")
+	Validate(bsi_model+": Carbon is ionized (exact rates)", exact[-1] > 1.)
+	Validate(bsi_model+": Carbon mean charge with tabulated rates within 0.02 of exact rates", np.max(np.abs(tables - exact)) < 0.02)
+	Zavg = np.array(S.Scalar("Zavg_carbon_"+bsi_model+"_tables").getData())
+	n = min(Zavg.size, tables.size)
+	Validate(bsi_model+": Scalar Zavg_carbon matches the binned mean charge (tabulated rates)", np.max(np.abs(Zavg[:n] - tables[:n])) < 1e-4)